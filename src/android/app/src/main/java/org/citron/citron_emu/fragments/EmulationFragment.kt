@@ -511,6 +511,7 @@ class EmulationFragment : Fragment(), SurfaceHolder.Callback {
             val FPS = 1
             val FRAMETIME = 2
             val SPEED = 3
+            val NCA_CACHE_HIT_RATE = 4
             perfStatsUpdater = {
                 if (emulationViewModel.emulationStarted.value &&
                     !emulationViewModel.isEmulationStopping.value
@@ -531,6 +532,14 @@ class EmulationFragment : Fragment(), SurfaceHolder.Callback {
                         binding.showFpsText.setTextColor(color)
                         binding.showFpsText.text =
                             String.format("FPS: %.1f\n%s/%s", fps, cpuBackend, gpuDriver)
+
+                        // The hit rate is negative when no NCA blocks were read
+                        val cacheHitRate = perfStats[NCA_CACHE_HIT_RATE]
+                        if (cacheHitRate >= 0) {
+                            binding.showFpsText.append(
+                                String.format("\nNCA cache: %.0f%%", cacheHitRate * 100)
+                            )
+                        }
                     }
                     perfStatsUpdateHandler.postDelayed(perfStatsUpdater!!, 1000)
                 }
@@ -591,16 +591,16 @@ void Java_org_citron_citron_1emu_NativeLibrary_initializeSystem(JNIEnv* env, jcl
 }
 
 jdoubleArray Java_org_citron_citron_1emu_NativeLibrary_getPerfStats(JNIEnv* env, jclass clazz) {
-    jdoubleArray j_stats = env->NewDoubleArray(4);
+    jdoubleArray j_stats = env->NewDoubleArray(5);
 
     if (EmulationSession::GetInstance().IsRunning()) {
         jconst results = EmulationSession::GetInstance().PerfStats();
 
         // Converting the structure into an array makes it easier to pass it to the frontend
-        double stats[4] = {results.system_fps, results.average_game_fps, results.frametime,
-                           results.emulation_speed};
+        double stats[5] = {results.system_fps, results.average_game_fps, results.frametime,
+                           results.emulation_speed, results.nca_cache_hit_rate};
 
-        env->SetDoubleArrayRegion(j_stats, 0, 4, stats);
+        env->SetDoubleArrayRegion(j_stats, 0, 5, stats);
     }
 
     return j_stats;
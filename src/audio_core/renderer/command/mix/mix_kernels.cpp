@@ -0,0 +1,264 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <limits>
+
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
+#include "audio_core/renderer/command/mix/mix_kernels.h"
+#include "common/fixed_point.h"
+
+#if defined(ARCHITECTURE_x86_64) && !defined(_MSC_VER)
+#define MIX_KERNEL_TARGET(isa) __attribute__((target(isa)))
+#else
+#define MIX_KERNEL_TARGET(isa)
+#endif
+
+namespace AudioCore::Renderer {
+namespace {
+/*
+ * Per sample, the fixed point code computes (output + input * volume).to_int(). Since input is
+ * an integer, input * volume is exactly the 64-bit product input * volume.to_raw(), and as
+ * output has no fractional bits the rounding in to_int() only depends on that product:
+ *
+ *   product = s64(input) * volume_raw
+ *   result  = s32(output + ((product + ((product & fractional_mask) >> 1)) >> Q))
+ *
+ * The low 32 bits of the shifted value are the same for arithmetic and logical shifts as Q is
+ * below 32, so the vector kernels only need a 32x32->64-bit signed multiply, 64-bit adds and
+ * logical shifts. They run while every per sample volume fits in 32 bits, which covers any
+ * realistic volume, and leave anything else to the scalar kernel.
+ */
+
+template <size_t Q>
+using Fixed = Common::FixedPoint<64 - Q, Q>;
+
+template <size_t Q>
+constexpr s64 FractionalMask = (s64{1} << Q) - 1;
+
+constexpr bool FitsS32(s64 value) {
+    return value >= std::numeric_limits<s32>::min() && value <= std::numeric_limits<s32>::max();
+}
+
+/// Check if every volume of the ramp can be used by the vector kernels.
+constexpr bool FitsVectorKernel(s64 volume, s64 ramp, u32 sample_count) {
+    if (!FitsS32(volume) || !FitsS32(ramp)) {
+        return false;
+    }
+    // The volume changes linearly, so checking the last one covers everything in between
+    return FitsS32(volume + static_cast<s64>(sample_count - 1) * ramp);
+}
+
+/// Reference kernel, processes samples [begin, end) with Common::FixedPoint.
+template <size_t Q, bool Mix>
+void ScalarKernel(std::span<s32> output, std::span<const s32> input, s64 volume_raw,
+                  s64 ramp_raw, u32 begin, u32 end) {
+    auto volume{Fixed<Q>::from_base(volume_raw + static_cast<s64>(begin) * ramp_raw)};
+    const auto ramp{Fixed<Q>::from_base(ramp_raw)};
+    for (u32 i = begin; i < end; i++) {
+        if constexpr (Mix) {
+            output[i] = (output[i] + input[i] * volume).to_int();
+        } else {
+            output[i] = (input[i] * volume).to_int();
+        }
+        volume += ramp;
+    }
+}
+
+#if defined(ARCHITECTURE_x86_64)
+/// Round 64-bit products to integers, leaving the result in the low 32 bits of each lane.
+template <size_t Q>
+MIX_KERNEL_TARGET("sse4.1")
+__m128i RoundSSE41(__m128i product) {
+    const __m128i fraction{_mm_and_si128(product, _mm_set1_epi64x(FractionalMask<Q>))};
+    return _mm_srli_epi64(_mm_add_epi64(product, _mm_srli_epi64(fraction, 1)), Q);
+}
+
+/// Process samples 4 at a time, returning how many were processed.
+template <size_t Q, bool Mix>
+MIX_KERNEL_TARGET("sse4.1")
+u32 KernelSSE41(s32* output, const s32* input, s32 volume, s32 ramp, u32 sample_count) {
+    __m128i volumes{_mm_add_epi32(
+        _mm_set1_epi32(volume), _mm_mullo_epi32(_mm_set1_epi32(ramp), _mm_setr_epi32(0, 1, 2, 3)))};
+    const __m128i step{_mm_set1_epi32(static_cast<s32>(static_cast<u32>(ramp) * 4))};
+    u32 i = 0;
+    for (; i + 4 <= sample_count; i += 4) {
+        const __m128i samples{_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + i))};
+        const __m128i even{RoundSSE41<Q>(_mm_mul_epi32(samples, volumes))};
+        const __m128i odd{RoundSSE41<Q>(
+            _mm_mul_epi32(_mm_srli_epi64(samples, 32), _mm_srli_epi64(volumes, 32)))};
+        __m128i result{_mm_blend_epi16(even, _mm_slli_epi64(odd, 32), 0xCC)};
+        if constexpr (Mix) {
+            result = _mm_add_epi32(
+                result, _mm_loadu_si128(reinterpret_cast<const __m128i*>(output + i)));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), result);
+        volumes = _mm_add_epi32(volumes, step);
+    }
+    return i;
+}
+
+template <size_t Q>
+MIX_KERNEL_TARGET("avx2")
+__m256i RoundAVX2(__m256i product) {
+    const __m256i fraction{_mm256_and_si256(product, _mm256_set1_epi64x(FractionalMask<Q>))};
+    return _mm256_srli_epi64(_mm256_add_epi64(product, _mm256_srli_epi64(fraction, 1)), Q);
+}
+
+/// Process samples 8 at a time, returning how many were processed.
+template <size_t Q, bool Mix>
+MIX_KERNEL_TARGET("avx2")
+u32 KernelAVX2(s32* output, const s32* input, s32 volume, s32 ramp, u32 sample_count) {
+    __m256i volumes{_mm256_add_epi32(
+        _mm256_set1_epi32(volume),
+        _mm256_mullo_epi32(_mm256_set1_epi32(ramp), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)))};
+    const __m256i step{_mm256_set1_epi32(static_cast<s32>(static_cast<u32>(ramp) * 8))};
+    u32 i = 0;
+    for (; i + 8 <= sample_count; i += 8) {
+        const __m256i samples{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + i))};
+        const __m256i even{RoundAVX2<Q>(_mm256_mul_epi32(samples, volumes))};
+        const __m256i odd{RoundAVX2<Q>(
+            _mm256_mul_epi32(_mm256_srli_epi64(samples, 32), _mm256_srli_epi64(volumes, 32)))};
+        __m256i result{_mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA)};
+        if constexpr (Mix) {
+            result = _mm256_add_epi32(
+                result, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(output + i)));
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i), result);
+        volumes = _mm256_add_epi32(volumes, step);
+    }
+    return i;
+}
+#elif defined(ARCHITECTURE_arm64)
+/// Round 64-bit products to integers, narrowing them to 32 bits.
+template <size_t Q>
+int32x2_t RoundNEON(int64x2_t product) {
+    const int64x2_t fraction{vandq_s64(product, vdupq_n_s64(FractionalMask<Q>))};
+    return vmovn_s64(vshrq_n_s64(vaddq_s64(product, vshrq_n_s64(fraction, 1)), Q));
+}
+
+/// Process samples 4 at a time, returning how many were processed.
+template <size_t Q, bool Mix>
+u32 KernelNEON(s32* output, const s32* input, s32 volume, s32 ramp, u32 sample_count) {
+    static constexpr s32 lane_offsets[4]{0, 1, 2, 3};
+    int32x4_t volumes{vmlaq_n_s32(vdupq_n_s32(volume), vld1q_s32(lane_offsets), ramp)};
+    const int32x4_t step{vdupq_n_s32(static_cast<s32>(static_cast<u32>(ramp) * 4))};
+    u32 i = 0;
+    for (; i + 4 <= sample_count; i += 4) {
+        const int32x4_t samples{vld1q_s32(input + i)};
+        const int32x2_t low{RoundNEON<Q>(vmull_s32(vget_low_s32(samples), vget_low_s32(volumes)))};
+        const int32x2_t high{RoundNEON<Q>(vmull_high_s32(samples, volumes))};
+        int32x4_t result{vcombine_s32(low, high)};
+        if constexpr (Mix) {
+            result = vaddq_s32(result, vld1q_s32(output + i));
+        }
+        vst1q_s32(output + i, result);
+        volumes = vaddq_s32(volumes, step);
+    }
+    return i;
+}
+#endif
+
+template <size_t Q, bool Mix>
+void ApplyKernel(std::span<s32> output, std::span<const s32> input, f32 volume_, f32 ramp_,
+                 u32 sample_count, MixKernelIsa isa) {
+    const s64 volume{Fixed<Q>{volume_}.to_raw()};
+    const s64 ramp{Fixed<Q>{ramp_}.to_raw()};
+    u32 processed = 0;
+    if (sample_count > 0 && FitsVectorKernel(volume, ramp, sample_count)) {
+        [[maybe_unused]] const auto volume_32{static_cast<s32>(volume)};
+        [[maybe_unused]] const auto ramp_32{static_cast<s32>(ramp)};
+        switch (isa) {
+#if defined(ARCHITECTURE_x86_64)
+        case MixKernelIsa::AVX2:
+            processed = KernelAVX2<Q, Mix>(output.data(), input.data(), volume_32, ramp_32,
+                                           sample_count);
+            break;
+        case MixKernelIsa::SSE41:
+            processed = KernelSSE41<Q, Mix>(output.data(), input.data(), volume_32, ramp_32,
+                                            sample_count);
+            break;
+#elif defined(ARCHITECTURE_arm64)
+        case MixKernelIsa::NEON:
+            processed = KernelNEON<Q, Mix>(output.data(), input.data(), volume_32, ramp_32,
+                                           sample_count);
+            break;
+#endif
+        default:
+            break;
+        }
+    }
+    ScalarKernel<Q, Mix>(output, input, volume, ramp, processed, sample_count);
+}
+
+} // Anonymous namespace
+
+MixKernelIsa GetHostMixKernelIsa() {
+#if defined(ARCHITECTURE_x86_64)
+    static const MixKernelIsa isa = [] {
+        const auto& caps = Common::GetCPUCaps();
+        if (caps.avx2) {
+            return MixKernelIsa::AVX2;
+        }
+        if (caps.sse4_1) {
+            return MixKernelIsa::SSE41;
+        }
+        return MixKernelIsa::Scalar;
+    }();
+    return isa;
+#elif defined(ARCHITECTURE_arm64)
+    return MixKernelIsa::NEON;
+#else
+    return MixKernelIsa::Scalar;
+#endif
+}
+
+bool IsMixKernelIsaSupported(MixKernelIsa isa) {
+    switch (isa) {
+    case MixKernelIsa::Scalar:
+        return true;
+#if defined(ARCHITECTURE_x86_64)
+    case MixKernelIsa::SSE41:
+        return Common::GetCPUCaps().sse4_1;
+    case MixKernelIsa::AVX2:
+        return Common::GetCPUCaps().avx2;
+#elif defined(ARCHITECTURE_arm64)
+    case MixKernelIsa::NEON:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+template <size_t Q>
+s32 MixKernel(std::span<s32> output, std::span<const s32> input, f32 volume, f32 ramp,
+              u32 sample_count, MixKernelIsa isa) {
+    if (sample_count == 0) {
+        return 0;
+    }
+    // Read the last input before mixing, the input and output may be the same buffer
+    const s32 last_input{input[sample_count - 1]};
+    const auto last_volume{Fixed<Q>::from_base(
+        Fixed<Q>{volume}.to_raw() + static_cast<s64>(sample_count - 1) * Fixed<Q>{ramp}.to_raw())};
+    ApplyKernel<Q, true>(output, input, volume, ramp, sample_count, isa);
+    return (last_input * last_volume).to_int();
+}
+
+template <size_t Q>
+void GainKernel(std::span<s32> output, std::span<const s32> input, f32 volume, f32 ramp,
+                u32 sample_count, MixKernelIsa isa) {
+    ApplyKernel<Q, false>(output, input, volume, ramp, sample_count, isa);
+}
+
+template s32 MixKernel<15>(std::span<s32>, std::span<const s32>, f32, f32, u32, MixKernelIsa);
+template s32 MixKernel<23>(std::span<s32>, std::span<const s32>, f32, f32, u32, MixKernelIsa);
+template void GainKernel<15>(std::span<s32>, std::span<const s32>, f32, f32, u32, MixKernelIsa);
+template void GainKernel<23>(std::span<s32>, std::span<const s32>, f32, f32, u32, MixKernelIsa);
+
+} // namespace AudioCore::Renderer
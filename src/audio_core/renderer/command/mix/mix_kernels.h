@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <span>
+
+#include "common/common_types.h"
+
+namespace AudioCore::Renderer {
+
+/// Instruction sets the mix buffer kernels can run with.
+enum class MixKernelIsa : u8 {
+    Scalar,
+    SSE41,
+    AVX2,
+    NEON,
+};
+
+/**
+ * Get the fastest kernel instruction set supported by the host, detected once.
+ *
+ * @return The instruction set used by default.
+ */
+MixKernelIsa GetHostMixKernelIsa();
+
+/**
+ * Check if the host can run kernels with the given instruction set.
+ *
+ * @param isa - Instruction set to check.
+ * @return True if supported, otherwise false.
+ */
+bool IsMixKernelIsaSupported(MixKernelIsa isa);
+
+/**
+ * Mix input mix buffer into output mix buffer, with a ramped volume applied to the input.
+ * All instruction sets produce the same result as the Common::FixedPoint implementation.
+ *
+ * @tparam Q           - Number of bits for fixed point operations.
+ * @param output       - Output mix buffer.
+ * @param input        - Input mix buffer, may be the same as output.
+ * @param volume       - Volume applied to the input.
+ * @param ramp         - Ramp applied to volume every sample.
+ * @param sample_count - Number of samples to process.
+ * @param isa          - Instruction set to use.
+ * @return The final gained input sample, used for depopping.
+ */
+template <size_t Q>
+s32 MixKernel(std::span<s32> output, std::span<const s32> input, f32 volume, f32 ramp,
+              u32 sample_count, MixKernelIsa isa = GetHostMixKernelIsa());
+
+/**
+ * Apply a ramped volume to the input mix buffer, saving to the output mix buffer.
+ * All instruction sets produce the same result as the Common::FixedPoint implementation.
+ *
+ * @tparam Q           - Number of bits for fixed point operations.
+ * @param output       - Output mix buffer.
+ * @param input        - Input mix buffer, may be the same as output.
+ * @param volume       - Volume applied to the input.
+ * @param ramp         - Ramp applied to volume every sample.
+ * @param sample_count - Number of samples to process.
+ * @param isa          - Instruction set to use.
+ */
+template <size_t Q>
+void GainKernel(std::span<s32> output, std::span<const s32> input, f32 volume, f32 ramp,
+                u32 sample_count, MixKernelIsa isa = GetHostMixKernelIsa());
+
+} // namespace AudioCore::Renderer
@@ -1,10 +1,169 @@
 // SPDX-FileCopyrightText: Copyright 2022 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#if defined(ARCHITECTURE_x86_64)
+#include <immintrin.h>
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
 #include "audio_core/renderer/command/resample/resample.h"
 
+#if defined(ARCHITECTURE_x86_64) && !defined(_MSC_VER)
+#define RESAMPLE_TARGET(isa) __attribute__((target(isa)))
+#else
+#define RESAMPLE_TARGET(isa)
+#endif
+
 namespace AudioCore::Renderer {
 
+/*
+ * The filter LUTs are laid out per phase, with the Taps coefficients of a phase next to each
+ * other. Every output sample is then a dot product of Taps contiguous input samples with one
+ * contiguous LUT row, so the vector filters load both directly without any gather. Each tap is
+ * computed as in the scalar code: the float product input * lut is converted to Q8 with
+ * truncation, so the results are identical.
+ */
+
+#if defined(ARCHITECTURE_x86_64)
+/// Multiply the 4 samples in the low half of samples with their coefficients, in Q8.
+RESAMPLE_TARGET("sse4.1")
+static __m128i MultiplyTapsSSE41(__m128i samples, const f32* coefficients) {
+    const __m128 products{
+        _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi16_epi32(samples)), _mm_loadu_ps(coefficients))};
+    return _mm_cvttps_epi32(_mm_mul_ps(products, _mm_set1_ps(256.0f)));
+}
+
+/// Compute the Q8 taps of one output sample, partially summed into 4 lanes.
+template <size_t Taps>
+RESAMPLE_TARGET("sse4.1")
+static __m128i FilterTapsSSE41(const s16* input, const f32* lut) {
+    if constexpr (Taps == 4) {
+        return MultiplyTapsSSE41(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input)), lut);
+    } else {
+        const __m128i samples{_mm_loadu_si128(reinterpret_cast<const __m128i*>(input))};
+        return _mm_add_epi32(MultiplyTapsSSE41(samples, lut),
+                             MultiplyTapsSSE41(_mm_srli_si128(samples, 8), lut + 4));
+    }
+}
+
+/// Filter 4 output samples at a time, returning how many were written.
+template <size_t Taps>
+RESAMPLE_TARGET("sse4.1")
+static u32 FilterSSE41(s32* output, const s16* input, const f32* lut,
+                       const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                       Common::FixedPoint<49, 15>& fraction, u32& read_index,
+                       const u32 samples_to_write) {
+    u32 i{0};
+    for (; i + 4 <= samples_to_write; i += 4) {
+        __m128i sums[4];
+        for (u32 j = 0; j < 4; j++) {
+            const auto lut_index{(fraction.get_frac() >> 8) * Taps};
+            sums[j] = FilterTapsSSE41<Taps>(input + read_index, lut + lut_index);
+            fraction += sample_rate_ratio;
+            read_index += static_cast<u32>(fraction.to_int_floor());
+            fraction.clear_int();
+        }
+        const __m128i totals{_mm_hadd_epi32(_mm_hadd_epi32(sums[0], sums[1]),
+                                            _mm_hadd_epi32(sums[2], sums[3]))};
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i), _mm_srai_epi32(totals, 8));
+    }
+    return i;
+}
+#elif defined(ARCHITECTURE_arm64)
+/// Multiply 4 samples with their coefficients, in Q8.
+static int32x4_t MultiplyTapsNEON(int16x4_t samples, const f32* coefficients) {
+    const float32x4_t products{
+        vmulq_f32(vcvtq_f32_s32(vmovl_s16(samples)), vld1q_f32(coefficients))};
+    return vcvtq_s32_f32(vmulq_n_f32(products, 256.0f));
+}
+
+/// Compute the Q8 taps of one output sample, partially summed into 4 lanes.
+template <size_t Taps>
+static int32x4_t FilterTapsNEON(const s16* input, const f32* lut) {
+    if constexpr (Taps == 4) {
+        return MultiplyTapsNEON(vld1_s16(input), lut);
+    } else {
+        const int16x8_t samples{vld1q_s16(input)};
+        return vaddq_s32(MultiplyTapsNEON(vget_low_s16(samples), lut),
+                         MultiplyTapsNEON(vget_high_s16(samples), lut + 4));
+    }
+}
+
+/// Filter 4 output samples at a time, returning how many were written.
+template <size_t Taps>
+static u32 FilterNEON(s32* output, const s16* input, const f32* lut,
+                      const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                      Common::FixedPoint<49, 15>& fraction, u32& read_index,
+                      const u32 samples_to_write) {
+    u32 i{0};
+    for (; i + 4 <= samples_to_write; i += 4) {
+        int32x4_t sums[4];
+        for (u32 j = 0; j < 4; j++) {
+            const auto lut_index{(fraction.get_frac() >> 8) * Taps};
+            sums[j] = FilterTapsNEON<Taps>(input + read_index, lut + lut_index);
+            fraction += sample_rate_ratio;
+            read_index += static_cast<u32>(fraction.to_int_floor());
+            fraction.clear_int();
+        }
+        const int32x4_t totals{
+            vpaddq_s32(vpaddq_s32(sums[0], sums[1]), vpaddq_s32(sums[2], sums[3]))};
+        vst1q_s32(output + i, vshrq_n_s32(totals, 8));
+    }
+    return i;
+}
+#endif
+
+/**
+ * Apply a polyphase filter to the input buffer, with the phase taken from the read fraction.
+ *
+ * @tparam Taps             - Number of input samples used for each output sample.
+ * @param output            - Output buffer.
+ * @param input             - Input buffer.
+ * @param lut               - Filter coefficients, Taps per phase for 128 phases.
+ * @param sample_rate_ratio - Ratio for resampling.
+ * @param fraction          - Current read fraction.
+ * @param samples_to_write  - Number of samples to write.
+ * @param isa               - Instruction set to use.
+ */
+template <size_t Taps>
+static void ApplyPolyphaseFilter(std::span<s32> output, std::span<const s16> input,
+                                 std::span<const f32> lut,
+                                 const Common::FixedPoint<49, 15>& sample_rate_ratio,
+                                 Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write,
+                                 const MixKernelIsa isa) {
+    u32 read_index{0};
+    u32 written{0};
+    switch (isa) {
+#if defined(ARCHITECTURE_x86_64)
+    case MixKernelIsa::SSE41:
+    case MixKernelIsa::AVX2:
+        written = FilterSSE41<Taps>(output.data(), input.data(), lut.data(), sample_rate_ratio,
+                                    fraction, read_index, samples_to_write);
+        break;
+#elif defined(ARCHITECTURE_arm64)
+    case MixKernelIsa::NEON:
+        written = FilterNEON<Taps>(output.data(), input.data(), lut.data(), sample_rate_ratio,
+                                   fraction, read_index, samples_to_write);
+        break;
+#endif
+    default:
+        break;
+    }
+
+    for (u32 i = written; i < samples_to_write; i++) {
+        const auto lut_index{(fraction.get_frac() >> 8) * Taps};
+        Common::FixedPoint<56, 8> sum{0};
+        for (size_t tap = 0; tap < Taps; tap++) {
+            sum += Common::FixedPoint<56, 8>{input[read_index + tap] * lut[lut_index + tap]};
+        }
+        output[i] = sum.to_int_floor();
+        fraction += sample_rate_ratio;
+        read_index += static_cast<u32>(fraction.to_int_floor());
+        fraction.clear_int();
+    }
+}
+
 static void ResampleLowQuality(std::span<s32> output, std::span<const s16> input,
                                const Common::FixedPoint<49, 15>& sample_rate_ratio,
                                Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write) {
@@ -26,7 +185,7 @@ static void ResampleLowQuality(std::span<s32> output, std::span<const s16> input
 static void ResampleNormalQuality(std::span<s32> output, std::span<const s16> input,
                                   const Common::FixedPoint<49, 15>& sample_rate_ratio,
                                   Common::FixedPoint<49, 15>& fraction,
-                                  const u32 samples_to_write) {
+                                  const u32 samples_to_write, const MixKernelIsa isa) {
     static constexpr std::array<f32, 512> lut0 = {
         0.20141602f, 0.59283447f, 0.20513916f, 0.00009155f, 0.19772339f, 0.59277344f, 0.20889282f,
         0.00027466f, 0.19406128f, 0.59262085f, 0.21264648f, 0.00045776f, 0.19039917f, 0.59240723f,
@@ -292,24 +451,14 @@ static void ResampleNormalQuality(std::span<s32> output, std::span<const s16> in
         }
     };
 
-    auto lut{get_lut()};
-    u32 read_index{0};
-    for (u32 i = 0; i < samples_to_write; i++) {
-        const auto lut_index{(fraction.get_frac() >> 8) * 4};
-        const Common::FixedPoint<56, 8> sample0{input[read_index + 0] * lut[lut_index + 0]};
-        const Common::FixedPoint<56, 8> sample1{input[read_index + 1] * lut[lut_index + 1]};
-        const Common::FixedPoint<56, 8> sample2{input[read_index + 2] * lut[lut_index + 2]};
-        const Common::FixedPoint<56, 8> sample3{input[read_index + 3] * lut[lut_index + 3]};
-        output[i] = (sample0 + sample1 + sample2 + sample3).to_int_floor();
-        fraction += sample_rate_ratio;
-        read_index += static_cast<u32>(fraction.to_int_floor());
-        fraction.clear_int();
-    }
+    ApplyPolyphaseFilter<4>(output, input, get_lut(), sample_rate_ratio, fraction,
+                            samples_to_write, isa);
 }
 
 static void ResampleHighQuality(std::span<s32> output, std::span<const s16> input,
                                 const Common::FixedPoint<49, 15>& sample_rate_ratio,
-                                Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write) {
+                                Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write,
+                                const MixKernelIsa isa) {
     static constexpr std::array<f32, 1024> lut0 = {
         -0.01776123f, -0.00070190f, 0.26672363f,  0.50006104f,  0.26956177f,  0.00024414f,
         -0.01800537f, 0.00000000f,  -0.01748657f, -0.00164795f, 0.26388550f,  0.50003052f,
@@ -842,40 +991,24 @@ static void ResampleHighQuality(std::span<s32> output, std::span<const s16> inpu
         }
     };
 
-    auto lut{get_lut()};
-    u32 read_index{0};
-    for (u32 i = 0; i < samples_to_write; i++) {
-        const auto lut_index{(fraction.get_frac() >> 8) * 8};
-        const Common::FixedPoint<56, 8> sample0{input[read_index + 0] * lut[lut_index + 0]};
-        const Common::FixedPoint<56, 8> sample1{input[read_index + 1] * lut[lut_index + 1]};
-        const Common::FixedPoint<56, 8> sample2{input[read_index + 2] * lut[lut_index + 2]};
-        const Common::FixedPoint<56, 8> sample3{input[read_index + 3] * lut[lut_index + 3]};
-        const Common::FixedPoint<56, 8> sample4{input[read_index + 4] * lut[lut_index + 4]};
-        const Common::FixedPoint<56, 8> sample5{input[read_index + 5] * lut[lut_index + 5]};
-        const Common::FixedPoint<56, 8> sample6{input[read_index + 6] * lut[lut_index + 6]};
-        const Common::FixedPoint<56, 8> sample7{input[read_index + 7] * lut[lut_index + 7]};
-        output[i] = (sample0 + sample1 + sample2 + sample3 + sample4 + sample5 + sample6 + sample7)
-                        .to_int_floor();
-        fraction += sample_rate_ratio;
-        read_index += static_cast<u32>(fraction.to_int_floor());
-        fraction.clear_int();
-    }
+    ApplyPolyphaseFilter<8>(output, input, get_lut(), sample_rate_ratio, fraction,
+                            samples_to_write, isa);
 }
 
 void Resample(std::span<s32> output, std::span<const s16> input,
               const Common::FixedPoint<49, 15>& sample_rate_ratio,
               Common::FixedPoint<49, 15>& fraction, const u32 samples_to_write,
-              const SrcQuality src_quality) {
+              const SrcQuality src_quality, const MixKernelIsa isa) {
 
     switch (src_quality) {
     case SrcQuality::Low:
         ResampleLowQuality(output, input, sample_rate_ratio, fraction, samples_to_write);
         break;
     case SrcQuality::Medium:
-        ResampleNormalQuality(output, input, sample_rate_ratio, fraction, samples_to_write);
+        ResampleNormalQuality(output, input, sample_rate_ratio, fraction, samples_to_write, isa);
         break;
     case SrcQuality::High:
-        ResampleHighQuality(output, input, sample_rate_ratio, fraction, samples_to_write);
+        ResampleHighQuality(output, input, sample_rate_ratio, fraction, samples_to_write, isa);
         break;
     }
 }
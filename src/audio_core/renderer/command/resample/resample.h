@@ -6,6 +6,7 @@
 #include <span>
 
 #include "audio_core/common/common.h"
+#include "audio_core/renderer/command/mix/mix_kernels.h"
 #include "common/common_types.h"
 #include "common/fixed_point.h"
 
@@ -21,9 +22,11 @@ namespace AudioCore::Renderer {
  *                            multiple calls.
  * @param samples_to_write  - Number of samples to write.
  * @param src_quality       - Resampling quality.
+ * @param isa               - Instruction set used by the filters, output is the same for all.
  */
 void Resample(std::span<s32> output, std::span<const s16> input,
               const Common::FixedPoint<49, 15>& sample_rate_ratio,
-              Common::FixedPoint<49, 15>& fraction, u32 samples_to_write, SrcQuality src_quality);
+              Common::FixedPoint<49, 15>& fraction, u32 samples_to_write, SrcQuality src_quality,
+              MixKernelIsa isa = GetHostMixKernelIsa());
 
 } // namespace AudioCore::Renderer
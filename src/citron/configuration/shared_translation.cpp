@@ -71,6 +71,9 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
               "faster or not.\n200% for a 30 FPS game is 60 FPS, and for a "
               "60 FPS game it will be 120 FPS.\nDisabling it means unlocking the framerate to the "
               "maximum your PC can reach."));
+    INSERT(Settings, nca_block_cache_size, tr("Game data cache (MiB)"),
+           tr("Keeps recently read game data decrypted in memory, so reading it again skips "
+              "decryption and verification.\nSet it to 0 to disable the cache."));
 
     // Cpu
     INSERT(Settings, cpu_accuracy, tr("Accuracy:"),
@@ -207,6 +210,9 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
            tr("Enables GPU vendor-specific pipeline cache.\nThis option can improve shader loading "
               "time significantly in cases where the Vulkan driver does not store pipeline cache "
               "files internally."));
+    INSERT(Settings, use_shader_output_cache, tr("Cache recompiled shaders (Vulkan only)"),
+           tr("Stores the shaders translated for the host GPU on disk.\nThis option skips shader "
+              "recompilation when loading the pipeline cache on later boots."));
     INSERT(
         Settings, enable_compute_pipelines, tr("Enable Compute Pipelines (Intel Vulkan Only)"),
         tr("Enable compute pipelines, required by some games.\nThis setting only exists for Intel "
@@ -221,6 +227,11 @@ std::unique_ptr<TranslationMap> InitializeTranslations(QWidget* parent) {
               "unlocked."));
     INSERT(Settings, barrier_feedback_loops, tr("Barrier feedback loops"),
            tr("Improves rendering of transparency effects in specific games."));
+    INSERT(Settings, use_transcode_disk_cache, QStringLiteral(), QStringLiteral());
+    INSERT(Settings, transcode_disk_cache_size, tr("Decoded texture disk cache (MiB)"),
+           tr("Stores textures decoded on the CPU (ASTC and BCn) on disk so they don't have to be "
+              "decoded again on following boots.\n"
+              "Old entries are removed once the cache grows past this size."));
 
     // Renderer (Debug)
 
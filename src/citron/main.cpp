@@ -1042,9 +1042,13 @@ void GMainWindow::InitializeWidgets() {
     emu_frametime_label->setToolTip(
         tr("Time taken to emulate a Switch frame, not counting framelimiting or v-sync. For "
            "full-speed emulation this should be at most 16.67 ms."));
+    nca_cache_label = new QLabel();
+    nca_cache_label->setToolTip(
+        tr("Share of the game data reads served from the decrypted NCA block cache. It keeps its "
+           "last value while the game doesn't read any data."));
 
     for (auto& label : {shader_building_label, res_scale_label, emu_speed_label, game_fps_label,
-                        emu_frametime_label}) {
+                        emu_frametime_label, nca_cache_label}) {
         label->setVisible(false);
         label->setFrameStyle(QFrame::NoFrame);
         label->setContentsMargins(4, 0, 4, 0);
@@ -2182,6 +2186,8 @@ void GMainWindow::OnEmulationStopped() {
     emu_speed_label->setVisible(false);
     game_fps_label->setVisible(false);
     emu_frametime_label->setVisible(false);
+    nca_cache_label->setVisible(false);
+    nca_cache_label->clear();
     renderer_status_button->setEnabled(!UISettings::values.has_broken_vulkan);
 
     if (!firmware_label->text().isEmpty()) {
@@ -4651,11 +4657,17 @@ void GMainWindow::UpdateStatusBar() {
             tr("Game: %1 FPS").arg(std::round(results.average_game_fps), 0, 'f', 0));
     }
     emu_frametime_label->setText(tr("Frame: %1 ms").arg(results.frametime * 1000.0, 0, 'f', 2));
+    // The hit rate is negative when no game data was read since the last update
+    if (results.nca_cache_hit_rate >= 0) {
+        nca_cache_label->setText(
+            tr("NCA cache: %1%").arg(results.nca_cache_hit_rate * 100.0, 0, 'f', 0));
+    }
 
     res_scale_label->setVisible(true);
     emu_speed_label->setVisible(!Settings::values.use_multi_core.GetValue());
     game_fps_label->setVisible(true);
     emu_frametime_label->setVisible(true);
+    nca_cache_label->setVisible(!nca_cache_label->text().isEmpty());
     firmware_label->setVisible(false);
 }
 
@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <condition_variable>
 #include <cstddef>
+#include <memory>
 #include <mutex>
 #include <new>
 
@@ -70,23 +73,36 @@ private:
         Count,
     };
 
+    // Each side keeps a cached copy of the other side's index and only reloads it when the queue
+    // looks full or empty. Pushed elements are published right away, popped slots are released to
+    // the producer in batches since it only looks at them once the queue is full. Locks are only
+    // taken when a side has to sleep, the waiting flags tell the other side whether it has to wake
+    // it up. The flags and the indices are accessed with sequentially consistent ordering so a
+    // side can't miss the other one going to sleep.
+
     template <PushMode Mode, typename... Args>
     bool Emplace(Args&&... args) {
         const size_t write_index = m_write_index.load(std::memory_order::relaxed);
 
-        if constexpr (Mode == PushMode::Try) {
-            // Check if we have free slots to write to.
-            if ((write_index - m_read_index.load(std::memory_order::acquire)) == Capacity) {
+        if (write_index - m_cached_read_index == Capacity) {
+            m_cached_read_index = m_read_index.load(std::memory_order::acquire);
+        }
+        if (write_index - m_cached_read_index == Capacity) {
+            if constexpr (Mode == PushMode::Try) {
+                // There are no free slots to write to.
                 return false;
+            } else if constexpr (Mode == PushMode::Wait) {
+                // Wait until we have free slots to write to.
+                std::unique_lock lock{producer_cv_mutex};
+                m_producer_waiting.store(true);
+                producer_cv.wait(lock, [this, write_index] {
+                    m_cached_read_index = m_read_index.load();
+                    return (write_index - m_cached_read_index) < Capacity;
+                });
+                m_producer_waiting.store(false, std::memory_order::relaxed);
+            } else {
+                static_assert(Mode < PushMode::Count, "Invalid PushMode.");
             }
-        } else if constexpr (Mode == PushMode::Wait) {
-            // Wait until we have free slots to write to.
-            std::unique_lock lock{producer_cv_mutex};
-            producer_cv.wait(lock, [this, write_index] {
-                return (write_index - m_read_index.load(std::memory_order::acquire)) < Capacity;
-            });
-        } else {
-            static_assert(Mode < PushMode::Count, "Invalid PushMode.");
         }
 
         // Determine the position to write to.
@@ -95,42 +111,54 @@ private:
         // Emplace into the queue.
         std::construct_at(std::addressof(m_data[pos]), std::forward<Args>(args)...);
 
-        // Increment the write index.
-        ++m_write_index;
+        // Publish the element.
+        m_write_index.store(write_index + 1);
 
-        // Notify the consumer that we have pushed into the queue.
-        std::scoped_lock lock{consumer_cv_mutex};
-        consumer_cv.notify_one();
+        // Notify the consumer if it is waiting for us to push into the queue.
+        if (m_consumer_waiting.load()) {
+            std::scoped_lock lock{consumer_cv_mutex};
+            consumer_cv.notify_one();
+        }
 
         return true;
     }
 
     template <PopMode Mode>
     bool Pop(T& t, [[maybe_unused]] std::stop_token stop_token = {}) {
-        const size_t read_index = m_read_index.load(std::memory_order::relaxed);
+        const size_t read_index = m_consumer_read_index;
 
-        if constexpr (Mode == PopMode::Try) {
-            // Check if the queue is empty.
-            if (read_index == m_write_index.load(std::memory_order::acquire)) {
-                return false;
-            }
-        } else if constexpr (Mode == PopMode::Wait) {
-            // Wait until the queue is not empty.
-            std::unique_lock lock{consumer_cv_mutex};
-            consumer_cv.wait(lock, [this, read_index] {
-                return read_index != m_write_index.load(std::memory_order::acquire);
-            });
-        } else if constexpr (Mode == PopMode::WaitWithStopToken) {
-            // Wait until the queue is not empty.
-            std::unique_lock lock{consumer_cv_mutex};
-            Common::CondvarWait(consumer_cv, lock, stop_token, [this, read_index] {
-                return read_index != m_write_index.load(std::memory_order::acquire);
-            });
-            if (stop_token.stop_requested()) {
+        if (read_index == m_cached_write_index) {
+            m_cached_write_index = m_write_index.load(std::memory_order::acquire);
+        }
+        if (read_index == m_cached_write_index) {
+            // Release the slots popped so far before going idle.
+            ReleaseSlots();
+
+            [[maybe_unused]] const auto has_data = [this, read_index] {
+                m_cached_write_index = m_write_index.load();
+                return read_index != m_cached_write_index;
+            };
+            if constexpr (Mode == PopMode::Try) {
+                // The queue is empty.
                 return false;
+            } else if constexpr (Mode == PopMode::Wait) {
+                // Wait until the queue is not empty.
+                std::unique_lock lock{consumer_cv_mutex};
+                m_consumer_waiting.store(true);
+                consumer_cv.wait(lock, has_data);
+                m_consumer_waiting.store(false, std::memory_order::relaxed);
+            } else if constexpr (Mode == PopMode::WaitWithStopToken) {
+                // Wait until the queue is not empty.
+                std::unique_lock lock{consumer_cv_mutex};
+                m_consumer_waiting.store(true);
+                Common::CondvarWait(consumer_cv, lock, stop_token, has_data);
+                m_consumer_waiting.store(false, std::memory_order::relaxed);
+                if (stop_token.stop_requested()) {
+                    return false;
+                }
+            } else {
+                static_assert(Mode < PopMode::Count, "Invalid PopMode.");
             }
-        } else {
-            static_assert(Mode < PopMode::Count, "Invalid PopMode.");
         }
 
         // Determine the position to read from.
@@ -139,20 +167,46 @@ private:
         // Pop the data off the queue, moving it.
         t = std::move(m_data[pos]);
 
-        // Increment the read index.
-        ++m_read_index;
-
-        // Notify the producer that we have popped off the queue.
-        std::scoped_lock lock{producer_cv_mutex};
-        producer_cv.notify_one();
+        // Release the slot once a batch is complete or the producer is waiting for it.
+        m_consumer_read_index = read_index + 1;
+        if (m_consumer_read_index - m_read_index.load(std::memory_order::relaxed) >=
+                ReleaseBatchSize ||
+            m_producer_waiting.load()) {
+            ReleaseSlots();
+        }
 
         return true;
     }
 
+    void ReleaseSlots() {
+        // Publish the popped slots.
+        m_read_index.store(m_consumer_read_index);
+
+        // Notify the producer if it is waiting for us to pop off the queue.
+        if (m_producer_waiting.load()) {
+            std::scoped_lock lock{producer_cv_mutex};
+            producer_cv.notify_one();
+        }
+    }
+
+    // Holding back at most a 64th of the slots keeps small queues releasing every slot.
+    static constexpr size_t ReleaseBatchSize = std::max<size_t>(Capacity / 64, 1);
+
+    // Consumer side, m_consumer_read_index and m_cached_write_index are only accessed by the
+    // consumer. m_read_index lags behind m_consumer_read_index until the popped slots are released.
     alignas(128) std::atomic_size_t m_read_index{0};
+    size_t m_consumer_read_index{0};
+    size_t m_cached_write_index{0};
+
+    // Producer side, m_cached_read_index is only accessed by the producer.
     alignas(128) std::atomic_size_t m_write_index{0};
+    size_t m_cached_read_index{0};
+
+    // Rarely written, kept away from the indices so polling them doesn't bounce their lines.
+    alignas(128) std::atomic_bool m_consumer_waiting{false};
+    std::atomic_bool m_producer_waiting{false};
 
-    std::array<T, Capacity> m_data;
+    alignas(128) std::array<T, Capacity> m_data;
 
     std::condition_variable_any producer_cv;
     std::mutex producer_cv_mutex;
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <utility>
+
+#include "common/fs/mapped_file.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef ANDROID
+#include "common/fs/fs_android.h"
+#endif
+
+namespace Common::FS {
+
+namespace {
+
+#ifdef _WIN32
+
+std::span<const u8> MapFile(const std::filesystem::path& path) {
+    const HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE,
+                                    nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return {};
+    }
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        return {};
+    }
+    const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        return {};
+    }
+    // The view keeps the mapping object alive on its own
+    void* const view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (view == nullptr) {
+        return {};
+    }
+    return {static_cast<const u8*>(view), static_cast<size_t>(file_size.QuadPart)};
+}
+
+void UnmapFile(std::span<const u8> span) {
+    UnmapViewOfFile(span.data());
+}
+
+#else
+
+int OpenFile(const std::filesystem::path& path) {
+#ifdef ANDROID
+    if (Android::IsContentUri(path)) {
+        return Android::OpenContentUri(path, Android::OpenMode::Read);
+    }
+#endif
+    return open(path.c_str(), O_RDONLY);
+}
+
+std::span<const u8> MapFile(const std::filesystem::path& path) {
+    const int fd = OpenFile(path);
+    if (fd == -1) {
+        return {};
+    }
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+        close(fd);
+        return {};
+    }
+    const size_t file_size = static_cast<size_t>(file_stat.st_size);
+    // The mapping keeps its own reference to the file
+    void* const view = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) {
+        return {};
+    }
+    return {static_cast<const u8*>(view), file_size};
+}
+
+void UnmapFile(std::span<const u8> span) {
+    munmap(const_cast<u8*>(span.data()), span.size());
+}
+
+#endif
+
+} // Anonymous namespace
+
+MappedFile::MappedFile() = default;
+
+MappedFile::MappedFile(const std::filesystem::path& path) {
+    Open(path);
+}
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    std::swap(data, other.data);
+    std::swap(size, other.size);
+    std::swap(is_open, other.is_open);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    std::swap(data, other.data);
+    std::swap(size, other.size);
+    std::swap(is_open, other.is_open);
+    return *this;
+}
+
+void MappedFile::Open(const std::filesystem::path& path) {
+    Close();
+
+    std::error_code ec;
+    const auto file_size = std::filesystem::file_size(path, ec);
+    if (!ec && file_size == 0) {
+        is_open = true;
+        return;
+    }
+
+    const std::span<const u8> span = MapFile(path);
+    if (span.empty()) {
+        LOG_ERROR(Common_Filesystem, "Failed to map the file at path={}",
+                  PathToUTF8String(path));
+        return;
+    }
+    data = span.data();
+    size = span.size();
+    is_open = true;
+}
+
+void MappedFile::Close() {
+    if (data != nullptr) {
+        UnmapFile(GetSpan());
+    }
+    data = nullptr;
+    size = 0;
+    is_open = false;
+}
+
+} // namespace Common::FS
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <span>
+
+#include "common/common_types.h"
+
+namespace Common::FS {
+
+/**
+ * Read-only memory mapping of a whole file.
+ * Reads through the mapping don't need any locking and the mapping stays valid for the lifetime of
+ * the object, even if the file is deleted or replaced on disk in the meantime.
+ */
+class MappedFile {
+public:
+    MappedFile();
+
+    explicit MappedFile(const std::filesystem::path& path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * Maps the file at path, unmapping any previously mapped file.
+     * Empty files are considered open and map to an empty span.
+     *
+     * @param path Filesystem path
+     */
+    void Open(const std::filesystem::path& path);
+
+    /// Unmaps the file if it is mapped.
+    void Close();
+
+    /**
+     * Checks whether the file is mapped.
+     *
+     * @returns True if the file is mapped, false otherwise.
+     */
+    [[nodiscard]] bool IsOpen() const {
+        return is_open;
+    }
+
+    /// Returns the mapped contents of the file.
+    [[nodiscard]] std::span<const u8> GetSpan() const {
+        return {data, size};
+    }
+
+    /// Returns the size of the mapped file in bytes.
+    [[nodiscard]] size_t GetSize() const {
+        return size;
+    }
+
+private:
+    const u8* data{};
+    size_t size{};
+    bool is_open{};
+};
+
+} // namespace Common::FS
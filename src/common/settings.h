@@ -211,6 +211,14 @@ struct Values {
                                              true,
                                              true,
                                              &use_speed_limit};
+    // Memory budget of the decrypted NCA block cache in MiB, 0 disables it
+    Setting<u16, true> nca_block_cache_size{linkage,
+                                            256,
+                                            0,
+                                            4096,
+                                            "nca_block_cache_size",
+                                            Category::Core,
+                                            Specialization::Countable};
 
     // Cpu
     SwitchableSetting<CpuBackend, true> cpu_backend{linkage,
@@ -420,12 +428,26 @@ struct Values {
                                                              Specialization::Default,
                                                              true,
                                                              true};
+    SwitchableSetting<bool> use_shader_output_cache{linkage, true, "use_shader_output_cache",
+                                                    Category::RendererAdvanced};
     SwitchableSetting<bool> enable_compute_pipelines{linkage, false, "enable_compute_pipelines",
                                                      Category::RendererAdvanced};
     SwitchableSetting<bool> use_video_framerate{linkage, false, "use_video_framerate",
                                                 Category::RendererAdvanced};
     SwitchableSetting<bool> barrier_feedback_loops{linkage, true, "barrier_feedback_loops",
                                                    Category::RendererAdvanced};
+    Setting<bool> use_transcode_disk_cache{linkage, false, "use_transcode_disk_cache",
+                                           Category::RendererAdvanced, Specialization::Paired};
+    Setting<u16, true> transcode_disk_cache_size{linkage,
+                                                 2048,
+                                                 64,
+                                                 32768,
+                                                 "transcode_disk_cache_size",
+                                                 Category::RendererAdvanced,
+                                                 Specialization::Countable,
+                                                 true,
+                                                 false,
+                                                 &use_transcode_disk_cache};
 
     Setting<bool> renderer_debug{linkage, false, "debug", Category::RendererDebug};
     Setting<bool> renderer_shader_feedback{linkage, false, "shader_feedback",
@@ -579,6 +601,8 @@ struct Values {
     Setting<std::string> program_args{linkage, std::string(), "program_args", Category::Debugging};
     Setting<bool> dump_exefs{linkage, false, "dump_exefs", Category::Debugging};
     Setting<bool> dump_nso{linkage, false, "dump_nso", Category::Debugging};
+    Setting<bool> verify_nso_hashes{linkage, false, "verify_nso_hashes", Category::Debugging};
+    Setting<bool> record_svc_stats{linkage, false, "record_svc_stats", Category::Debugging};
     Setting<bool> dump_shaders{
         linkage, false, "dump_shaders", Category::DebuggingGraphics, Specialization::Default,
         false};
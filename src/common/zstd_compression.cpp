@@ -46,4 +46,22 @@ std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed) {
     return decompressed;
 }
 
+std::size_t DecompressDataZSTD(std::span<const u8> compressed, std::span<u8> output) {
+    const std::size_t decompressed_size =
+        ZSTD_getFrameContentSize(compressed.data(), compressed.size());
+    if (decompressed_size == ZSTD_CONTENTSIZE_UNKNOWN ||
+        decompressed_size == ZSTD_CONTENTSIZE_ERROR || decompressed_size > output.size()) {
+        return 0;
+    }
+
+    const std::size_t uncompressed_result_size =
+        ZSTD_decompress(output.data(), output.size(), compressed.data(), compressed.size());
+
+    if (decompressed_size != uncompressed_result_size || ZSTD_isError(uncompressed_result_size)) {
+        // Decompression failed
+        return 0;
+    }
+    return uncompressed_result_size;
+}
+
 } // namespace Common::Compression
@@ -42,4 +42,14 @@ namespace Common::Compression {
  */
 [[nodiscard]] std::vector<u8> DecompressDataZSTD(std::span<const u8> compressed);
 
+/**
+ * Decompresses a source memory region with Zstandard into a caller provided buffer.
+ *
+ * @param compressed the compressed source memory region.
+ * @param output     the destination buffer, it must be large enough for the uncompressed data.
+ *
+ * @return the size of the decompressed data, or zero on failure.
+ */
+[[nodiscard]] std::size_t DecompressDataZSTD(std::span<const u8> compressed, std::span<u8> output);
+
 } // namespace Common::Compression
@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include "common/arm64/native_clock.h"
 #include "common/bit_cast.h"
 #include "common/literals.h"
@@ -38,10 +40,9 @@ Patcher::Patcher() : c(m_patch_instructions) {
 
 Patcher::~Patcher() = default;
 
-bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
+bool Patcher::PatchText(std::span<const u8> program_image, size_t image_size,
                         const Kernel::CodeSet::Segment& code) {
     // If we have patched modules but cannot reach the new module, then it needs its own patcher.
-    const size_t image_size = program_image.size();
     if (total_program_size + image_size > MaxRelativeBranch && total_program_size > 0) {
         return false;
     }
@@ -54,8 +55,10 @@ bool Patcher::PatchText(const Kernel::PhysicalMemory& program_image,
     // module.
     curr_patch->m_branch_to_module_relocations.push_back({0, 0});
 
-    // Retrieve text segment data.
-    const auto text = std::span{program_image}.subspan(code.offset, code.size);
+    // Retrieve text segment data. The image may end before the page aligned text, the rest is zero
+    // filled and has nothing to patch.
+    const auto text = program_image.subspan(
+        code.offset, std::min<size_t>(code.size, program_image.size() - code.offset));
     const auto text_words =
         std::span<const u32>{reinterpret_cast<const u32*>(text.data()), text.size() / sizeof(u32)};
 
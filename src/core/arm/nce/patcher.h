@@ -31,7 +31,7 @@ public:
     explicit Patcher();
     ~Patcher();
 
-    bool PatchText(const Kernel::PhysicalMemory& program_image,
+    bool PatchText(std::span<const u8> program_image, size_t image_size,
                    const Kernel::CodeSet::Segment& code);
     bool RelocateAndCopy(Common::ProcessAddress load_base, const Kernel::CodeSet::Segment& code,
                          Kernel::PhysicalMemory& program_image, EntryTrampolines* out_trampolines);
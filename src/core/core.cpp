@@ -20,11 +20,13 @@
 #include "core/debugger/debugger.h"
 #include "core/device_memory.h"
 #include "core/file_sys/fs_filesystem.h"
+#include "core/file_sys/fssystem/fssystem_block_cache.h"
 #include "core/file_sys/patch_manager.h"
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/romfs_factory.h"
 #include "core/file_sys/savedata_factory.h"
 #include "core/file_sys/vfs/vfs_concat.h"
+#include "core/file_sys/vfs/vfs_copy_stats.h"
 #include "core/file_sys/vfs/vfs_real.h"
 #include "core/gpu_dirty_memory_manager.h"
 #include "core/hle/kernel/k_memory_manager.h"
@@ -374,6 +376,10 @@ struct System::Impl {
             }
         }
 
+        // Apply the cache budget, it may have changed since the cache was created
+        auto& block_cache = FileSys::BlockCache::GetInstance();
+        block_cache.SetCapacity(FileSys::BlockCache::GetConfiguredCapacity());
+
         perf_stats = std::make_unique<PerfStats>(params.program_id);
         // Reset counters and set time origin to current frame
         GetAndResetPerfStats();
@@ -414,6 +420,7 @@ struct System::Impl {
                                         perf_results.frametime * 1000.0);
             telemetry_session->AddField(performance, "Mean_Frametime_MS",
                                         perf_stats->GetMeanFrametime());
+            FileSys::LogCopyStats();
         }
 
         is_powered_on = false;
@@ -5,6 +5,8 @@
 #include <mutex>
 #include <string>
 #include <tuple>
+#include <utility>
+#include <vector>
 
 #ifdef _WIN32
 #include "common/windows/timer_resolution.h"
@@ -31,7 +33,6 @@ struct CoreTiming::Event {
     u64 fifo_order;
     std::weak_ptr<EventType> type;
     s64 reschedule_time;
-    heap_t::handle_type handle{};
 
     // Sort by time, unless the times are the same, in which case sort by
     // the order added to the queue
@@ -44,6 +45,69 @@ struct CoreTiming::Event {
     }
 };
 
+namespace {
+/// Number of children of each node of the event heap. A wider heap is shallower, which keeps
+/// sifting within a few cache lines for the number of events usually pending.
+constexpr size_t HEAP_ARITY = 4;
+
+template <typename T>
+void SiftUp(std::vector<T>& heap, size_t index) {
+    T value = std::move(heap[index]);
+    while (index > 0) {
+        const size_t parent = (index - 1) / HEAP_ARITY;
+        if (!(value < heap[parent])) {
+            break;
+        }
+        heap[index] = std::move(heap[parent]);
+        index = parent;
+    }
+    heap[index] = std::move(value);
+}
+
+template <typename T>
+void SiftDown(std::vector<T>& heap, size_t index) {
+    const size_t size = heap.size();
+    T value = std::move(heap[index]);
+    while (true) {
+        const size_t first_child = index * HEAP_ARITY + 1;
+        if (first_child >= size) {
+            break;
+        }
+        const size_t last_child = std::min(first_child + HEAP_ARITY, size);
+        size_t min_child = first_child;
+        for (size_t child = first_child + 1; child < last_child; ++child) {
+            if (heap[child] < heap[min_child]) {
+                min_child = child;
+            }
+        }
+        if (!(heap[min_child] < value)) {
+            break;
+        }
+        heap[index] = std::move(heap[min_child]);
+        index = min_child;
+    }
+    heap[index] = std::move(value);
+}
+
+/// Removes the element at index from the heap and returns it.
+template <typename T>
+T HeapErase(std::vector<T>& heap, size_t index) {
+    T value = std::move(heap[index]);
+    if (index + 1 == heap.size()) {
+        heap.pop_back();
+        return value;
+    }
+    heap[index] = std::move(heap.back());
+    heap.pop_back();
+    if (index > 0 && heap[index] < heap[(index - 1) / HEAP_ARITY]) {
+        SiftUp(heap, index);
+    } else {
+        SiftDown(heap, index);
+    }
+    return value;
+}
+} // Anonymous namespace
+
 CoreTiming::CoreTiming() : clock{Common::CreateOptimalClock()} {}
 
 CoreTiming::~CoreTiming() {
@@ -121,8 +185,7 @@ void CoreTiming::ScheduleEvent(std::chrono::nanoseconds ns_into_future,
         std::scoped_lock scope{basic_lock};
         const auto next_time{absolute_time ? ns_into_future : GetGlobalTimeNs() + ns_into_future};
 
-        auto h{event_queue.emplace(Event{next_time.count(), event_fifo_id++, event_type, 0})};
-        (*h).handle = h;
+        PushEvent(Event{next_time.count(), event_fifo_id++, event_type, 0});
     }
 
     event.Set();
@@ -136,9 +199,7 @@ void CoreTiming::ScheduleLoopingEvent(std::chrono::nanoseconds start_time,
         std::scoped_lock scope{basic_lock};
         const auto next_time{absolute_time ? start_time : GetGlobalTimeNs() + start_time};
 
-        auto h{event_queue.emplace(
-            Event{next_time.count(), event_fifo_id++, event_type, resched_time.count()})};
-        (*h).handle = h;
+        PushEvent(Event{next_time.count(), event_fifo_id++, event_type, resched_time.count()});
     }
 
     event.Set();
@@ -149,16 +210,13 @@ void CoreTiming::UnscheduleEvent(const std::shared_ptr<EventType>& event_type,
     {
         std::scoped_lock lk{basic_lock};
 
-        std::vector<heap_t::handle_type> to_remove;
-        for (auto itr = event_queue.begin(); itr != event_queue.end(); itr++) {
-            const Event& e = *itr;
-            if (e.type.lock().get() == event_type.get()) {
-                to_remove.push_back(itr->handle);
-            }
-        }
-
-        for (auto& h : to_remove) {
-            event_queue.erase(h);
+        // Compare owners instead of locking every pending event
+        const auto is_event_type = [&event_type](const Event& e) {
+            return !e.type.owner_before(event_type) && !event_type.owner_before(e.type);
+        };
+        for (auto it = std::ranges::find_if(event_queue, is_event_type); it != event_queue.end();
+             it = std::ranges::find_if(event_queue, is_event_type)) {
+            HeapErase(event_queue, static_cast<size_t>(it - event_queue.begin()));
         }
 
         event_type->sequence_number++;
@@ -201,35 +259,23 @@ std::optional<s64> CoreTiming::Advance() {
     std::scoped_lock lock{advance_lock, basic_lock};
     global_timer = GetGlobalTimeNs().count();
 
-    while (!event_queue.empty() && event_queue.top().time <= global_timer) {
-        const Event& evt = event_queue.top();
+    while (!event_queue.empty() && event_queue.front().time <= global_timer) {
+        // The event leaves the queue while its callback runs, looping events are pushed back
+        // afterwards unless they were unscheduled in the meantime.
+        const Event evt = PopEvent();
 
         if (const auto event_type{evt.type.lock()}) {
             const auto evt_time = evt.time;
             const auto evt_sequence_num = event_type->sequence_number;
 
-            if (evt.reschedule_time == 0) {
-                event_queue.pop();
-
-                basic_lock.unlock();
-
-                event_type->callback(
-                    evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time});
-
-                basic_lock.lock();
-            } else {
-                basic_lock.unlock();
-
-                const auto new_schedule_time{event_type->callback(
-                    evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time})};
+            basic_lock.unlock();
 
-                basic_lock.lock();
+            const auto new_schedule_time{event_type->callback(
+                evt_time, std::chrono::nanoseconds{GetGlobalTimeNs().count() - evt_time})};
 
-                if (evt_sequence_num != event_type->sequence_number) {
-                    // Heap handle is invalidated after external modification.
-                    continue;
-                }
+            basic_lock.lock();
 
+            if (evt.reschedule_time != 0 && evt_sequence_num == event_type->sequence_number) {
                 const auto next_schedule_time{new_schedule_time.has_value()
                                                   ? new_schedule_time.value().count()
                                                   : evt.reschedule_time};
@@ -241,8 +287,7 @@ std::optional<s64> CoreTiming::Advance() {
                     next_time = pause_end_time + next_schedule_time;
                 }
 
-                event_queue.update(evt.handle, Event{next_time, event_fifo_id++, evt.type,
-                                                     next_schedule_time, evt.handle});
+                PushEvent(Event{next_time, event_fifo_id++, evt.type, next_schedule_time});
             }
         }
 
@@ -250,7 +295,7 @@ std::optional<s64> CoreTiming::Advance() {
     }
 
     if (!event_queue.empty()) {
-        return event_queue.top().time;
+        return event_queue.front().time;
     } else {
         return std::nullopt;
     }
@@ -301,6 +346,15 @@ void CoreTiming::ThreadLoop() {
     }
 }
 
+void CoreTiming::PushEvent(Event&& new_event) {
+    event_queue.push_back(std::move(new_event));
+    SiftUp(event_queue, event_queue.size() - 1);
+}
+
+CoreTiming::Event CoreTiming::PopEvent() {
+    return HeapErase(event_queue, 0);
+}
+
 void CoreTiming::Reset() {
     paused = true;
     shutting_down = true;
@@ -11,8 +11,7 @@
 #include <optional>
 #include <string>
 #include <thread>
-
-#include <boost/heap/fibonacci_heap.hpp>
+#include <vector>
 
 #include "common/common_types.h"
 #include "common/thread.h"
@@ -146,6 +145,12 @@ private:
 
     void Reset();
 
+    /// Adds an event to the event queue.
+    void PushEvent(Event&& new_event);
+
+    /// Removes the earliest event from the event queue and returns it.
+    Event PopEvent();
+
     std::unique_ptr<Common::WallClock> clock;
 
     s64 global_timer = 0;
@@ -154,10 +159,8 @@ private:
     s64 timer_resolution_ns;
 #endif
 
-    using heap_t =
-        boost::heap::fibonacci_heap<CoreTiming::Event, boost::heap::compare<std::greater<>>>;
-
-    heap_t event_queue;
+    /// Pending events, stored as an implicit 4-ary min-heap ordered by time and fifo order.
+    std::vector<Event> event_queue;
     u64 event_fifo_id = 0;
 
     Common::Event event{};
@@ -24,6 +24,8 @@
 #include "core/hle/kernel/k_page_table.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/k_thread.h"
+#include "core/hle/kernel/kernel.h"
+#include "core/hle/kernel/svc_stats.h"
 #include "core/loader/loader.h"
 #include "core/memory.h"
 
@@ -616,7 +618,8 @@ void GDBStub::HandleRcmd(const std::vector<u8>& command) {
     const char* commands = "Commands:\n"
                            "  get fastmem\n"
                            "  get info\n"
-                           "  get mappings\n";
+                           "  get mappings\n"
+                           "  get svcstats\n";
 
     if (command_str == "get fastmem") {
         if (Settings::IsFastmemEnabled()) {
@@ -699,6 +702,12 @@ void GDBStub::HandleRcmd(const std::vector<u8>& command) {
 
             cur_addr = next_address;
         }
+    } else if (command_str == "get svcstats") {
+        if (auto* stats = system.Kernel().GetSvcStats(); stats != nullptr) {
+            reply = stats->GetReport();
+        } else {
+            reply = "SVC statistics are not enabled.\n";
+        }
     } else if (command_str == "help") {
         reply = commands;
     } else {
@@ -2,10 +2,18 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <cstring>
+#include <deque>
+#include <mutex>
 #include <span>
 #include <string_view>
 #include "common/alignment.h"
 #include "common/assert.h"
+#include "common/common_funcs.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/fs_util.h"
+#include "common/fs/mapped_file.h"
+#include "common/logging/log.h"
 #include "core/file_sys/fsmitm_romfsbuild.h"
 #include "core/file_sys/ips_layer.h"
 #include "core/file_sys/vfs/vfs.h"
@@ -60,10 +68,10 @@ struct RomFSBuildDirectoryContext {
     u32 cur_path_ofs = 0;
     u32 path_len = 0;
     u32 entry_offset = 0;
-    std::shared_ptr<RomFSBuildDirectoryContext> parent;
-    std::shared_ptr<RomFSBuildDirectoryContext> child;
-    std::shared_ptr<RomFSBuildDirectoryContext> sibling;
-    std::shared_ptr<RomFSBuildFileContext> file;
+    RomFSBuildDirectoryContext* parent = nullptr;
+    RomFSBuildDirectoryContext* child = nullptr;
+    RomFSBuildDirectoryContext* sibling = nullptr;
+    RomFSBuildFileContext* file = nullptr;
 };
 
 struct RomFSBuildFileContext {
@@ -73,11 +81,114 @@ struct RomFSBuildFileContext {
     u32 entry_offset = 0;
     u64 offset = 0;
     u64 size = 0;
-    std::shared_ptr<RomFSBuildDirectoryContext> parent;
-    std::shared_ptr<RomFSBuildFileContext> sibling;
+    RomFSBuildDirectoryContext* parent = nullptr;
+    RomFSBuildFileContext* sibling = nullptr;
     VirtualFile source;
 };
 
+// Contexts are allocated in chunks and never move, so they can point to each other.
+struct RomFSBuildArena {
+    std::deque<RomFSBuildDirectoryContext> directories;
+    std::deque<RomFSBuildFileContext> files;
+};
+
+constexpr u32 ROMFS_LAYOUT_MAGIC = Common::MakeMagic('R', 'F', 'S', 'L');
+constexpr u32 ROMFS_LAYOUT_VERSION = 1;
+
+// Followed by the RomFS metadata and the file entries.
+struct RomFSLayoutHeader {
+    u32 magic;
+    u32 version;
+    u64 key;
+    u64 num_files;
+    u64 metadata_size;
+    RomFSHeader romfs_header;
+};
+static_assert(sizeof(RomFSLayoutHeader) == 0x70, "RomFSLayoutHeader has incorrect size.");
+
+// Followed by the path of the file.
+struct RomFSLayoutFileEntry {
+    u64 offset;
+    u64 size;
+    u64 path_size;
+};
+static_assert(sizeof(RomFSLayoutFileEntry) == 0x18, "RomFSLayoutFileEntry has incorrect size.");
+
+// A file of a RomFS opened from a saved layout, looked up in the layered directories and patched
+// the same way as when the layout was built, on the first read.
+class RomFSLayoutFile final : public VfsFile {
+public:
+    RomFSLayoutFile(VirtualDir base_, VirtualDir ext_, std::string path_, u64 size_)
+        : base{std::move(base_)}, ext{std::move(ext_)}, path{std::move(path_)}, size{size_} {}
+
+    std::string GetName() const override {
+        return path.substr(path.rfind('/') + 1);
+    }
+
+    std::size_t GetSize() const override {
+        return size;
+    }
+
+    bool Resize(std::size_t new_size) override {
+        return false;
+    }
+
+    VirtualDir GetContainingDirectory() const override {
+        return nullptr;
+    }
+
+    bool IsWritable() const override {
+        return false;
+    }
+
+    bool IsReadable() const override {
+        return true;
+    }
+
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override {
+        const auto& file = GetSource();
+        return file != nullptr ? file->Read(data, length, offset) : 0;
+    }
+
+    std::span<const u8> ReadView(std::size_t length, std::size_t offset) const override {
+        const auto& file = GetSource();
+        return file != nullptr ? file->ReadView(length, offset) : std::span<const u8>{};
+    }
+
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override {
+        return 0;
+    }
+
+    bool Rename(std::string_view name) override {
+        return false;
+    }
+
+private:
+    const VirtualFile& GetSource() const {
+        std::call_once(source_flag, [this] {
+            source = base->GetFileRelative(path);
+            if (source == nullptr) {
+                LOG_ERROR(Loader, "LayeredFS file {} is missing", path);
+                return;
+            }
+            if (const auto ips = ext != nullptr ? ext->GetFileRelative(path + ".ips") : nullptr) {
+                if (auto patched = PatchIPS(source, ips)) {
+                    source = std::move(patched);
+                }
+            }
+        });
+        return source;
+    }
+
+    VirtualDir base;
+    VirtualDir ext;
+    std::string path;
+    u64 size;
+
+    mutable std::once_flag source_flag;
+    mutable VirtualFile source;
+};
+
 static u32 romfs_calc_path_hash(u32 parent, std::string_view path, u32 start,
                                 std::size_t path_len) {
     u32 hash = parent ^ 123456789;
@@ -106,17 +217,68 @@ static u64 romfs_get_hash_table_count(u64 num_entries) {
     return count;
 }
 
+static void SaveLayout(const std::filesystem::path& layout_path, u64 layout_key,
+                       const RomFSHeader& header, std::span<const u8> metadata,
+                       std::span<const RomFSBuildFileContext* const> files) {
+    const RomFSLayoutHeader layout_header{
+        .magic = ROMFS_LAYOUT_MAGIC,
+        .version = ROMFS_LAYOUT_VERSION,
+        .key = layout_key,
+        .num_files = files.size(),
+        .metadata_size = metadata.size(),
+        .romfs_header = header,
+    };
+
+    std::vector<u8> entries;
+    for (const auto* const cur_file : files) {
+        const RomFSLayoutFileEntry entry{
+            .offset = cur_file->offset + ROMFS_FILEPARTITION_OFS,
+            .size = cur_file->size,
+            .path_size = cur_file->path.size(),
+        };
+        const auto* const entry_data = reinterpret_cast<const u8*>(&entry);
+        entries.insert(entries.end(), entry_data, entry_data + sizeof(entry));
+        entries.insert(entries.end(), cur_file->path.begin(), cur_file->path.end());
+    }
+
+    // Write to a temporary file first, so a crash can't leave a partial layout behind.
+    auto temp_path = layout_path;
+    temp_path += ".tmp";
+    if (!Common::FS::CreateParentDirs(temp_path)) {
+        return;
+    }
+    {
+        Common::FS::IOFile file(temp_path, Common::FS::FileAccessMode::Write,
+                                Common::FS::FileType::BinaryFile);
+        if (!file.IsOpen() || !file.WriteObject(layout_header) ||
+            file.WriteSpan(metadata) != metadata.size() ||
+            file.WriteSpan<u8>(entries) != entries.size()) {
+            LOG_WARNING(Loader, "Failed to write LayeredFS layout {}",
+                        Common::FS::PathToUTF8String(temp_path));
+            return;
+        }
+    }
+    if (Common::FS::IsFile(layout_path) && !Common::FS::RemoveFile(layout_path)) {
+        return;
+    }
+    if (!Common::FS::RenameFile(temp_path, layout_path)) {
+        LOG_WARNING(Loader, "Failed to save LayeredFS layout {}",
+                    Common::FS::PathToUTF8String(layout_path));
+    }
+}
+
 void RomFSBuildContext::VisitDirectory(VirtualDir romfs_dir, VirtualDir ext_dir,
-                                       std::shared_ptr<RomFSBuildDirectoryContext> parent) {
+                                       RomFSBuildDirectoryContext* parent) {
     for (auto& child_romfs_file : romfs_dir->GetFiles()) {
         const auto name = child_romfs_file->GetName();
-        const auto child = std::make_shared<RomFSBuildFileContext>();
+        auto* const child = &arena->files.emplace_back();
         // Set child's path.
         child->cur_path_ofs = parent->path_len + 1;
         child->path_len = child->cur_path_ofs + static_cast<u32>(name.size());
         child->path = parent->path + "/" + name;
 
         if (ext_dir != nullptr && ext_dir->GetFile(name + ".stub") != nullptr) {
+            arena->files.pop_back();
             continue;
         }
 
@@ -135,18 +297,19 @@ void RomFSBuildContext::VisitDirectory(VirtualDir romfs_dir, VirtualDir ext_dir,
 
         child->size = child->source->GetSize();
 
-        AddFile(parent, std::move(child));
+        AddFile(parent, child);
     }
 
     for (auto& child_romfs_dir : romfs_dir->GetSubdirectories()) {
         const auto name = child_romfs_dir->GetName();
-        const auto child = std::make_shared<RomFSBuildDirectoryContext>();
+        auto* const child = &arena->directories.emplace_back();
         // Set child's path.
         child->cur_path_ofs = parent->path_len + 1;
         child->path_len = child->cur_path_ofs + static_cast<u32>(name.size());
         child->path = parent->path + "/" + name;
 
         if (ext_dir != nullptr && ext_dir->GetFile(name + ".stub") != nullptr) {
+            arena->directories.pop_back();
             continue;
         }
 
@@ -162,33 +325,33 @@ void RomFSBuildContext::VisitDirectory(VirtualDir romfs_dir, VirtualDir ext_dir,
     }
 }
 
-bool RomFSBuildContext::AddDirectory(std::shared_ptr<RomFSBuildDirectoryContext> parent_dir_ctx,
-                                     std::shared_ptr<RomFSBuildDirectoryContext> dir_ctx) {
+bool RomFSBuildContext::AddDirectory(RomFSBuildDirectoryContext* parent_dir_ctx,
+                                     RomFSBuildDirectoryContext* dir_ctx) {
     // Add a new directory.
     num_dirs++;
     dir_table_size +=
         sizeof(RomFSDirectoryEntry) + Common::AlignUp(dir_ctx->path_len - dir_ctx->cur_path_ofs, 4);
-    dir_ctx->parent = std::move(parent_dir_ctx);
-    directories.emplace_back(std::move(dir_ctx));
+    dir_ctx->parent = parent_dir_ctx;
+    directories.emplace_back(dir_ctx);
 
     return true;
 }
 
-bool RomFSBuildContext::AddFile(std::shared_ptr<RomFSBuildDirectoryContext> parent_dir_ctx,
-                                std::shared_ptr<RomFSBuildFileContext> file_ctx) {
+bool RomFSBuildContext::AddFile(RomFSBuildDirectoryContext* parent_dir_ctx,
+                                RomFSBuildFileContext* file_ctx) {
     // Add a new file.
     num_files++;
     file_table_size +=
         sizeof(RomFSFileEntry) + Common::AlignUp(file_ctx->path_len - file_ctx->cur_path_ofs, 4);
-    file_ctx->parent = std::move(parent_dir_ctx);
-    files.emplace_back(std::move(file_ctx));
+    file_ctx->parent = parent_dir_ctx;
+    files.emplace_back(file_ctx);
 
     return true;
 }
 
 RomFSBuildContext::RomFSBuildContext(VirtualDir base_, VirtualDir ext_)
-    : base(std::move(base_)), ext(std::move(ext_)) {
-    root = std::make_shared<RomFSBuildDirectoryContext>();
+    : base(std::move(base_)), ext(std::move(ext_)), arena(std::make_unique<RomFSBuildArena>()) {
+    root = &arena->directories.emplace_back();
     root->path = "\0";
     directories.emplace_back(root);
     num_dirs = 1;
@@ -199,7 +362,8 @@ RomFSBuildContext::RomFSBuildContext(VirtualDir base_, VirtualDir ext_)
 
 RomFSBuildContext::~RomFSBuildContext() = default;
 
-std::vector<std::pair<u64, VirtualFile>> RomFSBuildContext::Build() {
+std::vector<std::pair<u64, VirtualFile>> RomFSBuildContext::Build(
+    const std::filesystem::path& layout_path, u64 layout_key) {
     const u64 dir_hash_table_entry_count = romfs_get_hash_table_count(num_dirs);
     const u64 file_hash_table_entry_count = romfs_get_hash_table_count(num_files);
     dir_hash_table_size = 4 * dir_hash_table_entry_count;
@@ -234,8 +398,7 @@ std::vector<std::pair<u64, VirtualFile>> RomFSBuildContext::Build() {
 
     // Determine file offsets.
     u32 entry_offset = 0;
-    std::shared_ptr<RomFSBuildFileContext> prev_file = nullptr;
-    for (const auto& cur_file : files) {
+    for (auto* const cur_file : files) {
         file_partition_size = Common::AlignUp(file_partition_size, 16);
         cur_file->offset = file_partition_size;
         file_partition_size += cur_file->size;
@@ -243,11 +406,10 @@ std::vector<std::pair<u64, VirtualFile>> RomFSBuildContext::Build() {
         entry_offset +=
             static_cast<u32>(sizeof(RomFSFileEntry) +
                              Common::AlignUp(cur_file->path_len - cur_file->cur_path_ofs, 4));
-        prev_file = cur_file;
     }
     // Assign deferred parent/sibling ownership.
     for (auto it = files.rbegin(); it != files.rend(); ++it) {
-        auto& cur_file = *it;
+        auto* const cur_file = *it;
         cur_file->sibling = cur_file->parent->file;
         cur_file->parent->file = cur_file;
     }
@@ -262,7 +424,7 @@ std::vector<std::pair<u64, VirtualFile>> RomFSBuildContext::Build() {
     }
     // Assign deferred parent/sibling ownership.
     for (auto it = directories.rbegin(); (*it) != root; ++it) {
-        auto& cur_dir = *it;
+        auto* const cur_dir = *it;
         cur_dir->sibling = cur_dir->parent->child;
         cur_dir->parent->child = cur_dir;
     }
@@ -340,6 +502,10 @@ std::vector<std::pair<u64, VirtualFile>> RomFSBuildContext::Build() {
                     cur_dir->path.data() + cur_dir->cur_path_ofs, name_size);
     }
 
+    if (!layout_path.empty()) {
+        SaveLayout(layout_path, layout_key, header, metadata, files);
+    }
+
     // Write metadata.
     out.emplace_back(header.dir_hash_table_ofs,
                      std::make_shared<VectorVfsFile>(std::move(metadata)));
@@ -351,4 +517,62 @@ std::vector<std::pair<u64, VirtualFile>> RomFSBuildContext::Build() {
     return out;
 }
 
+std::optional<std::vector<std::pair<u64, VirtualFile>>> RomFSBuildContext::LoadLayout(
+    const std::filesystem::path& layout_path, u64 layout_key, VirtualDir base, VirtualDir ext) {
+    if (!Common::FS::IsFile(layout_path)) {
+        return std::nullopt;
+    }
+    const Common::FS::MappedFile layout_file(layout_path);
+    const std::span<const u8> data = layout_file.GetSpan();
+
+    RomFSLayoutHeader layout_header;
+    if (data.size() < sizeof(layout_header)) {
+        return std::nullopt;
+    }
+    std::memcpy(&layout_header, data.data(), sizeof(layout_header));
+    if (layout_header.magic != ROMFS_LAYOUT_MAGIC ||
+        layout_header.version != ROMFS_LAYOUT_VERSION || layout_header.key != layout_key ||
+        data.size() - sizeof(layout_header) < layout_header.metadata_size) {
+        return std::nullopt;
+    }
+    // Every file entry takes at least its fixed size, so the count can't be more than what fits
+    const size_t entries_size = data.size() - sizeof(layout_header) - layout_header.metadata_size;
+    if (layout_header.num_files > entries_size / sizeof(RomFSLayoutFileEntry)) {
+        return std::nullopt;
+    }
+
+    std::vector<std::pair<u64, VirtualFile>> out;
+    out.reserve(layout_header.num_files + 2);
+
+    std::vector<u8> header_data(sizeof(RomFSHeader));
+    std::memcpy(header_data.data(), &layout_header.romfs_header, header_data.size());
+    out.emplace_back(0, std::make_shared<VectorVfsFile>(std::move(header_data)));
+
+    size_t offset = sizeof(layout_header);
+    std::vector<u8> metadata(data.begin() + offset,
+                             data.begin() + offset + layout_header.metadata_size);
+    offset += layout_header.metadata_size;
+
+    for (u64 i = 0; i < layout_header.num_files; ++i) {
+        RomFSLayoutFileEntry entry;
+        if (data.size() - offset < sizeof(entry)) {
+            return std::nullopt;
+        }
+        std::memcpy(&entry, data.data() + offset, sizeof(entry));
+        offset += sizeof(entry);
+        if (data.size() - offset < entry.path_size) {
+            return std::nullopt;
+        }
+
+        std::string path(reinterpret_cast<const char*>(data.data()) + offset, entry.path_size);
+        offset += entry.path_size;
+        out.emplace_back(entry.offset, std::make_shared<RomFSLayoutFile>(base, ext, std::move(path),
+                                                                         entry.size));
+    }
+
+    out.emplace_back(layout_header.romfs_header.dir_hash_table_ofs,
+                     std::make_shared<VectorVfsFile>(std::move(metadata)));
+    return out;
+}
+
 } // namespace FileSys
@@ -3,14 +3,17 @@
 
 #pragma once
 
+#include <filesystem>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include "common/common_types.h"
 #include "core/file_sys/vfs/vfs.h"
 
 namespace FileSys {
 
+struct RomFSBuildArena;
 struct RomFSBuildDirectoryContext;
 struct RomFSBuildFileContext;
 struct RomFSDirectoryEntry;
@@ -21,15 +24,25 @@ public:
     explicit RomFSBuildContext(VirtualDir base, VirtualDir ext = nullptr);
     ~RomFSBuildContext();
 
-    // This finalizes the context.
-    std::vector<std::pair<u64, VirtualFile>> Build();
+    // This finalizes the context. If layout_path is not empty, the layout of the RomFS is saved
+    // there along with layout_key.
+    std::vector<std::pair<u64, VirtualFile>> Build(const std::filesystem::path& layout_path = {},
+                                                   u64 layout_key = 0);
+
+    // Opens a RomFS from a layout saved with the same key, without visiting base and ext. The data
+    // of each file is only looked up in them when it is first read.
+    static std::optional<std::vector<std::pair<u64, VirtualFile>>> LoadLayout(
+        const std::filesystem::path& layout_path, u64 layout_key, VirtualDir base,
+        VirtualDir ext = nullptr);
 
 private:
     VirtualDir base;
     VirtualDir ext;
-    std::shared_ptr<RomFSBuildDirectoryContext> root;
-    std::vector<std::shared_ptr<RomFSBuildDirectoryContext>> directories;
-    std::vector<std::shared_ptr<RomFSBuildFileContext>> files;
+    // Owns the contexts, which only point to each other.
+    std::unique_ptr<RomFSBuildArena> arena;
+    RomFSBuildDirectoryContext* root;
+    std::vector<RomFSBuildDirectoryContext*> directories;
+    std::vector<RomFSBuildFileContext*> files;
     u64 num_dirs = 0;
     u64 num_files = 0;
     u64 dir_table_size = 0;
@@ -39,12 +52,11 @@ private:
     u64 file_partition_size = 0;
 
     void VisitDirectory(VirtualDir filesys, VirtualDir ext_dir,
-                        std::shared_ptr<RomFSBuildDirectoryContext> parent);
+                        RomFSBuildDirectoryContext* parent);
 
-    bool AddDirectory(std::shared_ptr<RomFSBuildDirectoryContext> parent_dir_ctx,
-                      std::shared_ptr<RomFSBuildDirectoryContext> dir_ctx);
-    bool AddFile(std::shared_ptr<RomFSBuildDirectoryContext> parent_dir_ctx,
-                 std::shared_ptr<RomFSBuildFileContext> file_ctx);
+    bool AddDirectory(RomFSBuildDirectoryContext* parent_dir_ctx,
+                      RomFSBuildDirectoryContext* dir_ctx);
+    bool AddFile(RomFSBuildDirectoryContext* parent_dir_ctx, RomFSBuildFileContext* file_ctx);
 };
 
 } // namespace FileSys
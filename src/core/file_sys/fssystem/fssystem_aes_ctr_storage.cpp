@@ -4,8 +4,10 @@
 #include "common/alignment.h"
 #include "common/swap.h"
 #include "core/file_sys/fssystem/fssystem_aes_ctr_storage.h"
+#include "core/file_sys/fssystem/fssystem_crypto_pipeline.h"
 #include "core/file_sys/fssystem/fssystem_pooled_buffer.h"
 #include "core/file_sys/fssystem/fssystem_utility.h"
+#include "core/file_sys/vfs/vfs_copy_stats.h"
 
 namespace FileSys {
 
@@ -48,6 +50,13 @@ size_t AesCtrStorage::Read(u8* buffer, size_t size, size_t offset) const {
     ASSERT(Common::IsAligned(offset, BlockSize));
     ASSERT(Common::IsAligned(size, BlockSize));
 
+    RecordCopy(CopyLayer::Decrypt, size);
+
+    // Large reads are decrypted on the crypto workers, chunk by chunk as they are read.
+    if (CryptoPipeline::IsEnabled(size)) {
+        return this->ReadPipelined(buffer, size, offset);
+    }
+
     // Read the data.
     m_base_storage->Read(buffer, size, offset);
 
@@ -63,6 +72,32 @@ size_t AesCtrStorage::Read(u8* buffer, size_t size, size_t offset) const {
     return size;
 }
 
+size_t AesCtrStorage::ReadPipelined(u8* buffer, size_t size, size_t offset) const {
+    CryptoPipeline pipeline;
+    for (size_t cur_offset = 0; cur_offset < size; cur_offset += CryptoPipelineChunkSize) {
+        const size_t cur_size = std::min(CryptoPipelineChunkSize, size - cur_offset);
+        u8* const cur_buffer = buffer + cur_offset;
+
+        // Read the chunk, while the workers decrypt the previous ones.
+        m_base_storage->Read(cur_buffer, cur_size, offset + cur_offset);
+
+        // Setup the counter.
+        std::array<u8, IvSize> ctr;
+        std::memcpy(ctr.data(), m_iv.data(), IvSize);
+        AddCounter(ctr.data(), IvSize, (offset + cur_offset) / BlockSize);
+
+        // Decrypt with a cipher of its own, as chunks are decrypted concurrently.
+        pipeline.Submit([key = m_key, ctr, cur_buffer, cur_size] {
+            Core::Crypto::AESCipher<Core::Crypto::Key128> cipher(key, Core::Crypto::Mode::CTR);
+            cipher.SetIV(ctr);
+            cipher.Transcode(cur_buffer, cur_size, cur_buffer, Core::Crypto::Op::Decrypt);
+        });
+    }
+    pipeline.Wait();
+
+    return size;
+}
+
 size_t AesCtrStorage::Write(const u8* buffer, size_t size, size_t offset) {
     // Allow zero-size writes.
     if (size == 0) {
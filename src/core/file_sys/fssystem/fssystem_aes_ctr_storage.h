@@ -33,6 +33,9 @@ public:
     virtual size_t Write(const u8* buffer, size_t size, size_t offset) override;
     virtual size_t GetSize() const override;
 
+private:
+    size_t ReadPipelined(u8* buffer, size_t size, size_t offset) const;
+
 private:
     VirtualFile m_base_storage;
     std::array<u8, KeySize> m_key;
@@ -2,11 +2,14 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "common/alignment.h"
+#include "common/div_ceil.h"
 #include "common/swap.h"
 #include "core/file_sys/errors.h"
 #include "core/file_sys/fssystem/fssystem_aes_xts_storage.h"
+#include "core/file_sys/fssystem/fssystem_crypto_pipeline.h"
 #include "core/file_sys/fssystem/fssystem_pooled_buffer.h"
 #include "core/file_sys/fssystem/fssystem_utility.h"
+#include "core/file_sys/vfs/vfs_copy_stats.h"
 
 namespace FileSys {
 
@@ -53,6 +56,7 @@ size_t AesXtsStorage::Read(u8* buffer, size_t size, size_t offset) const {
 
     // Read the data.
     m_base_storage->Read(buffer, size, offset);
+    RecordCopy(CopyLayer::Decrypt, size);
 
     // Setup the counter.
     std::array<u8, IvSize> ctr;
@@ -90,6 +94,32 @@ size_t AesXtsStorage::Read(u8* buffer, size_t size, size_t offset) const {
     // Decrypt aligned chunks.
     char* cur = reinterpret_cast<char*>(buffer) + processed_size;
     size_t remaining = size - processed_size;
+
+    // Large reads are decrypted on the crypto workers, each job handling whole blocks.
+    if (CryptoPipeline::IsEnabled(remaining)) {
+        const size_t job_size = Common::AlignUp(CryptoPipelineChunkSize, m_block_size);
+        CryptoPipeline pipeline;
+        while (remaining > 0) {
+            const size_t cur_size = std::min(job_size, remaining);
+            pipeline.Submit([key = m_key, ctr, cur, cur_size, block_size = m_block_size]() mutable {
+                Core::Crypto::AESCipher<Core::Crypto::Key256> cipher(key,
+                                                                     Core::Crypto::Mode::XTS);
+                for (size_t done = 0; done < cur_size; done += block_size) {
+                    cipher.SetIV(ctr);
+                    cipher.Transcode(cur + done, std::min(block_size, cur_size - done),
+                                     cur + done, Core::Crypto::Op::Decrypt);
+                    AddCounter(ctr.data(), IvSize, 1);
+                }
+            });
+
+            remaining -= cur_size;
+            cur += cur_size;
+            AddCounter(ctr.data(), IvSize, Common::DivCeil(cur_size, m_block_size));
+        }
+        pipeline.Wait();
+        return size;
+    }
+
     while (remaining > 0) {
         const size_t cur_size = std::min(m_block_size, remaining);
 
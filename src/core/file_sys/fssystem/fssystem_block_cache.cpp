@@ -0,0 +1,157 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/alignment.h"
+#include "common/scratch_buffer.h"
+#include "common/settings.h"
+#include "core/file_sys/fssystem/fssystem_block_cache.h"
+
+namespace FileSys {
+
+BlockCache::BlockCache(size_t capacity) {
+    this->SetCapacity(capacity);
+}
+
+BlockCache::~BlockCache() = default;
+
+BlockCache& BlockCache::GetInstance() {
+    static BlockCache cache(GetConfiguredCapacity());
+    return cache;
+}
+
+size_t BlockCache::GetConfiguredCapacity() {
+    return size_t{Settings::values.nca_block_cache_size.GetValue()} * 1_MiB;
+}
+
+void BlockCache::SetCapacity(size_t capacity) {
+    m_capacity.store(capacity, std::memory_order_relaxed);
+    for (Shard& shard : m_shards) {
+        std::scoped_lock lk{shard.mutex};
+        shard.capacity_blocks = capacity / ShardCount / BlockCacheBlockSize;
+        while (shard.blocks.size() > shard.capacity_blocks) {
+            shard.map.erase(shard.blocks.back().key);
+            shard.blocks.pop_back();
+        }
+    }
+}
+
+bool BlockCache::Read(u64 storage_id, u64 block_index, u8* buffer, size_t offset, size_t size) {
+    const Key key{storage_id, block_index};
+    Shard& shard = GetShard(key);
+    {
+        std::scoped_lock lk{shard.mutex};
+        if (const auto it = shard.map.find(key); it != shard.map.end()) {
+            const auto block = it->second;
+            if (offset + size <= block->size) {
+                shard.blocks.splice(shard.blocks.begin(), shard.blocks, block);
+                std::memcpy(buffer, block->data.get() + offset, size);
+                m_hits.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+    }
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+void BlockCache::Insert(u64 storage_id, u64 block_index, const u8* data, size_t size) {
+    ASSERT(size <= BlockCacheBlockSize);
+
+    const Key key{storage_id, block_index};
+    Shard& shard = GetShard(key);
+    std::scoped_lock lk{shard.mutex};
+    if (shard.capacity_blocks == 0 || shard.map.contains(key)) {
+        return;
+    }
+
+    // Reuse the least recently used block when the shard is full.
+    std::unique_ptr<u8[]> block_data;
+    if (shard.blocks.size() >= shard.capacity_blocks) {
+        Block& evicted = shard.blocks.back();
+        shard.map.erase(evicted.key);
+        block_data = std::move(evicted.data);
+        shard.blocks.pop_back();
+    } else {
+        block_data = std::make_unique_for_overwrite<u8[]>(BlockCacheBlockSize);
+    }
+    std::memcpy(block_data.get(), data, size);
+
+    shard.blocks.push_front(Block{
+        .key = key,
+        .size = size,
+        .data = std::move(block_data),
+    });
+    shard.map.emplace(key, shard.blocks.begin());
+}
+
+BlockCacheStats BlockCache::GetStats() const {
+    BlockCacheStats stats{
+        .hits = m_hits.load(std::memory_order_relaxed),
+        .misses = m_misses.load(std::memory_order_relaxed),
+        .used_size = 0,
+        .capacity = m_capacity.load(std::memory_order_relaxed),
+    };
+    for (const Shard& shard : m_shards) {
+        std::scoped_lock lk{shard.mutex};
+        stats.used_size += shard.blocks.size() * BlockCacheBlockSize;
+    }
+    return stats;
+}
+
+BlockCacheStorage::BlockCacheStorage(VirtualFile base, BlockCache& cache)
+    : m_base_storage(std::move(base)), m_cache(cache), m_storage_id(cache.AllocateStorageId()),
+      m_size(m_base_storage->GetSize()) {}
+
+size_t BlockCacheStorage::Read(u8* buffer, size_t size, size_t offset) const {
+    // Allow zero-size reads.
+    if (size == 0 || offset >= m_size) {
+        return 0;
+    }
+    size = std::min(size, m_size - offset);
+
+    if (size >= BlockCacheBypassSize) {
+        return m_base_storage->Read(buffer, size, offset);
+    }
+
+    size_t done = 0;
+    while (done < size) {
+        const size_t cur_offset = offset + done;
+        const u64 block_index = cur_offset / BlockCacheBlockSize;
+        const size_t block_offset = cur_offset % BlockCacheBlockSize;
+        const size_t cur_size = std::min(BlockCacheBlockSize - block_offset, size - done);
+        if (m_cache.Read(m_storage_id, block_index, buffer + done, block_offset, cur_size)) {
+            done += cur_size;
+            continue;
+        }
+
+        // Read every remaining block at once, so the layers below see a single read.
+        const size_t read_offset = block_index * BlockCacheBlockSize;
+        const size_t read_end =
+            std::min(Common::AlignUp(offset + size, BlockCacheBlockSize), m_size);
+        Common::ScratchBuffer<u8> blocks(read_end - read_offset);
+        const size_t read_size = m_base_storage->Read(blocks.data(), blocks.size(), read_offset);
+        if (read_size < blocks.size()) {
+            // Short reads aren't cached, the data may be there later.
+            if (read_size <= block_offset) {
+                return done;
+            }
+            const size_t copy_size = std::min(size - done, read_size - block_offset);
+            std::memcpy(buffer + done, blocks.data() + block_offset, copy_size);
+            return done + copy_size;
+        }
+
+        for (size_t block = 0; block < read_size; block += BlockCacheBlockSize) {
+            m_cache.Insert(m_storage_id, block_index + block / BlockCacheBlockSize,
+                           blocks.data() + block, std::min(BlockCacheBlockSize, read_size - block));
+        }
+        std::memcpy(buffer + done, blocks.data() + block_offset, size - done);
+        return size;
+    }
+
+    return size;
+}
+
+} // namespace FileSys
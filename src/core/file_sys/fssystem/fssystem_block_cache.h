@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+#include "common/literals.h"
+#include "core/file_sys/fssystem/fs_i_storage.h"
+
+namespace FileSys {
+
+using namespace Common::Literals;
+
+constexpr inline size_t BlockCacheBlockSize = 16_KiB;
+
+// Reads at least this large stream through without being cached, as they are rarely repeated and
+// would evict everything else.
+constexpr inline size_t BlockCacheBypassSize = 512_KiB;
+
+struct BlockCacheStats {
+    u64 hits;
+    u64 misses;
+    size_t used_size;
+    size_t capacity;
+};
+
+// Least recently used cache of decrypted and verified NCA section blocks, shared by every section
+// storage. Blocks are spread over shards with a lock each, so readers on different threads rarely
+// contend.
+class BlockCache {
+    CITRON_NON_COPYABLE(BlockCache);
+    CITRON_NON_MOVEABLE(BlockCache);
+
+public:
+    static constexpr size_t ShardCount = 16;
+
+    explicit BlockCache(size_t capacity);
+    ~BlockCache();
+
+    // The cache shared by the NCA section storages.
+    static BlockCache& GetInstance();
+
+    // Returns the capacity set by the nca_block_cache_size setting.
+    static size_t GetConfiguredCapacity();
+
+    // Changes the memory budget, evicting blocks over it. A zero capacity disables the cache.
+    void SetCapacity(size_t capacity);
+
+    bool IsEnabled() const {
+        return m_capacity.load(std::memory_order_relaxed) != 0;
+    }
+
+    // Returns an identifier for a storage, never reused so stale blocks can't be returned.
+    u64 AllocateStorageId() {
+        return m_next_storage_id.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Copies size bytes at offset within a cached block to buffer, returns false on a miss.
+    bool Read(u64 storage_id, u64 block_index, u8* buffer, size_t offset, size_t size);
+
+    // Caches a block of up to BlockCacheBlockSize bytes.
+    void Insert(u64 storage_id, u64 block_index, const u8* data, size_t size);
+
+    BlockCacheStats GetStats() const;
+
+private:
+    struct Key {
+        u64 storage_id;
+        u64 block_index;
+
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key& key) const {
+            return static_cast<size_t>((key.storage_id * 0x9E3779B97F4A7C15ULL) ^ key.block_index);
+        }
+    };
+
+    struct Block {
+        Key key;
+        size_t size;
+        std::unique_ptr<u8[]> data;
+    };
+
+    struct Shard {
+        mutable std::mutex mutex;
+        // Most recently used blocks first.
+        std::list<Block> blocks;
+        std::unordered_map<Key, std::list<Block>::iterator, KeyHash> map;
+        size_t capacity_blocks{};
+    };
+
+    Shard& GetShard(const Key& key) {
+        return m_shards[KeyHash{}(key) % ShardCount];
+    }
+
+    std::array<Shard, ShardCount> m_shards;
+    std::atomic<size_t> m_capacity{};
+    std::atomic<u64> m_next_storage_id{1};
+    std::atomic<u64> m_hits{};
+    std::atomic<u64> m_misses{};
+};
+
+// Serves reads of a section storage through the block cache.
+class BlockCacheStorage : public IReadOnlyStorage {
+    CITRON_NON_COPYABLE(BlockCacheStorage);
+    CITRON_NON_MOVEABLE(BlockCacheStorage);
+
+public:
+    BlockCacheStorage(VirtualFile base, BlockCache& cache);
+
+    virtual size_t Read(u8* buffer, size_t size, size_t offset) const override;
+
+    virtual size_t GetSize() const override {
+        return m_size;
+    }
+
+private:
+    VirtualFile m_base_storage;
+    BlockCache& m_cache;
+    u64 m_storage_id;
+    size_t m_size;
+};
+
+} // namespace FileSys
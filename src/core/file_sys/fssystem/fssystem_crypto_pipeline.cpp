@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <thread>
+
+#include "common/thread_worker.h"
+#include "core/file_sys/fssystem/fssystem_crypto_pipeline.h"
+
+namespace FileSys {
+
+namespace {
+
+Common::ThreadWorker& GetCryptoWorkers() {
+    static Common::ThreadWorker workers(std::max(std::thread::hardware_concurrency() / 2, 1U),
+                                        "FsCrypto");
+    return workers;
+}
+
+} // namespace
+
+void CryptoPipeline::Submit(Common::UniqueFunction<void> job) {
+    {
+        std::scoped_lock lk{m_mutex};
+        ++m_pending;
+    }
+    GetCryptoWorkers().QueueWork([this, job = std::move(job)]() mutable {
+        job();
+
+        std::scoped_lock lk{m_mutex};
+        if (--m_pending == 0) {
+            m_cv.notify_all();
+        }
+    });
+}
+
+void CryptoPipeline::Wait() {
+    std::unique_lock lk{m_mutex};
+    m_cv.wait(lk, [this] { return m_pending == 0; });
+}
+
+} // namespace FileSys
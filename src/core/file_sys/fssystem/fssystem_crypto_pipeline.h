@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+#include "common/literals.h"
+#include "common/unique_function.h"
+
+namespace FileSys {
+
+using namespace Common::Literals;
+
+// Reads at least this large are split into chunks, each decrypted on a crypto worker while the
+// next one is read from the base storage.
+constexpr inline size_t CryptoPipelineMinimumSize = 1_MiB;
+constexpr inline size_t CryptoPipelineChunkSize = 256_KiB;
+
+class CryptoPipeline {
+    CITRON_NON_COPYABLE(CryptoPipeline);
+    CITRON_NON_MOVEABLE(CryptoPipeline);
+
+public:
+    CryptoPipeline() = default;
+
+    // Waits for the jobs still running, as they reference the caller's buffers.
+    ~CryptoPipeline() {
+        this->Wait();
+    }
+
+    static bool IsEnabled(size_t size) {
+        return size >= CryptoPipelineMinimumSize;
+    }
+
+    // Queues a job on the shared crypto workers.
+    void Submit(Common::UniqueFunction<void> job);
+
+    // Waits until every job submitted to this pipeline has completed.
+    void Wait();
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    size_t m_pending{};
+};
+
+} // namespace FileSys
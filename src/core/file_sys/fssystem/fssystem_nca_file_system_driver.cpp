@@ -5,6 +5,7 @@
 #include "core/file_sys/fssystem/fssystem_aes_ctr_storage.h"
 #include "core/file_sys/fssystem/fssystem_aes_xts_storage.h"
 #include "core/file_sys/fssystem/fssystem_alignment_matching_storage.h"
+#include "core/file_sys/fssystem/fssystem_block_cache.h"
 #include "core/file_sys/fssystem/fssystem_compressed_storage.h"
 #include "core/file_sys/fssystem/fssystem_hierarchical_integrity_verification_storage.h"
 #include "core/file_sys/fssystem/fssystem_hierarchical_sha256_storage.h"
@@ -320,6 +321,12 @@ Result NcaFileSystemDriver::CreateStorageByRawStorage(VirtualFile* out,
             std::move(storage), header_reader->GetCompressionInfo()));
     }
 
+    // Cache the decrypted and verified blocks for every file opened from this section.
+    if (auto& block_cache = BlockCache::GetInstance(); block_cache.IsEnabled()) {
+        storage = std::make_shared<BlockCacheStorage>(std::move(storage), block_cache);
+        R_UNLESS(storage != nullptr, ResultAllocationMemoryFailedAllocateShared);
+    }
+
     // Set output storage.
     *out = std::move(storage);
     R_SUCCEED();
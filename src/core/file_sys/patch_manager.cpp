@@ -5,7 +5,10 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <filesystem>
+#include <boost/functional/hash.hpp>
 
+#include "common/fs/path_util.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
 #include "common/settings.h"
@@ -348,6 +351,58 @@ std::vector<Core::Memory::CheatEntry> PatchManager::CreateCheatList(
     return out;
 }
 
+// Hashes what decides the layout of a LayeredFS RomFS: the paths and sizes of the files of the base
+// RomFS, and the paths, sizes and modification times of the files of the mod directories. Returns
+// std::nullopt if a mod directory is not on the host filesystem.
+static std::optional<u64> GetLayeredFSLayoutKey(const VirtualDir& base,
+                                                const std::vector<VirtualDir>& layers,
+                                                const std::vector<VirtualDir>& layers_ext) {
+    size_t seed = 0;
+    const auto hash_base_dir = [&seed](const auto& self, const VirtualDir& dir,
+                                       const std::string& path) -> void {
+        for (const auto& file : dir->GetFiles()) {
+            boost::hash_combine(seed, path + file->GetName());
+            boost::hash_combine(seed, file->GetSize());
+        }
+        for (const auto& subdir : dir->GetSubdirectories()) {
+            self(self, subdir, path + subdir->GetName() + '/');
+        }
+    };
+    hash_base_dir(hash_base_dir, base, "/");
+
+    for (const auto* const layer_list : {&layers, &layers_ext}) {
+        boost::hash_combine(seed, layer_list->size());
+        for (const auto& layer : *layer_list) {
+            const auto layer_path = layer->GetFullPath();
+            const std::filesystem::path fs_path{Common::FS::ToU8String(layer_path)};
+            std::error_code ec;
+            if (!std::filesystem::is_directory(fs_path, ec)) {
+                return std::nullopt;
+            }
+            boost::hash_combine(seed, layer_path);
+
+            // The order of directory entries is unspecified, so their hashes are summed.
+            size_t entries_hash = 0;
+            for (auto it = std::filesystem::recursive_directory_iterator(fs_path, ec);
+                 !ec && it != std::filesystem::recursive_directory_iterator{}; it.increment(ec)) {
+                size_t entry_hash = 0;
+                boost::hash_combine(entry_hash, it->path().native());
+                if (it->is_regular_file(ec)) {
+                    boost::hash_combine(entry_hash, it->file_size(ec));
+                    boost::hash_combine(entry_hash,
+                                        it->last_write_time(ec).time_since_epoch().count());
+                }
+                entries_hash += entry_hash;
+            }
+            if (ec) {
+                return std::nullopt;
+            }
+            boost::hash_combine(seed, entries_hash);
+        }
+    }
+    return seed;
+}
+
 static void ApplyLayeredFS(VirtualFile& romfs, u64 title_id, ContentRecordType type,
                            const Service::FileSystem::FileSystemController& fs_controller) {
     const auto load_dir = fs_controller.GetModificationLoadRoot(title_id);
@@ -377,16 +432,16 @@ static void ApplyLayeredFS(VirtualFile& romfs, u64 title_id, ContentRecordType t
 
         auto romfs_dir = FindSubdirectoryCaseless(subdir, "romfs");
         if (romfs_dir != nullptr)
-            layers.emplace_back(std::make_shared<CachedVfsDirectory>(std::move(romfs_dir)));
+            layers.emplace_back(std::move(romfs_dir));
 
         auto ext_dir = FindSubdirectoryCaseless(subdir, "romfs_ext");
         if (ext_dir != nullptr)
-            layers_ext.emplace_back(std::make_shared<CachedVfsDirectory>(std::move(ext_dir)));
+            layers_ext.emplace_back(std::move(ext_dir));
 
         if (type == ContentRecordType::HtmlDocument) {
             auto manual_dir = FindSubdirectoryCaseless(subdir, "manual_html");
             if (manual_dir != nullptr)
-                layers.emplace_back(std::make_shared<CachedVfsDirectory>(std::move(manual_dir)));
+                layers.emplace_back(std::move(manual_dir));
         }
     }
 
@@ -400,6 +455,31 @@ static void ApplyLayeredFS(VirtualFile& romfs, u64 title_id, ContentRecordType t
         return;
     }
 
+    // Reuse the layout built on a previous boot if neither the base RomFS nor the mods changed,
+    // so the mod directories don't have to be visited and files are only opened when read.
+    const auto layout_key = GetLayeredFSLayoutKey(extracted, layers, layers_ext);
+    const auto layout_path = Common::FS::GetCitronPath(Common::FS::CitronPath::CacheDir) /
+                             "layeredfs" /
+                             fmt::format("{:016X}_{:02X}.bin", title_id, static_cast<u8>(type));
+    if (layout_key) {
+        auto lazy_layers = layers;
+        lazy_layers.push_back(extracted);
+        auto packed = OpenRomFSLayout(LayeredVfsDirectory::MakeLayeredDirectory(lazy_layers),
+                                      LayeredVfsDirectory::MakeLayeredDirectory(layers_ext),
+                                      layout_path, *layout_key);
+        if (packed != nullptr) {
+            LOG_INFO(Loader, "    RomFS: LayeredFS patches applied from the saved layout");
+            romfs = std::move(packed);
+            return;
+        }
+    }
+
+    for (auto& layer : layers) {
+        layer = std::make_shared<CachedVfsDirectory>(std::move(layer));
+    }
+    for (auto& layer : layers_ext) {
+        layer = std::make_shared<CachedVfsDirectory>(std::move(layer));
+    }
     layers.emplace_back(std::move(extracted));
 
     auto layered = LayeredVfsDirectory::MakeLayeredDirectory(std::move(layers));
@@ -409,7 +489,9 @@ static void ApplyLayeredFS(VirtualFile& romfs, u64 title_id, ContentRecordType t
 
     auto layered_ext = LayeredVfsDirectory::MakeLayeredDirectory(std::move(layers_ext));
 
-    auto packed = CreateRomFS(std::move(layered), std::move(layered_ext));
+    auto packed = layout_key ? CreateRomFS(std::move(layered), std::move(layered_ext),
+                                           layout_path, *layout_key)
+                             : CreateRomFS(std::move(layered), std::move(layered_ext));
     if (packed == nullptr) {
         return;
     }
@@ -16,8 +16,10 @@
 #include "core/file_sys/content_archive.h"
 #include "core/file_sys/nca_metadata.h"
 #include "core/file_sys/registered_cache.h"
+#include "core/file_sys/registered_cache_index.h"
 #include "core/file_sys/submission_package.h"
 #include "core/file_sys/vfs/vfs_concat.h"
+#include "core/file_sys/vfs/vfs_vector.h"
 #include "core/loader/loader.h"
 
 namespace FileSys {
@@ -327,6 +329,11 @@ VirtualFile RegisteredCache::OpenFileOrDirectoryConcat(const VirtualDir& open_di
 }
 
 VirtualFile RegisteredCache::GetFileAtID(NcaID id) const {
+    std::string path;
+    return GetFileAtID(id, path);
+}
+
+VirtualFile RegisteredCache::GetFileAtID(NcaID id, std::string& out_path) const {
     VirtualFile file;
     // Try all five relevant modes of file storage:
     // (bit 2 = uppercase/lower, bit 1 = within a two-digit dir, bit 0 = .cnmt suffix)
@@ -338,9 +345,9 @@ VirtualFile RegisteredCache::GetFileAtID(NcaID id) const {
     for (u8 i = 0; i < 8; ++i) {
         if ((i % 2) == 1 && i != 7)
             continue;
-        const auto path =
+        out_path =
             GetRelativePathFromNcaID(id, (i & 0b100) == 0, (i & 0b010) == 0, (i & 0b001) == 0b001);
-        file = OpenFileOrDirectoryConcat(dir, path);
+        file = OpenFileOrDirectoryConcat(dir, out_path);
         if (file != nullptr)
             return file;
     }
@@ -413,27 +420,77 @@ std::vector<NcaID> RegisteredCache::AccumulateFiles() const {
 }
 
 void RegisteredCache::ProcessFiles(const std::vector<NcaID>& ids) {
+    std::optional<RegisteredCacheIndex> index;
+    if (!index_path.empty()) {
+        index.emplace(index_path, dir->GetFullPath());
+    }
+
+    std::string path;
     for (const auto& id : ids) {
-        const auto file = GetFileAtID(id);
+        const auto file = GetFileAtID(id, path);
 
         if (file == nullptr)
             continue;
+
+        // Files without a modification time can't be told apart from their previous versions.
+        const u64 size = file->GetSize();
+        const u64 modified = index ? dir->GetFileTimeStamp(path).modified : 0;
+        const bool use_index = index && modified != 0;
+        if (use_index) {
+            if (const auto entry = index->Find(path, size, modified)) {
+                if (!entry->cnmt.empty()) {
+                    std::vector<u8> cnmt(entry->cnmt.begin(), entry->cnmt.end());
+                    meta.insert_or_assign(entry->title_id,
+                                          CNMT(std::make_shared<VectorVfsFile>(std::move(cnmt))));
+                    meta_id.insert_or_assign(entry->title_id, id);
+                }
+                index->Insert(path, *entry);
+                continue;
+            }
+        }
+
         const auto nca = std::make_shared<NCA>(parser(file, id));
-        if (nca->GetStatus() != Loader::ResultStatus::Success ||
-            nca->GetType() != NCAContentType::Meta || nca->GetSubdirectories().empty()) {
+        const auto status = nca->GetStatus();
+        if (status != Loader::ResultStatus::Success || nca->GetType() != NCAContentType::Meta ||
+            nca->GetSubdirectories().empty()) {
+            // A missing title key may be provided later without any change to the key files.
+            if (use_index && status != Loader::ResultStatus::ErrorMissingTitlekey &&
+                status != Loader::ResultStatus::ErrorMissingTitlekek) {
+                index->Insert(path, {
+                                        .size = size,
+                                        .modified = modified,
+                                        .title_id = 0,
+                                        .cnmt = {},
+                                    });
+            }
             continue;
         }
 
         const auto section0 = nca->GetSubdirectories()[0];
 
+        std::vector<u8> cnmt_data;
         for (const auto& section0_file : section0->GetFiles()) {
             if (section0_file->GetExtension() != "cnmt")
                 continue;
 
+            cnmt_data = section0_file->ReadAllBytes();
             meta.insert_or_assign(nca->GetTitleId(), CNMT(section0_file));
             meta_id.insert_or_assign(nca->GetTitleId(), id);
             break;
         }
+
+        if (use_index) {
+            index->Insert(path, {
+                                    .size = size,
+                                    .modified = modified,
+                                    .title_id = cnmt_data.empty() ? 0 : nca->GetTitleId(),
+                                    .cnmt = cnmt_data,
+                                });
+        }
+    }
+
+    if (index) {
+        index->Save();
     }
 }
 
@@ -463,8 +520,10 @@ void RegisteredCache::Refresh() {
     AccumulateCitronMeta();
 }
 
-RegisteredCache::RegisteredCache(VirtualDir dir_, ContentProviderParsingFunction parsing_function)
-    : dir(std::move(dir_)), parser(std::move(parsing_function)) {
+RegisteredCache::RegisteredCache(VirtualDir dir_, std::filesystem::path index_path_,
+                                 ContentProviderParsingFunction parsing_function)
+    : dir(std::move(dir_)), index_path(std::move(index_path_)),
+      parser(std::move(parsing_function)) {
     Refresh();
 }
 
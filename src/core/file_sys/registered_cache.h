@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <filesystem>
 #include <functional>
 #include <memory>
 #include <string>
@@ -133,10 +134,12 @@ class RegisteredCache : public ContentProvider {
 public:
     // Parsing function defines the conversion from raw file to NCA. If there are other steps
     // besides creating the NCA from the file (e.g. NAX0 on SD Card), that should go in a custom
-    // parsing function.
+    // parsing function. If index_path is not empty, the parsed NCAs are indexed there so they
+    // don't have to be parsed again on the next refresh.
     explicit RegisteredCache(
-        VirtualDir dir, ContentProviderParsingFunction parsing_function =
-                            [](const VirtualFile& file, const NcaID& id) { return file; });
+        VirtualDir dir, std::filesystem::path index_path = {},
+        ContentProviderParsingFunction parsing_function =
+            [](const VirtualFile& file, const NcaID& id) { return file; });
     ~RegisteredCache() override;
 
     void Refresh() override;
@@ -187,12 +190,14 @@ private:
     void AccumulateCitronMeta();
     std::optional<NcaID> GetNcaIDFromMetadata(u64 title_id, ContentRecordType type) const;
     VirtualFile GetFileAtID(NcaID id) const;
+    VirtualFile GetFileAtID(NcaID id, std::string& out_path) const;
     VirtualFile OpenFileOrDirectoryConcat(const VirtualDir& open_dir, std::string_view path) const;
     InstallResult RawInstallNCA(const NCA& nca, const VfsCopyFunction& copy,
                                 bool overwrite_if_exists, std::optional<NcaID> override_id = {});
     bool RawInstallCitronMeta(const CNMT& cnmt);
 
     VirtualDir dir;
+    std::filesystem::path index_path;
     ContentProviderParsingFunction parser;
 
     // maps tid -> NcaID of meta
@@ -0,0 +1,202 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include <boost/functional/hash.hpp>
+
+#include "common/common_funcs.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/fs_util.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "core/file_sys/registered_cache_index.h"
+
+namespace FileSys {
+
+namespace {
+
+constexpr u32 IndexMagic = Common::MakeMagic('R', 'C', 'I', 'X');
+constexpr u32 IndexVersion = 1;
+
+struct IndexHeader {
+    u32 magic;
+    u32 version;
+    u64 keys_fingerprint;
+    u32 num_entries;
+    u32 root_size;
+};
+static_assert(sizeof(IndexHeader) == 0x18, "IndexHeader has incorrect size.");
+
+// Followed by the path and the CNMT of the entry.
+struct IndexEntryHeader {
+    u64 size;
+    u64 modified;
+    u64 title_id;
+    u32 path_size;
+    u32 cnmt_size;
+};
+static_assert(sizeof(IndexEntryHeader) == 0x20, "IndexEntryHeader has incorrect size.");
+
+// Hashes the names, sizes and modification times of the key files.
+u64 GetKeysFingerprint() {
+    size_t seed = 0;
+    Common::FS::IterateDirEntries(
+        Common::FS::GetCitronPath(Common::FS::CitronPath::KeysDir),
+        [&seed](const std::filesystem::directory_entry& entry) {
+            std::error_code ec;
+            boost::hash_combine(seed, entry.path().filename().string());
+            boost::hash_combine(seed, entry.file_size(ec));
+            boost::hash_combine(seed, entry.last_write_time(ec).time_since_epoch().count());
+            return true;
+        },
+        Common::FS::DirEntryFilter::File);
+    return seed;
+}
+
+void Append(std::vector<u8>& out, const void* data, size_t size) {
+    const auto* bytes = static_cast<const u8*>(data);
+    out.insert(out.end(), bytes, bytes + size);
+}
+
+} // Anonymous namespace
+
+RegisteredCacheIndex::RegisteredCacheIndex(std::filesystem::path path, std::string root)
+    : m_path(std::move(path)), m_root(std::move(root)), m_keys_fingerprint(GetKeysFingerprint()) {
+    this->Load();
+}
+
+RegisteredCacheIndex::~RegisteredCacheIndex() = default;
+
+void RegisteredCacheIndex::Load() {
+    if (!Common::FS::IsFile(m_path)) {
+        return;
+    }
+    m_file.Open(m_path);
+    const std::span<const u8> data = m_file.GetSpan();
+
+    IndexHeader header;
+    if (data.size() < sizeof(header)) {
+        return;
+    }
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (header.magic != IndexMagic || header.version != IndexVersion ||
+        header.keys_fingerprint != m_keys_fingerprint || header.root_size != m_root.size() ||
+        data.size() - sizeof(header) < header.root_size) {
+        return;
+    }
+    const std::string_view root(reinterpret_cast<const char*>(data.data()) + sizeof(header),
+                                header.root_size);
+    if (root != m_root) {
+        return;
+    }
+
+    size_t offset = sizeof(header) + header.root_size;
+    // Every entry takes at least its header, a larger count comes from a corrupted index
+    if (header.num_entries > (data.size() - offset) / sizeof(IndexEntryHeader)) {
+        LOG_WARNING(Loader, "Registered cache index {} is corrupted",
+                    Common::FS::PathToUTF8String(m_path));
+        return;
+    }
+    m_entries.reserve(header.num_entries);
+    for (u32 i = 0; i < header.num_entries; ++i) {
+        IndexEntryHeader entry;
+        if (data.size() - offset < sizeof(entry)) {
+            break;
+        }
+        std::memcpy(&entry, data.data() + offset, sizeof(entry));
+        offset += sizeof(entry);
+        if (data.size() - offset < u64{entry.path_size} + entry.cnmt_size) {
+            break;
+        }
+
+        const std::string_view entry_path(reinterpret_cast<const char*>(data.data()) + offset,
+                                          entry.path_size);
+        offset += entry.path_size;
+        m_entries.insert_or_assign(entry_path, RegisteredCacheIndexEntry{
+                                                   .size = entry.size,
+                                                   .modified = entry.modified,
+                                                   .title_id = entry.title_id,
+                                                   .cnmt = data.subspan(offset, entry.cnmt_size),
+                                               });
+        offset += entry.cnmt_size;
+    }
+
+    if (m_entries.size() != header.num_entries) {
+        LOG_WARNING(Loader, "Registered cache index {} is corrupted",
+                    Common::FS::PathToUTF8String(m_path));
+        m_entries.clear();
+    }
+}
+
+std::optional<RegisteredCacheIndexEntry> RegisteredCacheIndex::Find(std::string_view path,
+                                                                    u64 size, u64 modified) const {
+    const auto it = m_entries.find(path);
+    if (it == m_entries.end() || it->second.size != size || it->second.modified != modified) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void RegisteredCacheIndex::Insert(std::string_view path, const RegisteredCacheIndexEntry& entry) {
+    // Entries returned by Find point into the loaded index, anything else is a change.
+    const auto it = m_entries.find(path);
+    if (it == m_entries.end() || it->second.size != entry.size ||
+        it->second.modified != entry.modified || it->second.cnmt.data() != entry.cnmt.data()) {
+        m_changed = true;
+    }
+
+    const IndexEntryHeader header{
+        .size = entry.size,
+        .modified = entry.modified,
+        .title_id = entry.title_id,
+        .path_size = static_cast<u32>(path.size()),
+        .cnmt_size = static_cast<u32>(entry.cnmt.size()),
+    };
+    Append(m_new_entries, &header, sizeof(header));
+    Append(m_new_entries, path.data(), path.size());
+    Append(m_new_entries, entry.cnmt.data(), entry.cnmt.size());
+    ++m_num_new_entries;
+}
+
+bool RegisteredCacheIndex::Save() {
+    if (!m_changed && m_num_new_entries == m_entries.size()) {
+        return true;
+    }
+
+    const IndexHeader header{
+        .magic = IndexMagic,
+        .version = IndexVersion,
+        .keys_fingerprint = m_keys_fingerprint,
+        .num_entries = m_num_new_entries,
+        .root_size = static_cast<u32>(m_root.size()),
+    };
+
+    // Write to a temporary file first, so a crash can't leave a partial index behind.
+    auto temp_path = m_path;
+    temp_path += ".tmp";
+    if (!Common::FS::CreateParentDirs(temp_path)) {
+        return false;
+    }
+    {
+        Common::FS::IOFile file(temp_path, Common::FS::FileAccessMode::Write,
+                                Common::FS::FileType::BinaryFile);
+        if (!file.IsOpen() || !file.WriteObject(header) ||
+            file.WriteSpan<char>(m_root) != m_root.size() ||
+            file.WriteSpan<u8>(m_new_entries) != m_new_entries.size()) {
+            LOG_WARNING(Loader, "Failed to write registered cache index {}",
+                        Common::FS::PathToUTF8String(temp_path));
+            return false;
+        }
+    }
+
+    // The loaded entries point into the old index, unmap it before replacing it.
+    m_entries.clear();
+    m_file.Close();
+    if (Common::FS::IsFile(m_path) && !Common::FS::RemoveFile(m_path)) {
+        return false;
+    }
+    return Common::FS::RenameFile(temp_path, m_path);
+}
+
+} // namespace FileSys
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+#include "common/fs/mapped_file.h"
+
+namespace FileSys {
+
+// What parsing an NCA of a registered cache found.
+struct RegisteredCacheIndexEntry {
+    u64 size;
+    u64 modified;
+    // Title ID of a meta NCA, zero for any other NCA.
+    u64 title_id;
+    // Raw CNMT of a meta NCA, empty for any other NCA.
+    std::span<const u8> cnmt;
+};
+
+/**
+ * On-disk index of the NCAs of a registered cache, keyed by their path, size and modification time.
+ * It lets a refresh skip parsing the NCAs that didn't change since the index was saved.
+ *
+ * The index is mapped when constructed and the entries found in it point into the mapping, so they
+ * are valid for the lifetime of the object. The whole index is discarded if it was written for
+ * another directory or the key files changed, as keys decide which NCAs can be parsed at all.
+ */
+class RegisteredCacheIndex {
+    CITRON_NON_COPYABLE(RegisteredCacheIndex);
+    CITRON_NON_MOVEABLE(RegisteredCacheIndex);
+
+public:
+    explicit RegisteredCacheIndex(std::filesystem::path path, std::string root);
+    ~RegisteredCacheIndex();
+
+    // Returns the entry for the NCA at path if its size and modification time are unchanged.
+    std::optional<RegisteredCacheIndexEntry> Find(std::string_view path, u64 size,
+                                                  u64 modified) const;
+
+    // Adds an entry to the index written by Save, whether it was found or newly parsed.
+    void Insert(std::string_view path, const RegisteredCacheIndexEntry& entry);
+
+    // Writes the inserted entries if they differ from the loaded ones.
+    bool Save();
+
+private:
+    void Load();
+
+    std::filesystem::path m_path;
+    std::string m_root;
+    u64 m_keys_fingerprint;
+
+    Common::FS::MappedFile m_file;
+    std::unordered_map<std::string_view, RegisteredCacheIndexEntry> m_entries;
+
+    std::vector<u8> m_new_entries;
+    u32 m_num_new_entries{};
+    bool m_changed{};
+};
+
+} // namespace FileSys
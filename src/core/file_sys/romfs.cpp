@@ -164,4 +164,26 @@ VirtualFile CreateRomFS(VirtualDir dir, VirtualDir ext) {
     return ConcatenatedVfsFile::MakeConcatenatedFile(0, dir->GetName(), ctx.Build());
 }
 
+VirtualFile CreateRomFS(VirtualDir dir, VirtualDir ext, const std::filesystem::path& layout_path,
+                        u64 layout_key) {
+    if (dir == nullptr)
+        return nullptr;
+
+    RomFSBuildContext ctx{dir, ext};
+    return ConcatenatedVfsFile::MakeConcatenatedFile(0, dir->GetName(),
+                                                     ctx.Build(layout_path, layout_key));
+}
+
+VirtualFile OpenRomFSLayout(VirtualDir dir, VirtualDir ext,
+                            const std::filesystem::path& layout_path, u64 layout_key) {
+    if (dir == nullptr)
+        return nullptr;
+
+    auto files = RomFSBuildContext::LoadLayout(layout_path, layout_key, dir, std::move(ext));
+    if (!files) {
+        return nullptr;
+    }
+    return ConcatenatedVfsFile::MakeConcatenatedFile(0, dir->GetName(), std::move(*files));
+}
+
 } // namespace FileSys
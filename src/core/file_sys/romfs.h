@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <filesystem>
 #include "core/file_sys/vfs/vfs.h"
 
 namespace FileSys {
@@ -15,4 +16,15 @@ VirtualDir ExtractRomFS(VirtualFile file);
 // Returns nullptr on failure
 VirtualFile CreateRomFS(VirtualDir dir, VirtualDir ext = nullptr);
 
+// Converts a VFS filesystem into a RomFS binary and saves its layout to layout_path
+// Returns nullptr on failure
+VirtualFile CreateRomFS(VirtualDir dir, VirtualDir ext, const std::filesystem::path& layout_path,
+                        u64 layout_key);
+
+// Opens the RomFS binary of a VFS filesystem from a layout saved by CreateRomFS with the same key,
+// reading the files of dir lazily
+// Returns nullptr if there is no such layout
+VirtualFile OpenRomFSLayout(VirtualDir dir, VirtualDir ext,
+                            const std::filesystem::path& layout_path, u64 layout_key);
+
 } // namespace FileSys
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <memory>
+#include "common/fs/path_util.h"
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/sdmc_factory.h"
 #include "core/file_sys/vfs/vfs.h"
@@ -15,6 +16,7 @@ SDMCFactory::SDMCFactory(VirtualDir sd_dir_, VirtualDir sd_mod_dir_)
     : sd_dir(std::move(sd_dir_)), sd_mod_dir(std::move(sd_mod_dir_)),
       contents(std::make_unique<RegisteredCache>(
           GetOrCreateDirectoryRelative(sd_dir, "/Nintendo/Contents/registered"),
+          Common::FS::GetCitronPath(Common::FS::CitronPath::CacheDir) / "registered" / "sdmc.bin",
           [](const VirtualFile& file, const NcaID& id) {
               return NAX{file, id}.GetDecrypted();
           })),
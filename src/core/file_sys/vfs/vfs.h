@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <type_traits>
 #include <vector>
@@ -110,6 +111,12 @@ public:
     // into file. Returns number of bytes successfully written.
     virtual std::size_t Write(const u8* data, std::size_t length, std::size_t offset = 0) = 0;
 
+    // Returns length bytes starting at offset into file without copying them, if the file can lend
+    // its storage. The span is shorter than length only at the end of the file, and stays valid
+    // until the file is written to or destroyed. Returns an empty span if the data must be read
+    // with Read instead.
+    virtual std::span<const u8> ReadView(std::size_t length, std::size_t offset = 0) const;
+
     // Reads exactly one byte at the offset provided, returning std::nullopt on error.
     virtual std::optional<u8> ReadByte(std::size_t offset = 0) const;
     // Reads size bytes starting at offset in file into a vector.
@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+
+#include "common/logging/log.h"
+#include "core/file_sys/vfs/vfs_copy_stats.h"
+
+namespace FileSys {
+
+namespace {
+
+struct alignas(64) CopyCounter {
+    std::atomic<u64> bytes{};
+};
+
+// Each counter has its own cache line, reads on different layers run on different threads.
+std::array<CopyCounter, static_cast<size_t>(CopyLayer::Count)> copy_counters;
+
+} // namespace
+
+void RecordCopy(CopyLayer layer, size_t size) {
+    copy_counters[static_cast<size_t>(layer)].bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+CopyStats GetCopyStats() {
+    CopyStats stats{};
+    for (size_t i = 0; i < stats.size(); i++) {
+        stats[i] = copy_counters[i].bytes.load(std::memory_order_relaxed);
+    }
+    return stats;
+}
+
+std::string_view GetCopyLayerName(CopyLayer layer) {
+    switch (layer) {
+    case CopyLayer::RealFile:
+        return "RealFile";
+    case CopyLayer::VectorFile:
+        return "VectorFile";
+    case CopyLayer::Decrypt:
+        return "Decrypt";
+    case CopyLayer::Count:
+        break;
+    }
+    return "Unknown";
+}
+
+void LogCopyStats() {
+    const CopyStats stats = GetCopyStats();
+    for (size_t i = 0; i < stats.size(); i++) {
+        LOG_INFO(Service_FS, "{}: {} MiB", GetCopyLayerName(static_cast<CopyLayer>(i)),
+                 stats[i] >> 20);
+    }
+}
+
+} // namespace FileSys
@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include "common/common_types.h"
+
+namespace FileSys {
+
+// Layers of the file system stack that copy file data into a caller's buffer. Layers that only
+// forward reads to the file below them, such as offset and concatenated files, copy nothing.
+enum class CopyLayer : u32 {
+    RealFile,   // Host file reads and copies out of mapped files
+    VectorFile, // In-memory files
+    Decrypt,    // AES-CTR and AES-XTS decryption into the caller's buffer
+    Count,
+};
+
+using CopyStats = std::array<u64, static_cast<size_t>(CopyLayer::Count)>;
+
+// Adds size bytes to the counter of the given layer. Thread-safe.
+void RecordCopy(CopyLayer layer, size_t size);
+
+// Returns the bytes counted for each layer since startup.
+CopyStats GetCopyStats();
+
+std::string_view GetCopyLayerName(CopyLayer layer);
+
+// Logs the bytes counted for each layer.
+void LogCopyStats();
+
+} // namespace FileSys
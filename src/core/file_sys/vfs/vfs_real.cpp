@@ -3,14 +3,19 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <cstring>
 #include <iterator>
 #include <utility>
 #include "common/assert.h"
+#include "common/literals.h"
 #include "common/fs/file.h"
 #include "common/fs/fs.h"
+#include "common/fs/fs_util.h"
+#include "common/fs/mapped_file.h"
 #include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "core/file_sys/vfs/vfs.h"
+#include "core/file_sys/vfs/vfs_copy_stats.h"
 #include "core/file_sys/vfs/vfs_real.h"
 
 // For FileTimeStampRaw
@@ -27,11 +32,18 @@
 namespace FileSys {
 
 namespace FS = Common::FS;
+using namespace Common::Literals;
 
 namespace {
 
 constexpr size_t MaxOpenFiles = 512;
 
+// Read-only files at least this large, such as game images, are memory mapped when they are read.
+// Reads from them don't lock the filesystem. Each mapping takes one of the MaxOpenFiles slots, and
+// at most MaxMappedFiles of them are mapped at once so open files always have room.
+constexpr u64 MinimumMappedFileSize = 16_MiB;
+constexpr size_t MaxMappedFiles = MaxOpenFiles / 8;
+
 constexpr FS::FileAccessMode ModeFlagsToFileAccessMode(OpenMode mode) {
     switch (mode) {
     case OpenMode::Read:
@@ -106,9 +118,18 @@ VirtualFile RealVfsFilesystem::OpenFile(std::string_view path_, OpenMode perms)
 
 VirtualFile RealVfsFilesystem::CreateFile(std::string_view path_, OpenMode perms) {
     const auto path = FS::SanitizePath(path_, FS::DirectorySeparator::PlatformDefault);
+    std::shared_ptr<RealVfsFile> cached_file;
     {
         std::scoped_lock lk{list_lock};
-        cache.erase(path);
+        if (auto it = cache.find(path); it != cache.end()) {
+            cached_file = std::static_pointer_cast<RealVfsFile>(it->second.lock());
+            cache.erase(it);
+        }
+    }
+
+    // Reading a mapping past the end of a truncated file faults, unmap it first.
+    if (cached_file) {
+        cached_file->DropMapping();
     }
 
     // Current usages of CreateFile expect to delete the contents of an existing file.
@@ -232,6 +253,25 @@ void RealVfsFilesystem::DropReference(std::unique_ptr<FileReference>&& reference
     }
 }
 
+bool RealVfsFilesystem::AcquireMappingSlot() {
+    std::scoped_lock lk{list_lock};
+    if (num_mapped_files >= MaxMappedFiles) {
+        return false;
+    }
+
+    // Mappings count as open files, close one if needed.
+    this->EvictSingleReferenceLocked();
+    num_mapped_files++;
+    num_open_files++;
+    return true;
+}
+
+void RealVfsFilesystem::ReleaseMappingSlot() {
+    std::scoped_lock lk{list_lock};
+    num_mapped_files--;
+    num_open_files--;
+}
+
 void RealVfsFilesystem::EvictSingleReferenceLocked() {
     if (num_open_files < MaxOpenFiles || open_references.empty()) {
         return;
@@ -274,6 +314,7 @@ RealVfsFile::RealVfsFile(RealVfsFilesystem& base_, std::unique_ptr<FileReference
       size(size_), perms(perms_) {}
 
 RealVfsFile::~RealVfsFile() {
+    DropMapping();
     base.DropReference(std::move(reference));
 }
 
@@ -296,6 +337,7 @@ std::size_t RealVfsFile::GetSize() const {
 
 bool RealVfsFile::Resize(std::size_t new_size) {
     size.reset();
+    DropMapping();
     auto lk = base.RefreshReference(path, perms, *reference);
     return reference->file ? reference->file->SetSize(new_size) : false;
 }
@@ -313,15 +355,28 @@ bool RealVfsFile::IsReadable() const {
 }
 
 std::size_t RealVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    if (const auto mapped_file = GetMapping()) {
+        const std::span<const u8> mapped = mapped_file->GetSpan();
+        if (offset >= mapped.size()) {
+            return 0;
+        }
+        const std::size_t read_size = std::min(length, mapped.size() - offset);
+        std::memcpy(data, mapped.data() + offset, read_size);
+        RecordCopy(CopyLayer::RealFile, read_size);
+        return read_size;
+    }
     auto lk = base.RefreshReference(path, perms, *reference);
     if (!reference->file || !reference->file->Seek(static_cast<s64>(offset))) {
         return 0;
     }
-    return reference->file->ReadSpan(std::span{data, length});
+    const std::size_t read_size = reference->file->ReadSpan(std::span{data, length});
+    RecordCopy(CopyLayer::RealFile, read_size);
+    return read_size;
 }
 
 std::size_t RealVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
     size.reset();
+    DropMapping();
     auto lk = base.RefreshReference(path, perms, *reference);
     if (!reference->file || !reference->file->Seek(static_cast<s64>(offset))) {
         return 0;
@@ -333,6 +388,49 @@ bool RealVfsFile::Rename(std::string_view name) {
     return base.MoveFile(path, parent_path + '/' + std::string(name)) != nullptr;
 }
 
+std::span<const u8> RealVfsFile::ReadView(std::size_t length, std::size_t offset) const {
+    const auto mapped_file = GetMapping();
+    if (!mapped_file || offset >= mapped_file->GetSize()) {
+        return {};
+    }
+    const std::span<const u8> mapped = mapped_file->GetSpan();
+    return mapped.subspan(offset, std::min(length, mapped.size() - offset));
+}
+
+std::shared_ptr<const FS::MappedFile> RealVfsFile::GetMapping() const {
+    std::scoped_lock lk{mapping_lock};
+    if (mapping_checked) {
+        return mapping;
+    }
+    mapping_checked = true;
+
+    // Writable files must go through the open file, so writes are seen by later reads.
+    if (perms != OpenMode::Read) {
+        return nullptr;
+    }
+    const u64 file_size = size ? *size : FS::GetSize(FS::ToU8String(path));
+    if (file_size < MinimumMappedFileSize || !base.AcquireMappingSlot()) {
+        return nullptr;
+    }
+    auto mapped_file = std::make_shared<FS::MappedFile>(FS::ToU8String(path));
+    if (!mapped_file->IsOpen()) {
+        LOG_WARNING(Common_Filesystem, "Failed to map {}, falling back to file reads", path);
+        base.ReleaseMappingSlot();
+        return nullptr;
+    }
+    mapping = std::move(mapped_file);
+    return mapping;
+}
+
+void RealVfsFile::DropMapping() {
+    std::scoped_lock lk{mapping_lock};
+    if (mapping) {
+        mapping.reset();
+        base.ReleaseMappingSlot();
+    }
+    mapping_checked = false;
+}
+
 // TODO(DarkLordZach): MSVC would not let me combine the following two functions using 'if
 // constexpr' because there is a compile error in the branch not used.
 
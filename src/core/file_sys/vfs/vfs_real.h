@@ -6,6 +6,7 @@
 #include <map>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <string_view>
 #include "common/intrusive_list.h"
 #include "core/file_sys/fs_filesystem.h"
@@ -13,7 +14,8 @@
 
 namespace Common::FS {
 class IOFile;
-}
+class MappedFile;
+} // namespace Common::FS
 
 namespace FileSys {
 
@@ -52,12 +54,15 @@ private:
     ReferenceListType closed_references;
     std::mutex list_lock;
     size_t num_open_files{};
+    size_t num_mapped_files{};
 
 private:
     friend class RealVfsFile;
     std::unique_lock<std::mutex> RefreshReference(const std::string& path, OpenMode perms,
                                                   FileReference& reference);
     void DropReference(std::unique_ptr<FileReference>&& reference);
+    bool AcquireMappingSlot();
+    void ReleaseMappingSlot();
 
 private:
     friend class RealVfsDirectory;
@@ -86,6 +91,7 @@ public:
     bool IsReadable() const override;
     std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
     std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    std::span<const u8> ReadView(std::size_t length, std::size_t offset) const override;
     bool Rename(std::string_view name) override;
 
 private:
@@ -93,6 +99,12 @@ private:
                 const std::string& path, OpenMode perms = OpenMode::Read,
                 std::optional<u64> size = {});
 
+    // Maps large read-only files on their first read, returns nullptr if the file isn't mapped.
+    std::shared_ptr<const Common::FS::MappedFile> GetMapping() const;
+
+    // Unmaps the file before it is written to, the next read maps it again.
+    void DropMapping();
+
     RealVfsFilesystem& base;
     std::unique_ptr<FileReference> reference;
     std::string path;
@@ -100,6 +112,9 @@ private:
     std::vector<std::string> path_components;
     std::optional<u64> size;
     OpenMode perms;
+    mutable std::mutex mapping_lock;
+    mutable std::shared_ptr<const Common::FS::MappedFile> mapping;
+    mutable bool mapping_checked{};
 };
 
 // An implementation of VfsDirectory that represents a directory on the user's computer.
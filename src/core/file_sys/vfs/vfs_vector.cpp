@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <utility>
+#include "core/file_sys/vfs/vfs_copy_stats.h"
 #include "core/file_sys/vfs/vfs_vector.h"
 
 namespace FileSys {
@@ -39,9 +40,17 @@ bool VectorVfsFile::IsReadable() const {
 std::size_t VectorVfsFile::Read(u8* data_, std::size_t length, std::size_t offset) const {
     const auto read = std::min(length, data.size() - offset);
     std::memcpy(data_, data.data() + offset, read);
+    RecordCopy(CopyLayer::VectorFile, read);
     return read;
 }
 
+std::span<const u8> VectorVfsFile::ReadView(std::size_t length, std::size_t offset) const {
+    if (offset >= data.size()) {
+        return {};
+    }
+    return std::span<const u8>(data).subspan(offset, std::min(length, data.size() - offset));
+}
+
 std::size_t VectorVfsFile::Write(const u8* data_, std::size_t length, std::size_t offset) {
     if (offset + length > data.size())
         data.resize(offset + length);
@@ -9,6 +9,7 @@
 #include <string>
 #include <vector>
 #include "core/file_sys/vfs/vfs.h"
+#include "core/file_sys/vfs/vfs_copy_stats.h"
 
 namespace FileSys {
 
@@ -47,6 +48,7 @@ public:
     std::size_t Read(u8* data_, std::size_t length, std::size_t offset) const override {
         const auto read = std::min(length, size - offset);
         std::memcpy(data_, data.data() + offset, read);
+        RecordCopy(CopyLayer::VectorFile, read);
         return read;
     }
 
@@ -54,6 +56,13 @@ public:
         return 0;
     }
 
+    std::span<const u8> ReadView(std::size_t length, std::size_t offset) const override {
+        if (offset >= size) {
+            return {};
+        }
+        return std::span<const u8>(data).subspan(offset, std::min(length, size - offset));
+    }
+
     bool Rename(std::string_view new_name) override {
         name = new_name;
         return true;
@@ -86,6 +95,7 @@ public:
     bool IsReadable() const override;
     std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
     std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    std::span<const u8> ReadView(std::size_t length, std::size_t offset) const override;
     bool Rename(std::string_view name) override;
 
     virtual void Assign(std::vector<u8> new_data);
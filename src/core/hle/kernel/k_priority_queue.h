@@ -3,9 +3,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <bit>
 #include <concepts>
+#include <type_traits>
+
+#include <boost/container/small_vector.hpp>
 
 #include "common/assert.h"
 #include "common/bit_set.h"
@@ -50,7 +54,15 @@ std::is_reference_v<T>&& requires(T& t) {
                              { t.IsDummyThread() } -> Common::ConvertibleTo<bool>;
                          };
 
-template <typename Member, size_t NumCores_, int LowestPriority, int HighestPriority>
+/**
+ * Scheduler queues of threads, per core and priority.
+ *
+ * By default the queues are linked through the entries of their members. With UseArrayQueues, the
+ * queues instead keep their members in arrays next to an occupancy bitmap of their core, so that
+ * queue operations don't touch the other members of a queue.
+ */
+template <typename Member, size_t NumCores_, int LowestPriority, int HighestPriority,
+          bool UseArrayQueues = false>
     requires KPriorityQueueMember<Member>
 class KPriorityQueue {
 public:
@@ -253,9 +265,160 @@ public:
         std::array<Common::BitSet64<NumPriority>, NumCores> m_available_priorities{};
     };
 
+    class KArrayPriorityQueueImpl {
+    public:
+        void PushBack(s32 priority, s32 core, Member* member) {
+            ASSERT(IsValidCore(core));
+            ASSERT(IsValidPriority(priority));
+
+            if (priority > LowestPriority) {
+                return;
+            }
+
+            PerCoreQueues& queues = m_cores[core];
+            queues.queues[priority].push_back(member);
+            queues.available_priorities |= GetPriorityBit(priority);
+        }
+
+        void PushFront(s32 priority, s32 core, Member* member) {
+            ASSERT(IsValidCore(core));
+            ASSERT(IsValidPriority(priority));
+
+            if (priority > LowestPriority) {
+                return;
+            }
+
+            PerCoreQueues& queues = m_cores[core];
+            queues.queues[priority].insert(queues.queues[priority].begin(), member);
+            queues.available_priorities |= GetPriorityBit(priority);
+        }
+
+        void Remove(s32 priority, s32 core, Member* member) {
+            ASSERT(IsValidCore(core));
+            ASSERT(IsValidPriority(priority));
+
+            if (priority > LowestPriority) {
+                return;
+            }
+
+            PerCoreQueues& queues = m_cores[core];
+            Queue& queue = queues.queues[priority];
+            if (const auto it = std::find(queue.begin(), queue.end(), member); it != queue.end()) {
+                queue.erase(it);
+            }
+            if (queue.empty()) {
+                queues.available_priorities &= ~GetPriorityBit(priority);
+            }
+        }
+
+        Member* GetFront(s32 core) const {
+            ASSERT(IsValidCore(core));
+
+            const PerCoreQueues& queues = m_cores[core];
+            if (queues.available_priorities == 0) {
+                return nullptr;
+            }
+            return queues.queues[std::countr_zero(queues.available_priorities)].front();
+        }
+
+        Member* GetFront(s32 priority, s32 core) const {
+            ASSERT(IsValidCore(core));
+            ASSERT(IsValidPriority(priority));
+
+            if (priority > LowestPriority || m_cores[core].queues[priority].empty()) {
+                return nullptr;
+            }
+            return m_cores[core].queues[priority].front();
+        }
+
+        Member* GetNext(s32 core, const Member* member) const {
+            ASSERT(IsValidCore(core));
+
+            if (Member* next = this->GetSamePriorityNext(core, member); next != nullptr) {
+                return next;
+            }
+
+            // Continue with the front of the next lower priority.
+            const s32 priority = member->GetPriority();
+            if (priority >= LowestPriority) {
+                return nullptr;
+            }
+            const u64 lower_priorities =
+                m_cores[core].available_priorities & ~(GetPriorityBit(priority + 1) - 1);
+            if (lower_priorities == 0) {
+                return nullptr;
+            }
+            return m_cores[core].queues[std::countr_zero(lower_priorities)].front();
+        }
+
+        Member* GetSamePriorityNext(s32 core, const Member* member) const {
+            ASSERT(IsValidCore(core));
+
+            const s32 priority = member->GetPriority();
+            if (priority > LowestPriority) {
+                return nullptr;
+            }
+            const Queue& queue = m_cores[core].queues[priority];
+            auto it = std::find(queue.begin(), queue.end(), member);
+            if (it == queue.end() || ++it == queue.end()) {
+                return nullptr;
+            }
+            return *it;
+        }
+
+        void MoveToFront(s32 priority, s32 core, Member* member) {
+            ASSERT(IsValidCore(core));
+            ASSERT(IsValidPriority(priority));
+
+            if (priority <= LowestPriority) {
+                Queue& queue = m_cores[core].queues[priority];
+                if (const auto it = std::find(queue.begin(), queue.end(), member);
+                    it != queue.end()) {
+                    std::rotate(queue.begin(), it, it + 1);
+                }
+            }
+        }
+
+        Member* MoveToBack(s32 priority, s32 core, Member* member) {
+            ASSERT(IsValidCore(core));
+            ASSERT(IsValidPriority(priority));
+
+            if (priority > LowestPriority) {
+                return nullptr;
+            }
+
+            Queue& queue = m_cores[core].queues[priority];
+            if (const auto it = std::find(queue.begin(), queue.end(), member); it != queue.end()) {
+                std::rotate(it, it + 1, queue.end());
+            }
+            return queue.empty() ? nullptr : queue.front();
+        }
+
+    private:
+        // Few threads share a priority on a core, so most queues never leave the inline storage.
+        using Queue = boost::container::small_vector<Member*, 4>;
+
+        struct PerCoreQueues {
+            // Bit N is set when the queue of priority N is not empty.
+            u64 available_priorities{};
+            std::array<Queue, NumPriority> queues{};
+        };
+
+        static constexpr u64 GetPriorityBit(s32 priority) {
+            return UINT64_C(1) << priority;
+        }
+
+        static_assert(LowestPriority < 64);
+
+        std::array<PerCoreQueues, NumCores> m_cores{};
+    };
+
 private:
-    KPriorityQueueImpl m_scheduled_queue;
-    KPriorityQueueImpl m_suggested_queue;
+    using QueueImpl =
+        std::conditional_t<UseArrayQueues, KArrayPriorityQueueImpl, KPriorityQueueImpl>;
+
+    QueueImpl m_scheduled_queue;
+    QueueImpl m_suggested_queue;
 
 private:
     static constexpr void ClearAffinityBit(u64& affinity, s32 core) {
@@ -346,7 +509,14 @@ public:
     }
 
     constexpr Member* GetSamePriorityNext(s32 core, const Member* member) const {
-        return member->GetPriorityQueueEntry(core).GetNext();
+        if constexpr (UseArrayQueues) {
+            // The member is scheduled on its active core and suggested for the others.
+            const QueueImpl& queue =
+                (member->GetActiveCore() == core) ? m_scheduled_queue : m_suggested_queue;
+            return queue.GetSamePriorityNext(core, member);
+        } else {
+            return member->GetPriorityQueueEntry(core).GetNext();
+        }
     }
 
     // Mutators.
@@ -377,7 +547,7 @@ public:
         m_scheduled_queue.MoveToFront(member->GetPriority(), member->GetActiveCore(), member);
     }
 
-    constexpr KThread* MoveToScheduledBack(Member* member) {
+    constexpr Member* MoveToScheduledBack(Member* member) {
         // This is for host (dummy) threads that we do not want to enter the priority queue.
         if (member->IsDummyThread()) {
             return {};
@@ -14,6 +14,7 @@
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "common/scope_exit.h"
+#include "common/settings.h"
 #include "common/thread.h"
 #include "common/thread_worker.h"
 #include "core/arm/arm_interface.h"
@@ -41,6 +42,7 @@
 #include "core/hle/kernel/k_worker_task_manager.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/physical_core.h"
+#include "core/hle/kernel/svc_stats.h"
 #include "core/hle/result.h"
 #include "core/hle/service/server_manager.h"
 #include "core/hle/service/sm/sm.h"
@@ -95,6 +97,12 @@ struct KernelCore::Impl {
 
         InitializeHackSharedMemory(kernel);
         RegisterHostThread(nullptr);
+
+        if (Settings::values.record_svc_stats.GetValue()) {
+            svc_stats = std::make_unique<Svc::SvcStats>();
+        } else {
+            svc_stats.reset();
+        }
     }
 
     void TerminateAllProcesses() {
@@ -115,6 +123,10 @@ struct KernelCore::Impl {
 
         CloseServices();
 
+        if (svc_stats) {
+            LOG_INFO(Kernel_SVC, "SVC statistics:\n{}", svc_stats->GetReport());
+        }
+
         if (application_process) {
             application_process->Close();
             application_process = nullptr;
@@ -841,6 +853,7 @@ struct KernelCore::Impl {
     u32 single_core_thread_id{};
 
     std::array<u64, Core::Hardware::NUM_CPU_CORES> svc_ticks{};
+    std::unique_ptr<Svc::SvcStats> svc_stats;
 
     KWorkerTaskManager worker_task_manager;
 
@@ -1286,6 +1299,10 @@ void KernelCore::ExitSVCProfile() {
     MicroProfileLeave(MICROPROFILE_TOKEN(Kernel_SVC), impl->svc_ticks[CurrentPhysicalCoreIndex()]);
 }
 
+Svc::SvcStats* KernelCore::GetSvcStats() {
+    return impl->svc_stats.get();
+}
+
 Init::KSlabResourceCounts& KernelCore::SlabResourceCounts() {
     return impl->slab_resource_counts;
 }
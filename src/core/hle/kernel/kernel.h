@@ -77,6 +77,10 @@ namespace Init {
 struct KSlabResourceCounts;
 }
 
+namespace Svc {
+class SvcStats;
+}
+
 template <typename T>
 class KSlabHeap;
 
@@ -275,6 +279,9 @@ public:
 
     void ExitSVCProfile();
 
+    /// Gets the SVC call statistics, or nullptr if they are not being recorded.
+    Svc::SvcStats* GetSvcStats();
+
     /// Workaround for single-core mode when preempting threads while idle.
     bool IsPhantomModeForSingleCore() const;
     void SetIsPhantomModeForSingleCore(bool value);
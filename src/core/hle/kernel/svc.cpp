@@ -3,12 +3,15 @@
 
 // This file is automatically generated using svc_generator.py.
 
+#include <array>
+#include <chrono>
 #include <type_traits>
 
 #include "core/arm/arm_interface.h"
 #include "core/core.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/svc_stats.h"
 
 namespace Kernel::Svc {
 
@@ -3913,513 +3916,455 @@ static void SvcWrap_UnmapInsecureMemory64(Core::System& system, std::span<uint64
     SetArg64(args, 0, Convert<uint64_t>(ret));
 }
 
-static void Call32(Core::System& system, u32 imm, std::span<uint64_t, 8> args) {
-    switch (static_cast<SvcId>(imm)) {
-    case SvcId::SetHeapSize:
-        return SvcWrap_SetHeapSize64From32(system, args);
-    case SvcId::SetMemoryPermission:
-        return SvcWrap_SetMemoryPermission64From32(system, args);
-    case SvcId::SetMemoryAttribute:
-        return SvcWrap_SetMemoryAttribute64From32(system, args);
-    case SvcId::MapMemory:
-        return SvcWrap_MapMemory64From32(system, args);
-    case SvcId::UnmapMemory:
-        return SvcWrap_UnmapMemory64From32(system, args);
-    case SvcId::QueryMemory:
-        return SvcWrap_QueryMemory64From32(system, args);
-    case SvcId::ExitProcess:
-        return SvcWrap_ExitProcess64From32(system, args);
-    case SvcId::CreateThread:
-        return SvcWrap_CreateThread64From32(system, args);
-    case SvcId::StartThread:
-        return SvcWrap_StartThread64From32(system, args);
-    case SvcId::ExitThread:
-        return SvcWrap_ExitThread64From32(system, args);
-    case SvcId::SleepThread:
-        return SvcWrap_SleepThread64From32(system, args);
-    case SvcId::GetThreadPriority:
-        return SvcWrap_GetThreadPriority64From32(system, args);
-    case SvcId::SetThreadPriority:
-        return SvcWrap_SetThreadPriority64From32(system, args);
-    case SvcId::GetThreadCoreMask:
-        return SvcWrap_GetThreadCoreMask64From32(system, args);
-    case SvcId::SetThreadCoreMask:
-        return SvcWrap_SetThreadCoreMask64From32(system, args);
-    case SvcId::GetCurrentProcessorNumber:
-        return SvcWrap_GetCurrentProcessorNumber64From32(system, args);
-    case SvcId::SignalEvent:
-        return SvcWrap_SignalEvent64From32(system, args);
-    case SvcId::ClearEvent:
-        return SvcWrap_ClearEvent64From32(system, args);
-    case SvcId::MapSharedMemory:
-        return SvcWrap_MapSharedMemory64From32(system, args);
-    case SvcId::UnmapSharedMemory:
-        return SvcWrap_UnmapSharedMemory64From32(system, args);
-    case SvcId::CreateTransferMemory:
-        return SvcWrap_CreateTransferMemory64From32(system, args);
-    case SvcId::CloseHandle:
-        return SvcWrap_CloseHandle64From32(system, args);
-    case SvcId::ResetSignal:
-        return SvcWrap_ResetSignal64From32(system, args);
-    case SvcId::WaitSynchronization:
-        return SvcWrap_WaitSynchronization64From32(system, args);
-    case SvcId::CancelSynchronization:
-        return SvcWrap_CancelSynchronization64From32(system, args);
-    case SvcId::ArbitrateLock:
-        return SvcWrap_ArbitrateLock64From32(system, args);
-    case SvcId::ArbitrateUnlock:
-        return SvcWrap_ArbitrateUnlock64From32(system, args);
-    case SvcId::WaitProcessWideKeyAtomic:
-        return SvcWrap_WaitProcessWideKeyAtomic64From32(system, args);
-    case SvcId::SignalProcessWideKey:
-        return SvcWrap_SignalProcessWideKey64From32(system, args);
-    case SvcId::GetSystemTick:
-        return SvcWrap_GetSystemTick64From32(system, args);
-    case SvcId::ConnectToNamedPort:
-        return SvcWrap_ConnectToNamedPort64From32(system, args);
-    case SvcId::SendSyncRequestLight:
-        return SvcWrap_SendSyncRequestLight64From32(system, args);
-    case SvcId::SendSyncRequest:
-        return SvcWrap_SendSyncRequest64From32(system, args);
-    case SvcId::SendSyncRequestWithUserBuffer:
-        return SvcWrap_SendSyncRequestWithUserBuffer64From32(system, args);
-    case SvcId::SendAsyncRequestWithUserBuffer:
-        return SvcWrap_SendAsyncRequestWithUserBuffer64From32(system, args);
-    case SvcId::GetProcessId:
-        return SvcWrap_GetProcessId64From32(system, args);
-    case SvcId::GetThreadId:
-        return SvcWrap_GetThreadId64From32(system, args);
-    case SvcId::Break:
-        return SvcWrap_Break64From32(system, args);
-    case SvcId::OutputDebugString:
-        return SvcWrap_OutputDebugString64From32(system, args);
-    case SvcId::ReturnFromException:
-        return SvcWrap_ReturnFromException64From32(system, args);
-    case SvcId::GetInfo:
-        return SvcWrap_GetInfo64From32(system, args);
-    case SvcId::FlushEntireDataCache:
-        return SvcWrap_FlushEntireDataCache64From32(system, args);
-    case SvcId::FlushDataCache:
-        return SvcWrap_FlushDataCache64From32(system, args);
-    case SvcId::MapPhysicalMemory:
-        return SvcWrap_MapPhysicalMemory64From32(system, args);
-    case SvcId::UnmapPhysicalMemory:
-        return SvcWrap_UnmapPhysicalMemory64From32(system, args);
-    case SvcId::GetDebugFutureThreadInfo:
-        return SvcWrap_GetDebugFutureThreadInfo64From32(system, args);
-    case SvcId::GetLastThreadInfo:
-        return SvcWrap_GetLastThreadInfo64From32(system, args);
-    case SvcId::GetResourceLimitLimitValue:
-        return SvcWrap_GetResourceLimitLimitValue64From32(system, args);
-    case SvcId::GetResourceLimitCurrentValue:
-        return SvcWrap_GetResourceLimitCurrentValue64From32(system, args);
-    case SvcId::SetThreadActivity:
-        return SvcWrap_SetThreadActivity64From32(system, args);
-    case SvcId::GetThreadContext3:
-        return SvcWrap_GetThreadContext364From32(system, args);
-    case SvcId::WaitForAddress:
-        return SvcWrap_WaitForAddress64From32(system, args);
-    case SvcId::SignalToAddress:
-        return SvcWrap_SignalToAddress64From32(system, args);
-    case SvcId::SynchronizePreemptionState:
-        return SvcWrap_SynchronizePreemptionState64From32(system, args);
-    case SvcId::GetResourceLimitPeakValue:
-        return SvcWrap_GetResourceLimitPeakValue64From32(system, args);
-    case SvcId::CreateIoPool:
-        return SvcWrap_CreateIoPool64From32(system, args);
-    case SvcId::CreateIoRegion:
-        return SvcWrap_CreateIoRegion64From32(system, args);
-    case SvcId::KernelDebug:
-        return SvcWrap_KernelDebug64From32(system, args);
-    case SvcId::ChangeKernelTraceState:
-        return SvcWrap_ChangeKernelTraceState64From32(system, args);
-    case SvcId::CreateSession:
-        return SvcWrap_CreateSession64From32(system, args);
-    case SvcId::AcceptSession:
-        return SvcWrap_AcceptSession64From32(system, args);
-    case SvcId::ReplyAndReceiveLight:
-        return SvcWrap_ReplyAndReceiveLight64From32(system, args);
-    case SvcId::ReplyAndReceive:
-        return SvcWrap_ReplyAndReceive64From32(system, args);
-    case SvcId::ReplyAndReceiveWithUserBuffer:
-        return SvcWrap_ReplyAndReceiveWithUserBuffer64From32(system, args);
-    case SvcId::CreateEvent:
-        return SvcWrap_CreateEvent64From32(system, args);
-    case SvcId::MapIoRegion:
-        return SvcWrap_MapIoRegion64From32(system, args);
-    case SvcId::UnmapIoRegion:
-        return SvcWrap_UnmapIoRegion64From32(system, args);
-    case SvcId::MapPhysicalMemoryUnsafe:
-        return SvcWrap_MapPhysicalMemoryUnsafe64From32(system, args);
-    case SvcId::UnmapPhysicalMemoryUnsafe:
-        return SvcWrap_UnmapPhysicalMemoryUnsafe64From32(system, args);
-    case SvcId::SetUnsafeLimit:
-        return SvcWrap_SetUnsafeLimit64From32(system, args);
-    case SvcId::CreateCodeMemory:
-        return SvcWrap_CreateCodeMemory64From32(system, args);
-    case SvcId::ControlCodeMemory:
-        return SvcWrap_ControlCodeMemory64From32(system, args);
-    case SvcId::SleepSystem:
-        return SvcWrap_SleepSystem64From32(system, args);
-    case SvcId::ReadWriteRegister:
-        return SvcWrap_ReadWriteRegister64From32(system, args);
-    case SvcId::SetProcessActivity:
-        return SvcWrap_SetProcessActivity64From32(system, args);
-    case SvcId::CreateSharedMemory:
-        return SvcWrap_CreateSharedMemory64From32(system, args);
-    case SvcId::MapTransferMemory:
-        return SvcWrap_MapTransferMemory64From32(system, args);
-    case SvcId::UnmapTransferMemory:
-        return SvcWrap_UnmapTransferMemory64From32(system, args);
-    case SvcId::CreateInterruptEvent:
-        return SvcWrap_CreateInterruptEvent64From32(system, args);
-    case SvcId::QueryPhysicalAddress:
-        return SvcWrap_QueryPhysicalAddress64From32(system, args);
-    case SvcId::QueryIoMapping:
-        return SvcWrap_QueryIoMapping64From32(system, args);
-    case SvcId::CreateDeviceAddressSpace:
-        return SvcWrap_CreateDeviceAddressSpace64From32(system, args);
-    case SvcId::AttachDeviceAddressSpace:
-        return SvcWrap_AttachDeviceAddressSpace64From32(system, args);
-    case SvcId::DetachDeviceAddressSpace:
-        return SvcWrap_DetachDeviceAddressSpace64From32(system, args);
-    case SvcId::MapDeviceAddressSpaceByForce:
-        return SvcWrap_MapDeviceAddressSpaceByForce64From32(system, args);
-    case SvcId::MapDeviceAddressSpaceAligned:
-        return SvcWrap_MapDeviceAddressSpaceAligned64From32(system, args);
-    case SvcId::UnmapDeviceAddressSpace:
-        return SvcWrap_UnmapDeviceAddressSpace64From32(system, args);
-    case SvcId::InvalidateProcessDataCache:
-        return SvcWrap_InvalidateProcessDataCache64From32(system, args);
-    case SvcId::StoreProcessDataCache:
-        return SvcWrap_StoreProcessDataCache64From32(system, args);
-    case SvcId::FlushProcessDataCache:
-        return SvcWrap_FlushProcessDataCache64From32(system, args);
-    case SvcId::DebugActiveProcess:
-        return SvcWrap_DebugActiveProcess64From32(system, args);
-    case SvcId::BreakDebugProcess:
-        return SvcWrap_BreakDebugProcess64From32(system, args);
-    case SvcId::TerminateDebugProcess:
-        return SvcWrap_TerminateDebugProcess64From32(system, args);
-    case SvcId::GetDebugEvent:
-        return SvcWrap_GetDebugEvent64From32(system, args);
-    case SvcId::ContinueDebugEvent:
-        return SvcWrap_ContinueDebugEvent64From32(system, args);
-    case SvcId::GetProcessList:
-        return SvcWrap_GetProcessList64From32(system, args);
-    case SvcId::GetThreadList:
-        return SvcWrap_GetThreadList64From32(system, args);
-    case SvcId::GetDebugThreadContext:
-        return SvcWrap_GetDebugThreadContext64From32(system, args);
-    case SvcId::SetDebugThreadContext:
-        return SvcWrap_SetDebugThreadContext64From32(system, args);
-    case SvcId::QueryDebugProcessMemory:
-        return SvcWrap_QueryDebugProcessMemory64From32(system, args);
-    case SvcId::ReadDebugProcessMemory:
-        return SvcWrap_ReadDebugProcessMemory64From32(system, args);
-    case SvcId::WriteDebugProcessMemory:
-        return SvcWrap_WriteDebugProcessMemory64From32(system, args);
-    case SvcId::SetHardwareBreakPoint:
-        return SvcWrap_SetHardwareBreakPoint64From32(system, args);
-    case SvcId::GetDebugThreadParam:
-        return SvcWrap_GetDebugThreadParam64From32(system, args);
-    case SvcId::GetSystemInfo:
-        return SvcWrap_GetSystemInfo64From32(system, args);
-    case SvcId::CreatePort:
-        return SvcWrap_CreatePort64From32(system, args);
-    case SvcId::ManageNamedPort:
-        return SvcWrap_ManageNamedPort64From32(system, args);
-    case SvcId::ConnectToPort:
-        return SvcWrap_ConnectToPort64From32(system, args);
-    case SvcId::SetProcessMemoryPermission:
-        return SvcWrap_SetProcessMemoryPermission64From32(system, args);
-    case SvcId::MapProcessMemory:
-        return SvcWrap_MapProcessMemory64From32(system, args);
-    case SvcId::UnmapProcessMemory:
-        return SvcWrap_UnmapProcessMemory64From32(system, args);
-    case SvcId::QueryProcessMemory:
-        return SvcWrap_QueryProcessMemory64From32(system, args);
-    case SvcId::MapProcessCodeMemory:
-        return SvcWrap_MapProcessCodeMemory64From32(system, args);
-    case SvcId::UnmapProcessCodeMemory:
-        return SvcWrap_UnmapProcessCodeMemory64From32(system, args);
-    case SvcId::CreateProcess:
-        return SvcWrap_CreateProcess64From32(system, args);
-    case SvcId::StartProcess:
-        return SvcWrap_StartProcess64From32(system, args);
-    case SvcId::TerminateProcess:
-        return SvcWrap_TerminateProcess64From32(system, args);
-    case SvcId::GetProcessInfo:
-        return SvcWrap_GetProcessInfo64From32(system, args);
-    case SvcId::CreateResourceLimit:
-        return SvcWrap_CreateResourceLimit64From32(system, args);
-    case SvcId::SetResourceLimitLimitValue:
-        return SvcWrap_SetResourceLimitLimitValue64From32(system, args);
-    case SvcId::CallSecureMonitor:
-        return SvcWrap_CallSecureMonitor64From32(system, args);
-    case SvcId::MapInsecureMemory:
-        return SvcWrap_MapInsecureMemory64From32(system, args);
-    case SvcId::UnmapInsecureMemory:
-        return SvcWrap_UnmapInsecureMemory64From32(system, args);
-    default:
-        LOG_CRITICAL(Kernel_SVC, "Unknown SVC {:x}!", imm);
-        break;
-    }
-}
-
-static void Call64(Core::System& system, u32 imm, std::span<uint64_t, 8> args) {
-    switch (static_cast<SvcId>(imm)) {
-    case SvcId::SetHeapSize:
-        return SvcWrap_SetHeapSize64(system, args);
-    case SvcId::SetMemoryPermission:
-        return SvcWrap_SetMemoryPermission64(system, args);
-    case SvcId::SetMemoryAttribute:
-        return SvcWrap_SetMemoryAttribute64(system, args);
-    case SvcId::MapMemory:
-        return SvcWrap_MapMemory64(system, args);
-    case SvcId::UnmapMemory:
-        return SvcWrap_UnmapMemory64(system, args);
-    case SvcId::QueryMemory:
-        return SvcWrap_QueryMemory64(system, args);
-    case SvcId::ExitProcess:
-        return SvcWrap_ExitProcess64(system, args);
-    case SvcId::CreateThread:
-        return SvcWrap_CreateThread64(system, args);
-    case SvcId::StartThread:
-        return SvcWrap_StartThread64(system, args);
-    case SvcId::ExitThread:
-        return SvcWrap_ExitThread64(system, args);
-    case SvcId::SleepThread:
-        return SvcWrap_SleepThread64(system, args);
-    case SvcId::GetThreadPriority:
-        return SvcWrap_GetThreadPriority64(system, args);
-    case SvcId::SetThreadPriority:
-        return SvcWrap_SetThreadPriority64(system, args);
-    case SvcId::GetThreadCoreMask:
-        return SvcWrap_GetThreadCoreMask64(system, args);
-    case SvcId::SetThreadCoreMask:
-        return SvcWrap_SetThreadCoreMask64(system, args);
-    case SvcId::GetCurrentProcessorNumber:
-        return SvcWrap_GetCurrentProcessorNumber64(system, args);
-    case SvcId::SignalEvent:
-        return SvcWrap_SignalEvent64(system, args);
-    case SvcId::ClearEvent:
-        return SvcWrap_ClearEvent64(system, args);
-    case SvcId::MapSharedMemory:
-        return SvcWrap_MapSharedMemory64(system, args);
-    case SvcId::UnmapSharedMemory:
-        return SvcWrap_UnmapSharedMemory64(system, args);
-    case SvcId::CreateTransferMemory:
-        return SvcWrap_CreateTransferMemory64(system, args);
-    case SvcId::CloseHandle:
-        return SvcWrap_CloseHandle64(system, args);
-    case SvcId::ResetSignal:
-        return SvcWrap_ResetSignal64(system, args);
-    case SvcId::WaitSynchronization:
-        return SvcWrap_WaitSynchronization64(system, args);
-    case SvcId::CancelSynchronization:
-        return SvcWrap_CancelSynchronization64(system, args);
-    case SvcId::ArbitrateLock:
-        return SvcWrap_ArbitrateLock64(system, args);
-    case SvcId::ArbitrateUnlock:
-        return SvcWrap_ArbitrateUnlock64(system, args);
-    case SvcId::WaitProcessWideKeyAtomic:
-        return SvcWrap_WaitProcessWideKeyAtomic64(system, args);
-    case SvcId::SignalProcessWideKey:
-        return SvcWrap_SignalProcessWideKey64(system, args);
-    case SvcId::GetSystemTick:
-        return SvcWrap_GetSystemTick64(system, args);
-    case SvcId::ConnectToNamedPort:
-        return SvcWrap_ConnectToNamedPort64(system, args);
-    case SvcId::SendSyncRequestLight:
-        return SvcWrap_SendSyncRequestLight64(system, args);
-    case SvcId::SendSyncRequest:
-        return SvcWrap_SendSyncRequest64(system, args);
-    case SvcId::SendSyncRequestWithUserBuffer:
-        return SvcWrap_SendSyncRequestWithUserBuffer64(system, args);
-    case SvcId::SendAsyncRequestWithUserBuffer:
-        return SvcWrap_SendAsyncRequestWithUserBuffer64(system, args);
-    case SvcId::GetProcessId:
-        return SvcWrap_GetProcessId64(system, args);
-    case SvcId::GetThreadId:
-        return SvcWrap_GetThreadId64(system, args);
-    case SvcId::Break:
-        return SvcWrap_Break64(system, args);
-    case SvcId::OutputDebugString:
-        return SvcWrap_OutputDebugString64(system, args);
-    case SvcId::ReturnFromException:
-        return SvcWrap_ReturnFromException64(system, args);
-    case SvcId::GetInfo:
-        return SvcWrap_GetInfo64(system, args);
-    case SvcId::FlushEntireDataCache:
-        return SvcWrap_FlushEntireDataCache64(system, args);
-    case SvcId::FlushDataCache:
-        return SvcWrap_FlushDataCache64(system, args);
-    case SvcId::MapPhysicalMemory:
-        return SvcWrap_MapPhysicalMemory64(system, args);
-    case SvcId::UnmapPhysicalMemory:
-        return SvcWrap_UnmapPhysicalMemory64(system, args);
-    case SvcId::GetDebugFutureThreadInfo:
-        return SvcWrap_GetDebugFutureThreadInfo64(system, args);
-    case SvcId::GetLastThreadInfo:
-        return SvcWrap_GetLastThreadInfo64(system, args);
-    case SvcId::GetResourceLimitLimitValue:
-        return SvcWrap_GetResourceLimitLimitValue64(system, args);
-    case SvcId::GetResourceLimitCurrentValue:
-        return SvcWrap_GetResourceLimitCurrentValue64(system, args);
-    case SvcId::SetThreadActivity:
-        return SvcWrap_SetThreadActivity64(system, args);
-    case SvcId::GetThreadContext3:
-        return SvcWrap_GetThreadContext364(system, args);
-    case SvcId::WaitForAddress:
-        return SvcWrap_WaitForAddress64(system, args);
-    case SvcId::SignalToAddress:
-        return SvcWrap_SignalToAddress64(system, args);
-    case SvcId::SynchronizePreemptionState:
-        return SvcWrap_SynchronizePreemptionState64(system, args);
-    case SvcId::GetResourceLimitPeakValue:
-        return SvcWrap_GetResourceLimitPeakValue64(system, args);
-    case SvcId::CreateIoPool:
-        return SvcWrap_CreateIoPool64(system, args);
-    case SvcId::CreateIoRegion:
-        return SvcWrap_CreateIoRegion64(system, args);
-    case SvcId::KernelDebug:
-        return SvcWrap_KernelDebug64(system, args);
-    case SvcId::ChangeKernelTraceState:
-        return SvcWrap_ChangeKernelTraceState64(system, args);
-    case SvcId::CreateSession:
-        return SvcWrap_CreateSession64(system, args);
-    case SvcId::AcceptSession:
-        return SvcWrap_AcceptSession64(system, args);
-    case SvcId::ReplyAndReceiveLight:
-        return SvcWrap_ReplyAndReceiveLight64(system, args);
-    case SvcId::ReplyAndReceive:
-        return SvcWrap_ReplyAndReceive64(system, args);
-    case SvcId::ReplyAndReceiveWithUserBuffer:
-        return SvcWrap_ReplyAndReceiveWithUserBuffer64(system, args);
-    case SvcId::CreateEvent:
-        return SvcWrap_CreateEvent64(system, args);
-    case SvcId::MapIoRegion:
-        return SvcWrap_MapIoRegion64(system, args);
-    case SvcId::UnmapIoRegion:
-        return SvcWrap_UnmapIoRegion64(system, args);
-    case SvcId::MapPhysicalMemoryUnsafe:
-        return SvcWrap_MapPhysicalMemoryUnsafe64(system, args);
-    case SvcId::UnmapPhysicalMemoryUnsafe:
-        return SvcWrap_UnmapPhysicalMemoryUnsafe64(system, args);
-    case SvcId::SetUnsafeLimit:
-        return SvcWrap_SetUnsafeLimit64(system, args);
-    case SvcId::CreateCodeMemory:
-        return SvcWrap_CreateCodeMemory64(system, args);
-    case SvcId::ControlCodeMemory:
-        return SvcWrap_ControlCodeMemory64(system, args);
-    case SvcId::SleepSystem:
-        return SvcWrap_SleepSystem64(system, args);
-    case SvcId::ReadWriteRegister:
-        return SvcWrap_ReadWriteRegister64(system, args);
-    case SvcId::SetProcessActivity:
-        return SvcWrap_SetProcessActivity64(system, args);
-    case SvcId::CreateSharedMemory:
-        return SvcWrap_CreateSharedMemory64(system, args);
-    case SvcId::MapTransferMemory:
-        return SvcWrap_MapTransferMemory64(system, args);
-    case SvcId::UnmapTransferMemory:
-        return SvcWrap_UnmapTransferMemory64(system, args);
-    case SvcId::CreateInterruptEvent:
-        return SvcWrap_CreateInterruptEvent64(system, args);
-    case SvcId::QueryPhysicalAddress:
-        return SvcWrap_QueryPhysicalAddress64(system, args);
-    case SvcId::QueryIoMapping:
-        return SvcWrap_QueryIoMapping64(system, args);
-    case SvcId::CreateDeviceAddressSpace:
-        return SvcWrap_CreateDeviceAddressSpace64(system, args);
-    case SvcId::AttachDeviceAddressSpace:
-        return SvcWrap_AttachDeviceAddressSpace64(system, args);
-    case SvcId::DetachDeviceAddressSpace:
-        return SvcWrap_DetachDeviceAddressSpace64(system, args);
-    case SvcId::MapDeviceAddressSpaceByForce:
-        return SvcWrap_MapDeviceAddressSpaceByForce64(system, args);
-    case SvcId::MapDeviceAddressSpaceAligned:
-        return SvcWrap_MapDeviceAddressSpaceAligned64(system, args);
-    case SvcId::UnmapDeviceAddressSpace:
-        return SvcWrap_UnmapDeviceAddressSpace64(system, args);
-    case SvcId::InvalidateProcessDataCache:
-        return SvcWrap_InvalidateProcessDataCache64(system, args);
-    case SvcId::StoreProcessDataCache:
-        return SvcWrap_StoreProcessDataCache64(system, args);
-    case SvcId::FlushProcessDataCache:
-        return SvcWrap_FlushProcessDataCache64(system, args);
-    case SvcId::DebugActiveProcess:
-        return SvcWrap_DebugActiveProcess64(system, args);
-    case SvcId::BreakDebugProcess:
-        return SvcWrap_BreakDebugProcess64(system, args);
-    case SvcId::TerminateDebugProcess:
-        return SvcWrap_TerminateDebugProcess64(system, args);
-    case SvcId::GetDebugEvent:
-        return SvcWrap_GetDebugEvent64(system, args);
-    case SvcId::ContinueDebugEvent:
-        return SvcWrap_ContinueDebugEvent64(system, args);
-    case SvcId::GetProcessList:
-        return SvcWrap_GetProcessList64(system, args);
-    case SvcId::GetThreadList:
-        return SvcWrap_GetThreadList64(system, args);
-    case SvcId::GetDebugThreadContext:
-        return SvcWrap_GetDebugThreadContext64(system, args);
-    case SvcId::SetDebugThreadContext:
-        return SvcWrap_SetDebugThreadContext64(system, args);
-    case SvcId::QueryDebugProcessMemory:
-        return SvcWrap_QueryDebugProcessMemory64(system, args);
-    case SvcId::ReadDebugProcessMemory:
-        return SvcWrap_ReadDebugProcessMemory64(system, args);
-    case SvcId::WriteDebugProcessMemory:
-        return SvcWrap_WriteDebugProcessMemory64(system, args);
-    case SvcId::SetHardwareBreakPoint:
-        return SvcWrap_SetHardwareBreakPoint64(system, args);
-    case SvcId::GetDebugThreadParam:
-        return SvcWrap_GetDebugThreadParam64(system, args);
-    case SvcId::GetSystemInfo:
-        return SvcWrap_GetSystemInfo64(system, args);
-    case SvcId::CreatePort:
-        return SvcWrap_CreatePort64(system, args);
-    case SvcId::ManageNamedPort:
-        return SvcWrap_ManageNamedPort64(system, args);
-    case SvcId::ConnectToPort:
-        return SvcWrap_ConnectToPort64(system, args);
-    case SvcId::SetProcessMemoryPermission:
-        return SvcWrap_SetProcessMemoryPermission64(system, args);
-    case SvcId::MapProcessMemory:
-        return SvcWrap_MapProcessMemory64(system, args);
-    case SvcId::UnmapProcessMemory:
-        return SvcWrap_UnmapProcessMemory64(system, args);
-    case SvcId::QueryProcessMemory:
-        return SvcWrap_QueryProcessMemory64(system, args);
-    case SvcId::MapProcessCodeMemory:
-        return SvcWrap_MapProcessCodeMemory64(system, args);
-    case SvcId::UnmapProcessCodeMemory:
-        return SvcWrap_UnmapProcessCodeMemory64(system, args);
-    case SvcId::CreateProcess:
-        return SvcWrap_CreateProcess64(system, args);
-    case SvcId::StartProcess:
-        return SvcWrap_StartProcess64(system, args);
-    case SvcId::TerminateProcess:
-        return SvcWrap_TerminateProcess64(system, args);
-    case SvcId::GetProcessInfo:
-        return SvcWrap_GetProcessInfo64(system, args);
-    case SvcId::CreateResourceLimit:
-        return SvcWrap_CreateResourceLimit64(system, args);
-    case SvcId::SetResourceLimitLimitValue:
-        return SvcWrap_SetResourceLimitLimitValue64(system, args);
-    case SvcId::CallSecureMonitor:
-        return SvcWrap_CallSecureMonitor64(system, args);
-    case SvcId::MapInsecureMemory:
-        return SvcWrap_MapInsecureMemory64(system, args);
-    case SvcId::UnmapInsecureMemory:
-        return SvcWrap_UnmapInsecureMemory64(system, args);
-    default:
-        LOG_CRITICAL(Kernel_SVC, "Unknown SVC {:x}!", imm);
-        break;
-    }
-}
+using SvcWrapper = void (*)(Core::System& system, std::span<uint64_t, 8> args);
+constexpr size_t NumSvcIds = 0x92;
+
+static constexpr std::array<SvcWrapper, NumSvcIds> SvcTable32{
+    nullptr,
+    SvcWrap_SetHeapSize64From32,
+    SvcWrap_SetMemoryPermission64From32,
+    SvcWrap_SetMemoryAttribute64From32,
+    SvcWrap_MapMemory64From32,
+    SvcWrap_UnmapMemory64From32,
+    SvcWrap_QueryMemory64From32,
+    SvcWrap_ExitProcess64From32,
+    SvcWrap_CreateThread64From32,
+    SvcWrap_StartThread64From32,
+    SvcWrap_ExitThread64From32,
+    SvcWrap_SleepThread64From32,
+    SvcWrap_GetThreadPriority64From32,
+    SvcWrap_SetThreadPriority64From32,
+    SvcWrap_GetThreadCoreMask64From32,
+    SvcWrap_SetThreadCoreMask64From32,
+    SvcWrap_GetCurrentProcessorNumber64From32,
+    SvcWrap_SignalEvent64From32,
+    SvcWrap_ClearEvent64From32,
+    SvcWrap_MapSharedMemory64From32,
+    SvcWrap_UnmapSharedMemory64From32,
+    SvcWrap_CreateTransferMemory64From32,
+    SvcWrap_CloseHandle64From32,
+    SvcWrap_ResetSignal64From32,
+    SvcWrap_WaitSynchronization64From32,
+    SvcWrap_CancelSynchronization64From32,
+    SvcWrap_ArbitrateLock64From32,
+    SvcWrap_ArbitrateUnlock64From32,
+    SvcWrap_WaitProcessWideKeyAtomic64From32,
+    SvcWrap_SignalProcessWideKey64From32,
+    SvcWrap_GetSystemTick64From32,
+    SvcWrap_ConnectToNamedPort64From32,
+    SvcWrap_SendSyncRequestLight64From32,
+    SvcWrap_SendSyncRequest64From32,
+    SvcWrap_SendSyncRequestWithUserBuffer64From32,
+    SvcWrap_SendAsyncRequestWithUserBuffer64From32,
+    SvcWrap_GetProcessId64From32,
+    SvcWrap_GetThreadId64From32,
+    SvcWrap_Break64From32,
+    SvcWrap_OutputDebugString64From32,
+    SvcWrap_ReturnFromException64From32,
+    SvcWrap_GetInfo64From32,
+    SvcWrap_FlushEntireDataCache64From32,
+    SvcWrap_FlushDataCache64From32,
+    SvcWrap_MapPhysicalMemory64From32,
+    SvcWrap_UnmapPhysicalMemory64From32,
+    SvcWrap_GetDebugFutureThreadInfo64From32,
+    SvcWrap_GetLastThreadInfo64From32,
+    SvcWrap_GetResourceLimitLimitValue64From32,
+    SvcWrap_GetResourceLimitCurrentValue64From32,
+    SvcWrap_SetThreadActivity64From32,
+    SvcWrap_GetThreadContext364From32,
+    SvcWrap_WaitForAddress64From32,
+    SvcWrap_SignalToAddress64From32,
+    SvcWrap_SynchronizePreemptionState64From32,
+    SvcWrap_GetResourceLimitPeakValue64From32,
+    nullptr,
+    SvcWrap_CreateIoPool64From32,
+    SvcWrap_CreateIoRegion64From32,
+    nullptr,
+    SvcWrap_KernelDebug64From32,
+    SvcWrap_ChangeKernelTraceState64From32,
+    nullptr,
+    nullptr,
+    SvcWrap_CreateSession64From32,
+    SvcWrap_AcceptSession64From32,
+    SvcWrap_ReplyAndReceiveLight64From32,
+    SvcWrap_ReplyAndReceive64From32,
+    SvcWrap_ReplyAndReceiveWithUserBuffer64From32,
+    SvcWrap_CreateEvent64From32,
+    SvcWrap_MapIoRegion64From32,
+    SvcWrap_UnmapIoRegion64From32,
+    SvcWrap_MapPhysicalMemoryUnsafe64From32,
+    SvcWrap_UnmapPhysicalMemoryUnsafe64From32,
+    SvcWrap_SetUnsafeLimit64From32,
+    SvcWrap_CreateCodeMemory64From32,
+    SvcWrap_ControlCodeMemory64From32,
+    SvcWrap_SleepSystem64From32,
+    SvcWrap_ReadWriteRegister64From32,
+    SvcWrap_SetProcessActivity64From32,
+    SvcWrap_CreateSharedMemory64From32,
+    SvcWrap_MapTransferMemory64From32,
+    SvcWrap_UnmapTransferMemory64From32,
+    SvcWrap_CreateInterruptEvent64From32,
+    SvcWrap_QueryPhysicalAddress64From32,
+    SvcWrap_QueryIoMapping64From32,
+    SvcWrap_CreateDeviceAddressSpace64From32,
+    SvcWrap_AttachDeviceAddressSpace64From32,
+    SvcWrap_DetachDeviceAddressSpace64From32,
+    SvcWrap_MapDeviceAddressSpaceByForce64From32,
+    SvcWrap_MapDeviceAddressSpaceAligned64From32,
+    nullptr,
+    SvcWrap_UnmapDeviceAddressSpace64From32,
+    SvcWrap_InvalidateProcessDataCache64From32,
+    SvcWrap_StoreProcessDataCache64From32,
+    SvcWrap_FlushProcessDataCache64From32,
+    SvcWrap_DebugActiveProcess64From32,
+    SvcWrap_BreakDebugProcess64From32,
+    SvcWrap_TerminateDebugProcess64From32,
+    SvcWrap_GetDebugEvent64From32,
+    SvcWrap_ContinueDebugEvent64From32,
+    SvcWrap_GetProcessList64From32,
+    SvcWrap_GetThreadList64From32,
+    SvcWrap_GetDebugThreadContext64From32,
+    SvcWrap_SetDebugThreadContext64From32,
+    SvcWrap_QueryDebugProcessMemory64From32,
+    SvcWrap_ReadDebugProcessMemory64From32,
+    SvcWrap_WriteDebugProcessMemory64From32,
+    SvcWrap_SetHardwareBreakPoint64From32,
+    SvcWrap_GetDebugThreadParam64From32,
+    nullptr,
+    SvcWrap_GetSystemInfo64From32,
+    SvcWrap_CreatePort64From32,
+    SvcWrap_ManageNamedPort64From32,
+    SvcWrap_ConnectToPort64From32,
+    SvcWrap_SetProcessMemoryPermission64From32,
+    SvcWrap_MapProcessMemory64From32,
+    SvcWrap_UnmapProcessMemory64From32,
+    SvcWrap_QueryProcessMemory64From32,
+    SvcWrap_MapProcessCodeMemory64From32,
+    SvcWrap_UnmapProcessCodeMemory64From32,
+    SvcWrap_CreateProcess64From32,
+    SvcWrap_StartProcess64From32,
+    SvcWrap_TerminateProcess64From32,
+    SvcWrap_GetProcessInfo64From32,
+    SvcWrap_CreateResourceLimit64From32,
+    SvcWrap_SetResourceLimitLimitValue64From32,
+    SvcWrap_CallSecureMonitor64From32,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    SvcWrap_MapInsecureMemory64From32,
+    SvcWrap_UnmapInsecureMemory64From32,
+};
+
+static constexpr std::array<SvcWrapper, NumSvcIds> SvcTable64{
+    nullptr,
+    SvcWrap_SetHeapSize64,
+    SvcWrap_SetMemoryPermission64,
+    SvcWrap_SetMemoryAttribute64,
+    SvcWrap_MapMemory64,
+    SvcWrap_UnmapMemory64,
+    SvcWrap_QueryMemory64,
+    SvcWrap_ExitProcess64,
+    SvcWrap_CreateThread64,
+    SvcWrap_StartThread64,
+    SvcWrap_ExitThread64,
+    SvcWrap_SleepThread64,
+    SvcWrap_GetThreadPriority64,
+    SvcWrap_SetThreadPriority64,
+    SvcWrap_GetThreadCoreMask64,
+    SvcWrap_SetThreadCoreMask64,
+    SvcWrap_GetCurrentProcessorNumber64,
+    SvcWrap_SignalEvent64,
+    SvcWrap_ClearEvent64,
+    SvcWrap_MapSharedMemory64,
+    SvcWrap_UnmapSharedMemory64,
+    SvcWrap_CreateTransferMemory64,
+    SvcWrap_CloseHandle64,
+    SvcWrap_ResetSignal64,
+    SvcWrap_WaitSynchronization64,
+    SvcWrap_CancelSynchronization64,
+    SvcWrap_ArbitrateLock64,
+    SvcWrap_ArbitrateUnlock64,
+    SvcWrap_WaitProcessWideKeyAtomic64,
+    SvcWrap_SignalProcessWideKey64,
+    SvcWrap_GetSystemTick64,
+    SvcWrap_ConnectToNamedPort64,
+    SvcWrap_SendSyncRequestLight64,
+    SvcWrap_SendSyncRequest64,
+    SvcWrap_SendSyncRequestWithUserBuffer64,
+    SvcWrap_SendAsyncRequestWithUserBuffer64,
+    SvcWrap_GetProcessId64,
+    SvcWrap_GetThreadId64,
+    SvcWrap_Break64,
+    SvcWrap_OutputDebugString64,
+    SvcWrap_ReturnFromException64,
+    SvcWrap_GetInfo64,
+    SvcWrap_FlushEntireDataCache64,
+    SvcWrap_FlushDataCache64,
+    SvcWrap_MapPhysicalMemory64,
+    SvcWrap_UnmapPhysicalMemory64,
+    SvcWrap_GetDebugFutureThreadInfo64,
+    SvcWrap_GetLastThreadInfo64,
+    SvcWrap_GetResourceLimitLimitValue64,
+    SvcWrap_GetResourceLimitCurrentValue64,
+    SvcWrap_SetThreadActivity64,
+    SvcWrap_GetThreadContext364,
+    SvcWrap_WaitForAddress64,
+    SvcWrap_SignalToAddress64,
+    SvcWrap_SynchronizePreemptionState64,
+    SvcWrap_GetResourceLimitPeakValue64,
+    nullptr,
+    SvcWrap_CreateIoPool64,
+    SvcWrap_CreateIoRegion64,
+    nullptr,
+    SvcWrap_KernelDebug64,
+    SvcWrap_ChangeKernelTraceState64,
+    nullptr,
+    nullptr,
+    SvcWrap_CreateSession64,
+    SvcWrap_AcceptSession64,
+    SvcWrap_ReplyAndReceiveLight64,
+    SvcWrap_ReplyAndReceive64,
+    SvcWrap_ReplyAndReceiveWithUserBuffer64,
+    SvcWrap_CreateEvent64,
+    SvcWrap_MapIoRegion64,
+    SvcWrap_UnmapIoRegion64,
+    SvcWrap_MapPhysicalMemoryUnsafe64,
+    SvcWrap_UnmapPhysicalMemoryUnsafe64,
+    SvcWrap_SetUnsafeLimit64,
+    SvcWrap_CreateCodeMemory64,
+    SvcWrap_ControlCodeMemory64,
+    SvcWrap_SleepSystem64,
+    SvcWrap_ReadWriteRegister64,
+    SvcWrap_SetProcessActivity64,
+    SvcWrap_CreateSharedMemory64,
+    SvcWrap_MapTransferMemory64,
+    SvcWrap_UnmapTransferMemory64,
+    SvcWrap_CreateInterruptEvent64,
+    SvcWrap_QueryPhysicalAddress64,
+    SvcWrap_QueryIoMapping64,
+    SvcWrap_CreateDeviceAddressSpace64,
+    SvcWrap_AttachDeviceAddressSpace64,
+    SvcWrap_DetachDeviceAddressSpace64,
+    SvcWrap_MapDeviceAddressSpaceByForce64,
+    SvcWrap_MapDeviceAddressSpaceAligned64,
+    nullptr,
+    SvcWrap_UnmapDeviceAddressSpace64,
+    SvcWrap_InvalidateProcessDataCache64,
+    SvcWrap_StoreProcessDataCache64,
+    SvcWrap_FlushProcessDataCache64,
+    SvcWrap_DebugActiveProcess64,
+    SvcWrap_BreakDebugProcess64,
+    SvcWrap_TerminateDebugProcess64,
+    SvcWrap_GetDebugEvent64,
+    SvcWrap_ContinueDebugEvent64,
+    SvcWrap_GetProcessList64,
+    SvcWrap_GetThreadList64,
+    SvcWrap_GetDebugThreadContext64,
+    SvcWrap_SetDebugThreadContext64,
+    SvcWrap_QueryDebugProcessMemory64,
+    SvcWrap_ReadDebugProcessMemory64,
+    SvcWrap_WriteDebugProcessMemory64,
+    SvcWrap_SetHardwareBreakPoint64,
+    SvcWrap_GetDebugThreadParam64,
+    nullptr,
+    SvcWrap_GetSystemInfo64,
+    SvcWrap_CreatePort64,
+    SvcWrap_ManageNamedPort64,
+    SvcWrap_ConnectToPort64,
+    SvcWrap_SetProcessMemoryPermission64,
+    SvcWrap_MapProcessMemory64,
+    SvcWrap_UnmapProcessMemory64,
+    SvcWrap_QueryProcessMemory64,
+    SvcWrap_MapProcessCodeMemory64,
+    SvcWrap_UnmapProcessCodeMemory64,
+    SvcWrap_CreateProcess64,
+    SvcWrap_StartProcess64,
+    SvcWrap_TerminateProcess64,
+    SvcWrap_GetProcessInfo64,
+    SvcWrap_CreateResourceLimit64,
+    SvcWrap_SetResourceLimitLimitValue64,
+    SvcWrap_CallSecureMonitor64,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    SvcWrap_MapInsecureMemory64,
+    SvcWrap_UnmapInsecureMemory64,
+};
+
+static constexpr std::array<const char*, NumSvcIds> SvcNames{
+    nullptr,
+    "SetHeapSize",
+    "SetMemoryPermission",
+    "SetMemoryAttribute",
+    "MapMemory",
+    "UnmapMemory",
+    "QueryMemory",
+    "ExitProcess",
+    "CreateThread",
+    "StartThread",
+    "ExitThread",
+    "SleepThread",
+    "GetThreadPriority",
+    "SetThreadPriority",
+    "GetThreadCoreMask",
+    "SetThreadCoreMask",
+    "GetCurrentProcessorNumber",
+    "SignalEvent",
+    "ClearEvent",
+    "MapSharedMemory",
+    "UnmapSharedMemory",
+    "CreateTransferMemory",
+    "CloseHandle",
+    "ResetSignal",
+    "WaitSynchronization",
+    "CancelSynchronization",
+    "ArbitrateLock",
+    "ArbitrateUnlock",
+    "WaitProcessWideKeyAtomic",
+    "SignalProcessWideKey",
+    "GetSystemTick",
+    "ConnectToNamedPort",
+    "SendSyncRequestLight",
+    "SendSyncRequest",
+    "SendSyncRequestWithUserBuffer",
+    "SendAsyncRequestWithUserBuffer",
+    "GetProcessId",
+    "GetThreadId",
+    "Break",
+    "OutputDebugString",
+    "ReturnFromException",
+    "GetInfo",
+    "FlushEntireDataCache",
+    "FlushDataCache",
+    "MapPhysicalMemory",
+    "UnmapPhysicalMemory",
+    "GetDebugFutureThreadInfo",
+    "GetLastThreadInfo",
+    "GetResourceLimitLimitValue",
+    "GetResourceLimitCurrentValue",
+    "SetThreadActivity",
+    "GetThreadContext3",
+    "WaitForAddress",
+    "SignalToAddress",
+    "SynchronizePreemptionState",
+    "GetResourceLimitPeakValue",
+    nullptr,
+    "CreateIoPool",
+    "CreateIoRegion",
+    nullptr,
+    "KernelDebug",
+    "ChangeKernelTraceState",
+    nullptr,
+    nullptr,
+    "CreateSession",
+    "AcceptSession",
+    "ReplyAndReceiveLight",
+    "ReplyAndReceive",
+    "ReplyAndReceiveWithUserBuffer",
+    "CreateEvent",
+    "MapIoRegion",
+    "UnmapIoRegion",
+    "MapPhysicalMemoryUnsafe",
+    "UnmapPhysicalMemoryUnsafe",
+    "SetUnsafeLimit",
+    "CreateCodeMemory",
+    "ControlCodeMemory",
+    "SleepSystem",
+    "ReadWriteRegister",
+    "SetProcessActivity",
+    "CreateSharedMemory",
+    "MapTransferMemory",
+    "UnmapTransferMemory",
+    "CreateInterruptEvent",
+    "QueryPhysicalAddress",
+    "QueryIoMapping",
+    "CreateDeviceAddressSpace",
+    "AttachDeviceAddressSpace",
+    "DetachDeviceAddressSpace",
+    "MapDeviceAddressSpaceByForce",
+    "MapDeviceAddressSpaceAligned",
+    nullptr,
+    "UnmapDeviceAddressSpace",
+    "InvalidateProcessDataCache",
+    "StoreProcessDataCache",
+    "FlushProcessDataCache",
+    "DebugActiveProcess",
+    "BreakDebugProcess",
+    "TerminateDebugProcess",
+    "GetDebugEvent",
+    "ContinueDebugEvent",
+    "GetProcessList",
+    "GetThreadList",
+    "GetDebugThreadContext",
+    "SetDebugThreadContext",
+    "QueryDebugProcessMemory",
+    "ReadDebugProcessMemory",
+    "WriteDebugProcessMemory",
+    "SetHardwareBreakPoint",
+    "GetDebugThreadParam",
+    nullptr,
+    "GetSystemInfo",
+    "CreatePort",
+    "ManageNamedPort",
+    "ConnectToPort",
+    "SetProcessMemoryPermission",
+    "MapProcessMemory",
+    "UnmapProcessMemory",
+    "QueryProcessMemory",
+    "MapProcessCodeMemory",
+    "UnmapProcessCodeMemory",
+    "CreateProcess",
+    "StartProcess",
+    "TerminateProcess",
+    "GetProcessInfo",
+    "CreateResourceLimit",
+    "SetResourceLimitLimitValue",
+    "CallSecureMonitor",
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    nullptr,
+    "MapInsecureMemory",
+    "UnmapInsecureMemory",
+};
 // clang-format on
 
 void Call(Core::System& system, u32 imm) {
@@ -4430,14 +4375,29 @@ void Call(Core::System& system, u32 imm) {
     kernel.CurrentPhysicalCore().SaveSvcArguments(process, args);
     kernel.EnterSVCProfile();
 
-    if (process.Is64Bit()) {
-        Call64(system, imm, args);
+    SvcStats* const stats = kernel.GetSvcStats();
+    const auto start = stats != nullptr ? std::chrono::steady_clock::now()
+                                        : std::chrono::steady_clock::time_point{};
+
+    const auto& table = process.Is64Bit() ? SvcTable64 : SvcTable32;
+    if (imm < table.size() && table[imm] != nullptr) {
+        table[imm](system, args);
     } else {
-        Call32(system, imm, args);
+        LOG_CRITICAL(Kernel_SVC, "Unknown SVC {:x}!", imm);
+    }
+
+    if (stats != nullptr) {
+        // The thread may have been rescheduled to another core while in the SVC.
+        const std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+        stats->Record(kernel.CurrentPhysicalCoreIndex(), imm, elapsed.count());
     }
 
     kernel.ExitSVCProfile();
     kernel.CurrentPhysicalCore().LoadSvcArguments(process, args);
 }
 
+const char* GetSvcName(u32 imm) {
+    return imm < SvcNames.size() ? SvcNames[imm] : nullptr;
+}
+
 } // namespace Kernel::Svc
@@ -538,4 +538,7 @@ void SvcWrap_CallSecureMonitor64(Core::System& system, std::span<uint64_t, 8> ar
 // Perform a supervisor call by index.
 void Call(Core::System& system, u32 imm);
 
+// Returns the name of the supervisor call with the given index, or nullptr if there is none.
+const char* GetSvcName(u32 imm);
+
 } // namespace Kernel::Svc
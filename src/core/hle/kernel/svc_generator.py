@@ -539,16 +539,22 @@ void SvcWrap_CallSecureMonitor64(Core::System& system, std::span<uint64_t, 8> ar
 // Perform a supervisor call by index.
 void Call(Core::System& system, u32 imm);
 
+// Returns the name of the supervisor call with the given index, or nullptr if there is none.
+const char* GetSvcName(u32 imm);
+
 } // namespace Kernel::Svc
 """
 
 PROLOGUE_CPP = """
+#include <array>
+#include <chrono>
 #include <type_traits>
 
 #include "core/arm/arm_interface.h"
 #include "core/core.h"
 #include "core/hle/kernel/k_process.h"
 #include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/svc_stats.h"
 
 namespace Kernel::Svc {
 
@@ -598,38 +604,76 @@ void Call(Core::System& system, u32 imm) {
     kernel.CurrentPhysicalCore().SaveSvcArguments(process, args);
     kernel.EnterSVCProfile();
 
-    if (process.Is64Bit()) {
-        Call64(system, imm, args);
+    SvcStats* const stats = kernel.GetSvcStats();
+    const auto start = stats != nullptr ? std::chrono::steady_clock::now()
+                                        : std::chrono::steady_clock::time_point{};
+
+    const auto& table = process.Is64Bit() ? SvcTable64 : SvcTable32;
+    if (imm < table.size() && table[imm] != nullptr) {
+        table[imm](system, args);
     } else {
-        Call32(system, imm, args);
+        LOG_CRITICAL(Kernel_SVC, "Unknown SVC {:x}!", imm);
+    }
+
+    if (stats != nullptr) {
+        // The thread may have been rescheduled to another core while in the SVC.
+        const std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+        stats->Record(kernel.CurrentPhysicalCoreIndex(), imm, elapsed.count());
     }
 
     kernel.ExitSVCProfile();
     kernel.CurrentPhysicalCore().LoadSvcArguments(process, args);
 }
 
+const char* GetSvcName(u32 imm) {
+    return imm < SvcNames.size() ? SvcNames[imm] : nullptr;
+}
+
 } // namespace Kernel::Svc
 """
 
 
-def emit_call(bitness, names, suffix):
+def emit_table_declarations(names):
+    num_ids = max(imm for imm, _ in names) + 1
+    return "\n".join([
+        "using SvcWrapper = void (*)(Core::System& system, std::span<uint64_t, 8> args);",
+        f"constexpr size_t NumSvcIds = {hex(num_ids)};",
+    ])
+
+
+def emit_table(bitness, names, suffix):
     bit_size = REG_SIZES[bitness]*8
     indent = "    "
+    wrappers = dict(names)
     lines = [
-        f"static void Call{bit_size}(Core::System& system, u32 imm, std::span<uint64_t, 8> args) {{",
-        f"{indent}switch (static_cast<SvcId>(imm)) {{"
+        f"static constexpr std::array<SvcWrapper, NumSvcIds> SvcTable{bit_size}{{",
     ]
 
-    for _, name in names:
-        lines.append(f"{indent}case SvcId::{name}:")
-        lines.append(f"{indent*2}return SvcWrap_{name}{suffix}(system, args);")
+    for imm in range(max(wrappers) + 1):
+        if imm in wrappers:
+            lines.append(f"{indent}SvcWrap_{wrappers[imm]}{suffix},")
+        else:
+            lines.append(f"{indent}nullptr,")
 
-    lines.append(f"{indent}default:")
-    lines.append(
-        f"{indent*2}LOG_CRITICAL(Kernel_SVC, \"Unknown SVC {{:x}}!\", imm);")
-    lines.append(f"{indent*2}break;")
-    lines.append(f"{indent}}}")
-    lines.append("}")
+    lines.append("};")
+
+    return "\n".join(lines)
+
+
+def emit_names(names):
+    indent = "    "
+    svc_names = dict(names)
+    lines = [
+        "static constexpr std::array<const char*, NumSvcIds> SvcNames{",
+    ]
+
+    for imm in range(max(svc_names) + 1):
+        if imm in svc_names:
+            lines.append(f"{indent}\"{svc_names[imm]}\",")
+        else:
+            lines.append(f"{indent}nullptr,")
+
+    lines.append("};")
 
     return "\n".join(lines)
 
@@ -688,8 +732,10 @@ def main():
             arch_fw_declarations[bitness].append(
                 build_fn_declaration(return_type, name + suffix, arguments))
 
-    call_32 = emit_call(BIT_32, names, SUFFIX_NAMES[BIT_32])
-    call_64 = emit_call(BIT_64, names, SUFFIX_NAMES[BIT_64])
+    table_decls = emit_table_declarations(names)
+    table_32 = emit_table(BIT_32, names, SUFFIX_NAMES[BIT_32])
+    table_64 = emit_table(BIT_64, names, SUFFIX_NAMES[BIT_64])
+    svc_names = emit_names(names)
     enum_decls = build_enum_declarations()
 
     with open("svc.h", "w") as f:
@@ -711,9 +757,13 @@ def main():
         f.write("\n\n")
         f.write("\n\n".join(wrapper_fns))
         f.write("\n\n")
-        f.write(call_32)
+        f.write(table_decls)
+        f.write("\n\n")
+        f.write(table_32)
+        f.write("\n\n")
+        f.write(table_64)
         f.write("\n\n")
-        f.write(call_64)
+        f.write(svc_names)
         f.write(EPILOGUE_CPP)
 
     print(f"Done (emitted {len(names)} definitions)")
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <bit>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "core/hle/kernel/svc.h"
+#include "core/hle/kernel/svc_stats.h"
+
+namespace Kernel::Svc {
+
+namespace {
+
+void Increment(std::atomic<u64>& value, u64 amount) {
+    value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+struct SvcSummary {
+    u32 imm;
+    u64 calls;
+    u64 total_ns;
+    std::array<u64, SvcStats::NumBuckets> histogram;
+};
+
+// Upper bound of the bucket holding the given fraction of the calls.
+double GetPercentileUs(const SvcSummary& summary, double fraction) {
+    const u64 target = static_cast<u64>(static_cast<double>(summary.calls) * fraction);
+    u64 seen = 0;
+    for (size_t bucket = 0; bucket < summary.histogram.size(); ++bucket) {
+        seen += summary.histogram[bucket];
+        if (seen > target) {
+            return static_cast<double>(u64{1} << bucket) / 1000.0;
+        }
+    }
+    return static_cast<double>(u64{1} << (summary.histogram.size() - 1)) / 1000.0;
+}
+
+} // Anonymous namespace
+
+SvcStats::SvcStats() = default;
+SvcStats::~SvcStats() = default;
+
+void SvcStats::Record(size_t core, u32 imm, u64 ns) {
+    if (core >= m_counters.size() || imm >= NumSvcs) {
+        return;
+    }
+    const size_t bucket = std::min<size_t>(std::bit_width(ns), NumBuckets - 1);
+    Counters& counters = m_counters[core][imm];
+    Increment(counters.histogram[bucket], 1);
+    Increment(counters.total_ns, ns);
+}
+
+std::string SvcStats::GetReport() const {
+    std::vector<SvcSummary> summaries;
+    for (u32 imm = 0; imm < NumSvcs; ++imm) {
+        SvcSummary summary{.imm = imm, .calls = 0, .total_ns = 0, .histogram = {}};
+        for (const auto& core_counters : m_counters) {
+            const Counters& counters = core_counters[imm];
+            for (size_t bucket = 0; bucket < NumBuckets; ++bucket) {
+                const u64 count = counters.histogram[bucket].load(std::memory_order_relaxed);
+                summary.histogram[bucket] += count;
+                summary.calls += count;
+            }
+            summary.total_ns += counters.total_ns.load(std::memory_order_relaxed);
+        }
+        if (summary.calls != 0) {
+            summaries.push_back(summary);
+        }
+    }
+    std::ranges::sort(summaries, std::greater{}, &SvcSummary::total_ns);
+
+    std::string report =
+        fmt::format("{:<32} {:>10} {:>12} {:>10} {:>10} {:>10}\n", "SVC", "Calls", "Total (ms)",
+                    "Mean (us)", "p50 (us)", "p99 (us)");
+    for (const SvcSummary& summary : summaries) {
+        const char* name = GetSvcName(summary.imm);
+        report += fmt::format(
+            "{:<32} {:>10} {:>12.3f} {:>10.3f} {:>10.3f} {:>10.3f}\n",
+            name != nullptr ? fmt::format("{} ({:#x})", name, summary.imm)
+                            : fmt::format("{:#x}", summary.imm),
+            summary.calls, static_cast<double>(summary.total_ns) / 1e6,
+            static_cast<double>(summary.total_ns) / static_cast<double>(summary.calls) / 1e3,
+            GetPercentileUs(summary, 0.5), GetPercentileUs(summary, 0.99));
+    }
+    return report;
+}
+
+} // namespace Kernel::Svc
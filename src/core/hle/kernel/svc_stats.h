@@ -0,0 +1,50 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <string>
+
+#include "common/common_funcs.h"
+#include "common/common_types.h"
+#include "core/hardware_properties.h"
+
+namespace Kernel::Svc {
+
+/**
+ * Call counts and host time histograms of the supervisor calls.
+ *
+ * The counters of a core are only written by the host thread running that core, so recording is a
+ * plain relaxed load and store without any locking. Reports sum the counters of all cores and may
+ * be slightly behind the calls in flight.
+ */
+class SvcStats {
+    CITRON_NON_COPYABLE(SvcStats);
+    CITRON_NON_MOVEABLE(SvcStats);
+
+public:
+    static constexpr size_t NumSvcs = 0x100;
+
+    // Bucket N counts the calls that took less than 2^N nanoseconds, the last one all the others.
+    static constexpr size_t NumBuckets = 32;
+
+    explicit SvcStats();
+    ~SvcStats();
+
+    void Record(size_t core, u32 imm, u64 ns);
+
+    // Formats a table of the called SVCs, sorted by total host time.
+    std::string GetReport() const;
+
+private:
+    struct Counters {
+        std::array<std::atomic<u64>, NumBuckets> histogram{};
+        std::atomic<u64> total_ns{};
+    };
+
+    std::array<std::array<Counters, NumSvcs>, Core::Hardware::NUM_CPU_CORES> m_counters{};
+};
+
+} // namespace Kernel::Svc
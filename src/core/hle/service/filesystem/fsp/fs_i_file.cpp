@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include "core/file_sys/errors.h"
 #include "core/hle/service/cmif_serialization.h"
 #include "core/hle/service/filesystem/fsp/fs_i_file.h"
@@ -30,9 +32,12 @@ Result IFile::Read(
     LOG_DEBUG(Service_FS, "called, option={}, offset=0x{:X}, length={}", option.value, offset,
               size);
 
+    R_UNLESS(size >= 0, FileSys::ResultInvalidSize);
+
     // Read the data from the Storage backend
-    R_RETURN(
-        backend->Read(reinterpret_cast<size_t*>(out_size.Get()), offset, out_buffer.data(), size));
+    const size_t read_size = std::min(static_cast<size_t>(size), out_buffer.size());
+    R_RETURN(backend->Read(reinterpret_cast<size_t*>(out_size.Get()), offset, out_buffer.data(),
+                           read_size));
 }
 
 Result IFile::Write(
@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2023 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
+
 #include "core/file_sys/errors.h"
 #include "core/hle/service/cmif_serialization.h"
 #include "core/hle/service/filesystem/fsp/fs_i_storage.h"
@@ -29,7 +31,8 @@ Result IStorage::Read(
     R_UNLESS(offset >= 0, FileSys::ResultInvalidOffset);
 
     // Read the data from the Storage backend
-    backend->Read(out_bytes.data(), length, offset);
+    const size_t size = std::min(static_cast<size_t>(length), out_bytes.size());
+    backend->Read(out_bytes.data(), size, offset);
 
     R_SUCCEED();
 }
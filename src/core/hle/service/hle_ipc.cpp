@@ -10,6 +10,7 @@
 #include "common/assert.h"
 #include "common/common_funcs.h"
 #include "common/common_types.h"
+#include "common/literals.h"
 #include "common/logging/log.h"
 #include "common/scratch_buffer.h"
 #include "core/guest_memory.h"
@@ -26,6 +27,24 @@
 
 namespace Service {
 
+namespace {
+
+using namespace Common::Literals;
+
+// Contexts live as long as their session. Buffers grown past this size by a large request are
+// freed on reset, so they don't stay allocated until the session is closed.
+constexpr size_t MaxRetainedBufferSize = 1_MiB;
+
+void ReleaseLargeBuffers(std::array<Common::ScratchBuffer<u8>, 3>& buffers) {
+    for (auto& buffer : buffers) {
+        if (buffer.capacity() > MaxRetainedBufferSize) {
+            buffer = Common::ScratchBuffer<u8>{};
+        }
+    }
+}
+
+} // Anonymous namespace
+
 SessionRequestHandler::SessionRequestHandler(Kernel::KernelCore& kernel_, const char* service_name_)
     : kernel{kernel_} {}
 
@@ -134,6 +153,43 @@ HLERequestContext::HLERequestContext(Kernel::KernelCore& kernel_, Core::Memory::
 
 HLERequestContext::~HLERequestContext() = default;
 
+void HLERequestContext::Reset(Kernel::KServerSession* server_session_, Kernel::KThread* thread_) {
+    cmd_buf[0] = 0;
+    server_session = server_session_;
+    client_handle_table = nullptr;
+    thread = thread_;
+
+    incoming_move_handles.clear();
+    incoming_copy_handles.clear();
+    outgoing_move_objects.clear();
+    outgoing_copy_objects.clear();
+    outgoing_domain_objects.clear();
+
+    command_header.reset();
+    handle_descriptor_header.reset();
+    data_payload_header.reset();
+    domain_message_header.reset();
+    buffer_x_descriptors.clear();
+    buffer_a_descriptors.clear();
+    buffer_b_descriptors.clear();
+    buffer_w_descriptors.clear();
+    buffer_c_descriptors.clear();
+
+    command = 0;
+    pid = 0;
+    write_size = 0;
+    data_payload_offset = 0;
+    handles_offset = 0;
+    domain_offset = 0;
+
+    manager.reset();
+    is_deferred = false;
+
+    ReleaseLargeBuffers(read_buffer_data_a);
+    ReleaseLargeBuffers(read_buffer_data_x);
+    ReleaseLargeBuffers(out_temporary_buffers);
+}
+
 void HLERequestContext::ParseCommandBuffer(u32_le* src_cmdbuf, bool incoming) {
     IPC::RequestParser rp(src_cmdbuf);
     command_header = rp.PopRaw<IPC::CommandHeader>();
@@ -15,6 +15,7 @@
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/concepts.h"
+#include "common/scratch_buffer.h"
 #include "common/swap.h"
 #include "core/hle/ipc.h"
 #include "core/hle/kernel/k_handle_table.h"
@@ -185,6 +186,12 @@ public:
                                Kernel::KServerSession* session, Kernel::KThread* thread);
     ~HLERequestContext();
 
+    /**
+     * Prepares this context for the next request of a session. The descriptor lists and read
+     * buffers keep their storage, so handling requests does not allocate once it is warmed up.
+     */
+    void Reset(Kernel::KServerSession* session, Kernel::KThread* thread);
+
     /// Returns a pointer to the IPC command buffer for this request.
     [[nodiscard]] u32* CommandBuffer() {
         return cmd_buf.data();
@@ -381,6 +388,11 @@ public:
         return manager.lock();
     }
 
+    /// Scratch storage for the output buffers of CMIF handlers, kept across requests.
+    [[nodiscard]] std::array<Common::ScratchBuffer<u8>, 3>& GetOutTemporaryBuffers() {
+        return out_temporary_buffers;
+    }
+
     bool GetIsDeferred() const {
         return is_deferred;
     }
@@ -431,6 +443,7 @@ private:
 
     mutable std::array<Common::ScratchBuffer<u8>, 3> read_buffer_data_a{};
     mutable std::array<Common::ScratchBuffer<u8>, 3> read_buffer_data_x{};
+    std::array<Common::ScratchBuffer<u8>, 3> out_temporary_buffers{};
 };
 
 } // namespace Service
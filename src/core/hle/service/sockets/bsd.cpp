@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
 #include <fmt/ranges.h>
 
 #include "common/microprofile.h"
@@ -534,7 +535,7 @@ std::pair<s32, Errno> BSD::PollImpl(std::vector<u8>& write_buffer, std::span<con
         return {-1, Errno::INVAL};
     }
 
-    std::vector<PollFD> fds(nfds);
+    boost::container::small_vector<PollFD, 16> fds(nfds);
     std::memcpy(fds.data(), read_buffer.data(), nfds * sizeof(PollFD));
 
     if (timeout >= 0) {
@@ -568,7 +569,7 @@ std::pair<s32, Errno> BSD::PollImpl(std::vector<u8>& write_buffer, std::span<con
         }
     }
 
-    std::vector<Network::PollFD> host_pollfds(fds.size());
+    boost::container::small_vector<Network::PollFD, 16> host_pollfds(fds.size());
     std::transform(fds.begin(), fds.end(), host_pollfds.begin(), [this](PollFD pollfd) {
         Network::PollFD result;
         result.socket = file_descriptors[pollfd.fd]->socket.get();
@@ -577,7 +578,7 @@ std::pair<s32, Errno> BSD::PollImpl(std::vector<u8>& write_buffer, std::span<con
         return result;
     });
 
-    const auto result = Network::Poll(host_pollfds, timeout);
+    const auto result = Network::Poll({host_pollfds.data(), host_pollfds.size()}, timeout);
 
     const size_t num = host_pollfds.size();
     for (size_t i = 0; i < num; ++i) {
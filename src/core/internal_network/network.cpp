@@ -7,6 +7,8 @@
 #include <utility>
 #include <vector>
 
+#include <boost/container/small_vector.hpp>
+
 #include "common/error.h"
 
 #ifdef _WIN32
@@ -594,10 +596,11 @@ Common::Expected<std::vector<AddrInfo>, GetAddrInfoError> GetAddressInfo(
     return ret;
 }
 
-std::pair<s32, Errno> Poll(std::vector<PollFD>& pollfds, s32 timeout) {
+std::pair<s32, Errno> Poll(std::span<PollFD> pollfds, s32 timeout) {
     const size_t num = pollfds.size();
 
-    std::vector<WSAPOLLFD> host_pollfds(pollfds.size());
+    // Games poll a handful of sockets at a time, keep them off the heap.
+    boost::container::small_vector<WSAPOLLFD, 16> host_pollfds(pollfds.size());
     std::transform(pollfds.begin(), pollfds.end(), host_pollfds.begin(), [](PollFD fd) {
         WSAPOLLFD result;
         result.fd = fd.socket->GetFD();
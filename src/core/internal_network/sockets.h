@@ -175,6 +175,6 @@ public:
     void HandleProxyPacket(const ProxyPacket& packet) override;
 };
 
-std::pair<s32, Errno> Poll(std::vector<PollFD>& poll_fds, s32 timeout);
+std::pair<s32, Errno> Poll(std::span<PollFD> poll_fds, s32 timeout);
 
 } // namespace Network
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <chrono>
 #include <cstring>
 #include "common/logging/log.h"
 #include "common/settings.h"
@@ -185,6 +186,17 @@ AppLoader_DeconstructedRomDirectory::LoadResult AppLoader_DeconstructedRomDirect
                                        "subsdk3", "subsdk4", "subsdk5", "subsdk6", "subsdk7",
                                        "subsdk8", "subsdk9", "sdk"};
 
+    const auto decode_start = std::chrono::steady_clock::now();
+
+    // Decompress every module at once, both passes below use the decoded images.
+    std::array<FileSys::VirtualFile, static_modules.size()> module_files;
+    for (size_t i = 0; i < static_modules.size(); i++) {
+        module_files[i] = dir->GetFile(static_modules[i]);
+    }
+    auto module_images = AppLoader_NSO::DecodeModules(module_files);
+
+    const auto layout_start = std::chrono::steady_clock::now();
+
     std::size_t code_size{};
 
     // Define an nce patch context for each potential module.
@@ -193,15 +205,17 @@ AppLoader_DeconstructedRomDirectory::LoadResult AppLoader_DeconstructedRomDirect
     // Use the NSO module loader to figure out the code layout
     for (size_t i = 0; i < static_modules.size(); i++) {
         const auto& module = static_modules[i];
-        const FileSys::VirtualFile module_file{dir->GetFile(module)};
-        if (!module_file) {
+        if (!module_files[i]) {
             continue;
         }
+        if (!module_images[i]) {
+            return {ResultStatus::ErrorLoadingNSO, {}};
+        }
 
         const bool should_pass_arguments = std::strcmp(module, "rtld") == 0;
-        const auto tentative_next_load_addr = AppLoader_NSO::LoadModule(
-            process, system, *module_file, code_size, should_pass_arguments, false, {},
-            patch_ctx.GetPatchers(), patch_ctx.GetLastIndex());
+        const auto tentative_next_load_addr =
+            AppLoader_NSO::LayoutModule(*module_images[i], code_size, should_pass_arguments,
+                                        patch_ctx.GetPatchers(), patch_ctx.GetLastIndex());
         if (!tentative_next_load_addr) {
             return {ResultStatus::ErrorLoadingNSO, {}};
         }
@@ -228,6 +242,8 @@ AppLoader_DeconstructedRomDirectory::LoadResult AppLoader_DeconstructedRomDirect
         return {ResultStatus::ErrorUnableToParseKernelMetadata, {}};
     }
 
+    const auto load_start = std::chrono::steady_clock::now();
+
     // Load NSO modules
     modules.clear();
     const VAddr base_address{GetInteger(process.GetEntryPoint())};
@@ -236,16 +252,15 @@ AppLoader_DeconstructedRomDirectory::LoadResult AppLoader_DeconstructedRomDirect
                                    system.GetContentProvider()};
     for (size_t i = 0; i < static_modules.size(); i++) {
         const auto& module = static_modules[i];
-        const FileSys::VirtualFile module_file{dir->GetFile(module)};
-        if (!module_file) {
+        if (!module_files[i]) {
             continue;
         }
 
         const VAddr load_addr{next_load_addr};
         const bool should_pass_arguments = std::strcmp(module, "rtld") == 0;
         const auto tentative_next_load_addr = AppLoader_NSO::LoadModule(
-            process, system, *module_file, load_addr, should_pass_arguments, true, pm,
-            patch_ctx.GetPatchers(), patch_ctx.GetIndex(i));
+            process, system, std::move(*module_images[i]), module, load_addr,
+            should_pass_arguments, true, pm, patch_ctx.GetPatchers(), patch_ctx.GetIndex(i));
         if (!tentative_next_load_addr) {
             return {ResultStatus::ErrorLoadingNSO, {}};
         }
@@ -255,6 +270,15 @@ AppLoader_DeconstructedRomDirectory::LoadResult AppLoader_DeconstructedRomDirect
         LOG_DEBUG(Loader, "loaded module {} @ {:#X}", module, load_addr);
     }
 
+    const auto load_end = std::chrono::steady_clock::now();
+    const auto to_ms = [](auto duration) {
+        return std::chrono::duration<double, std::milli>(duration).count();
+    };
+    LOG_INFO(Loader,
+             "Loaded modules in {:.1f} ms (decode {:.1f} ms, layout {:.1f} ms, load {:.1f} ms)",
+             to_ms(load_end - decode_start), to_ms(layout_start - decode_start),
+             to_ms(load_start - layout_start), to_ms(load_end - load_start));
+
     is_loaded = true;
     return {ResultStatus::Success,
             LoadParameters{metadata.GetMainThreadPriority(), metadata.GetMainThreadStackSize()}};
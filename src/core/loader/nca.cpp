@@ -1,6 +1,8 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <array>
+#include <future>
 #include <utility>
 
 #include "common/hex_util.h"
@@ -109,8 +111,8 @@ ResultStatus AppLoader_NCA::VerifyIntegrity(std::function<bool(size_t, size_t)>
     const auto input_hash =
         Common::HexStringToVector(file->GetName().substr(0, NcaFileNameHashLength), false);
 
-    // Declare buffer to read into.
-    std::vector<u8> buffer(4_MiB);
+    // Declare buffers to read into, the next one is filled while the current one is hashed.
+    std::array<std::vector<u8>, 2> buffers{std::vector<u8>(4_MiB), std::vector<u8>(4_MiB)};
 
     // Initialize sha256 verification context.
     mbedtls_sha256_context ctx;
@@ -126,11 +128,34 @@ ResultStatus AppLoader_NCA::VerifyIntegrity(std::function<bool(size_t, size_t)>
     const size_t total_size = file->GetSize();
     size_t processed_size = 0;
 
+    // Reads a buffer asynchronously, starting at the given offset.
+    const auto read_ahead = [this, total_size](std::vector<u8>& buffer, size_t offset) {
+        return std::async(std::launch::async, [this, &buffer, offset, total_size] {
+            const size_t intended_read_size = std::min(buffer.size(), total_size - offset);
+            return file->Read(buffer.data(), intended_read_size, offset);
+        });
+    };
+
     // Begin iterating the file.
+    size_t current = 0;
+    std::future<size_t> pending_read;
+    if (total_size > 0) {
+        pending_read = read_ahead(buffers[current], 0);
+    }
     while (processed_size < total_size) {
-        // Refill the buffer.
-        const size_t intended_read_size = std::min(buffer.size(), total_size - processed_size);
-        const size_t read_size = file->Read(buffer.data(), intended_read_size, processed_size);
+        // Wait for the buffer to be filled.
+        const size_t read_size = pending_read.get();
+        if (read_size == 0) {
+            LOG_ERROR(Loader, "Failed to read NCA {} at offset {:X}", name, processed_size);
+            return ResultStatus::ErrorIntegrityVerificationFailed;
+        }
+
+        // Start filling the other buffer.
+        const auto& buffer = buffers[current];
+        current ^= 1;
+        if (processed_size + read_size < total_size) {
+            pending_read = read_ahead(buffers[current], processed_size + read_size);
+        }
 
         // Update the hash function with the buffer contents.
         mbedtls_sha256_update_ret(&ctx, buffer.data(), read_size);
@@ -212,7 +212,7 @@ static bool LoadNroImpl(Core::System& system, Kernel::KProcess& process,
 
     if (Settings::IsNceEnabled()) {
         // Patch SVCs and MRS calls in the guest code
-        patch.PatchText(program_image, code);
+        patch.PatchText(program_image, program_image.size(), code);
 
         // We only support PostData patching for NROs.
         ASSERT(patch.GetPatchMode() == Core::NCE::PatchMode::PostData);
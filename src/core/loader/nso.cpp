@@ -1,16 +1,22 @@
 // SPDX-FileCopyrightText: Copyright 2018 yuzu Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstring>
+#include <thread>
 #include <vector>
 
+#include <mbedtls/sha256.h>
+
 #include "common/common_funcs.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
 #include "common/lz4_compression.h"
+#include "common/scratch_buffer.h"
 #include "common/settings.h"
 #include "common/swap.h"
+#include "common/thread_worker.h"
 #include "core/core.h"
 #include "core/file_sys/patch_manager.h"
 #include "core/hle/kernel/code_set.h"
@@ -37,19 +43,134 @@ struct MODHeader {
 };
 static_assert(sizeof(MODHeader) == 0x1c, "MODHeader has incorrect size.");
 
-std::vector<u8> DecompressSegment(const std::vector<u8>& compressed_data,
-                                  const NSOSegmentHeader& header) {
-    std::vector<u8> uncompressed_data =
-        Common::Compression::DecompressDataLZ4(compressed_data, header.size);
+constexpr u32 PageAlignSize(u32 size) {
+    return static_cast<u32>((size + Core::Memory::CITRON_PAGEMASK) & ~Core::Memory::CITRON_PAGEMASK);
+}
+
+/// Size of the program built from an NSO image, with the arguments passed to it but without bss.
+size_t GetProgramSize(const NSOImage& image, bool should_pass_arguments) {
+    size_t program_size = image.program_image.size();
+    if (should_pass_arguments && !Settings::values.program_args.GetValue().empty()) {
+        program_size += NSO_ARGUMENT_DATA_ALLOCATION_SIZE;
+    }
+    return program_size;
+}
+
+/// Reads the header of an NSO and allocates its program image, without decoding any segment.
+std::optional<NSOImage> AllocateImage(const FileSys::VfsFile& nso_file) {
+    if (nso_file.GetSize() < sizeof(NSOHeader)) {
+        return std::nullopt;
+    }
+
+    NSOImage image{};
+    if (sizeof(NSOHeader) != nso_file.ReadObject(&image.header)) {
+        return std::nullopt;
+    }
+
+    if (image.header.magic != Common::MakeMagic('N', 'S', 'O', '0')) {
+        return std::nullopt;
+    }
+
+    size_t image_size = 0;
+    for (const auto& segment : image.header.segments) {
+        image_size = std::max(image_size, size_t{segment.location} + segment.size);
+    }
+    image.program_image.resize(image_size);
+    return image;
+}
+
+/// Decodes a segment straight into its place in the program image.
+bool DecodeSegment(const FileSys::VfsFile& nso_file, NSOImage& image, size_t segment_num) {
+    const NSOHeader& header = image.header;
+    const NSOSegmentHeader& segment = header.segments[segment_num];
+    const u32 file_size = header.segments_compressed_size[segment_num];
+    u8* const data = image.program_image.data() + segment.location;
+
+    if (header.IsSegmentCompressed(segment_num)) {
+        // Decompress from the file data in place when it is mapped.
+        Common::ScratchBuffer<u8> compressed_data;
+        std::span<const u8> source = nso_file.ReadView(file_size, segment.offset);
+        if (source.size() != file_size) {
+            compressed_data.resize_destructive(file_size);
+            source = std::span<const u8>(
+                compressed_data.data(),
+                nso_file.Read(compressed_data.data(), file_size, segment.offset));
+        }
 
-    ASSERT_MSG(uncompressed_data.size() == header.size, "{} != {}", header.size,
-               uncompressed_data.size());
+        const int decompressed_size = Common::Compression::DecompressDataLZ4(
+            data, segment.size, source.data(), source.size());
+        if (decompressed_size != static_cast<int>(segment.size)) {
+            LOG_ERROR(Loader, "Failed to decompress segment {} of {}: {} != {}", segment_num,
+                      nso_file.GetName(), decompressed_size, segment.size);
+            return false;
+        }
+    } else {
+        nso_file.Read(data, std::min(file_size, segment.size), segment.offset);
+    }
+
+    if (Settings::values.verify_nso_hashes.GetValue() && header.IsSegmentHashChecked(segment_num)) {
+        NSOHeader::SHA256Hash hash;
+        mbedtls_sha256_ret(data, segment.size, hash.data(), 0);
+        if (hash != header.segment_hashes[segment_num]) {
+            LOG_ERROR(Loader, "Hash mismatch in segment {} of {}", segment_num,
+                      nso_file.GetName());
+            return false;
+        }
+    }
 
-    return uncompressed_data;
+    return true;
 }
 
-constexpr u32 PageAlignSize(u32 size) {
-    return static_cast<u32>((size + Core::Memory::CITRON_PAGEMASK) & ~Core::Memory::CITRON_PAGEMASK);
+std::vector<std::optional<NSOImage>> DecodeImages(
+    std::span<const FileSys::VfsFile* const> nso_files) {
+    struct Job {
+        size_t module;
+        size_t segment;
+        u32 size;
+    };
+
+    std::vector<std::optional<NSOImage>> images(nso_files.size());
+    std::vector<Job> jobs;
+    for (size_t module = 0; module < nso_files.size(); ++module) {
+        if (nso_files[module] == nullptr) {
+            continue;
+        }
+        images[module] = AllocateImage(*nso_files[module]);
+        if (!images[module]) {
+            continue;
+        }
+        for (size_t segment = 0; segment < 3; ++segment) {
+            jobs.push_back({module, segment, images[module]->header.segments[segment].size});
+        }
+    }
+
+    // Each job only writes its own segment and result, so they need no synchronization.
+    std::vector<std::array<bool, 3>> results(nso_files.size());
+    const auto run_job = [&](const Job& job) {
+        results[job.module][job.segment] =
+            DecodeSegment(*nso_files[job.module], *images[job.module], job.segment);
+    };
+
+    const size_t num_workers =
+        std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1U), jobs.size());
+    if (num_workers <= 1) {
+        std::ranges::for_each(jobs, run_job);
+    } else {
+        // Start the largest segments first, so a big text segment doesn't finish last alone.
+        std::ranges::sort(jobs, std::greater{}, &Job::size);
+        Common::ThreadWorker workers(num_workers, "NsoDecoder");
+        for (const Job& job : jobs) {
+            workers.QueueWork([&run_job, job] { run_job(job); });
+        }
+        workers.WaitForRequests();
+    }
+
+    for (size_t module = 0; module < nso_files.size(); ++module) {
+        if (!std::ranges::all_of(results[module], std::identity{})) {
+            images[module].reset();
+        }
+    }
+    return images;
 }
 } // Anonymous namespace
 
@@ -58,6 +179,11 @@ bool NSOHeader::IsSegmentCompressed(size_t segment_num) const {
     return ((flags >> segment_num) & 1) != 0;
 }
 
+bool NSOHeader::IsSegmentHashChecked(size_t segment_num) const {
+    ASSERT_MSG(segment_num < 3, "Invalid segment {}", segment_num);
+    return ((flags >> (segment_num + 3)) & 1) != 0;
+}
+
 AppLoader_NSO::AppLoader_NSO(FileSys::VirtualFile file_) : AppLoader(std::move(file_)) {}
 
 FileType AppLoader_NSO::IdentifyType(const FileSys::VirtualFile& in_file) {
@@ -73,29 +199,74 @@ FileType AppLoader_NSO::IdentifyType(const FileSys::VirtualFile& in_file) {
     return FileType::NSO;
 }
 
+std::vector<std::optional<NSOImage>> AppLoader_NSO::DecodeModules(
+    std::span<const FileSys::VirtualFile> nso_files) {
+    std::vector<const FileSys::VfsFile*> files(nso_files.size());
+    std::ranges::transform(nso_files, files.begin(), [](const auto& file) { return file.get(); });
+    return DecodeImages(files);
+}
+
 std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::System& system,
                                                const FileSys::VfsFile& nso_file, VAddr load_base,
                                                bool should_pass_arguments, bool load_into_process,
                                                std::optional<FileSys::PatchManager> pm,
                                                std::vector<Core::NCE::Patcher>* patches,
                                                s32 patch_index) {
-    if (nso_file.GetSize() < sizeof(NSOHeader)) {
+    const std::array files{&nso_file};
+    auto images = DecodeImages(files);
+    if (!images[0]) {
         return std::nullopt;
     }
+    return LoadModule(process, system, std::move(*images[0]), nso_file.GetName(), load_base,
+                      should_pass_arguments, load_into_process, std::move(pm), patches,
+                      patch_index);
+}
 
-    NSOHeader nso_header{};
-    if (sizeof(NSOHeader) != nso_file.ReadObject(&nso_header)) {
-        return std::nullopt;
+std::optional<VAddr> AppLoader_NSO::LayoutModule(const NSOImage& image, VAddr load_base,
+                                                 bool should_pass_arguments,
+                                                 std::vector<Core::NCE::Patcher>* patches,
+                                                 s32 patch_index) {
+    const NSOHeader& nso_header = image.header;
+
+    // Same size as the image LoadModule builds: arguments, then bss, page aligned
+    const size_t program_size = GetProgramSize(image, should_pass_arguments);
+    const u32 image_size{
+        PageAlignSize(static_cast<u32>(program_size) + nso_header.segments[2].bss_size)};
+
+#ifdef HAS_NCE
+    if (patches) {
+        const Kernel::CodeSet::Segment code{
+            .offset = nso_header.segments[0].location,
+            .addr = nso_header.segments[0].location,
+            .size = PageAlignSize(nso_header.segments[0].size),
+        };
+        // Patch SVCs and MRS calls in the guest code
+        auto* patch = &patches->operator[](patch_index);
+        while (!patch->PatchText(image.program_image, image_size, code)) {
+            patch = &patches->emplace_back();
+        }
     }
+#endif
 
-    if (nso_header.magic != Common::MakeMagic('N', 'S', 'O', '0')) {
-        return std::nullopt;
+    return load_base + image_size;
+}
+
+std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::System& system,
+                                               NSOImage image, std::string_view name,
+                                               VAddr load_base, bool should_pass_arguments,
+                                               bool load_into_process,
+                                               std::optional<FileSys::PatchManager> pm,
+                                               std::vector<Core::NCE::Patcher>* patches,
+                                               s32 patch_index) {
+    if (!load_into_process) {
+        return LayoutModule(image, load_base, should_pass_arguments, patches, patch_index);
     }
+    const NSOHeader& nso_header = image.header;
 
     // Allocate some space at the beginning if we are patching in PreText mode.
     const size_t module_start = [&]() -> size_t {
 #ifdef HAS_NCE
-        if (patches && load_into_process) {
+        if (patches) {
             auto* patch = &patches->operator[](patch_index);
             if (patch->GetPatchMode() == Core::NCE::PatchMode::PreText) {
                 return patch->GetSectionSize();
@@ -105,19 +276,23 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
         return 0;
     }();
 
-    // Build program image
+    // Build program image, sized up front for the arguments and bss
+    const size_t segments_size = image.program_image.size();
+    u32 image_size{PageAlignSize(
+        static_cast<u32>(module_start + GetProgramSize(image, should_pass_arguments)) +
+        nso_header.segments[2].bss_size)};
     Kernel::CodeSet codeset;
     Kernel::PhysicalMemory program_image;
+    if (module_start == 0) {
+        program_image = std::move(image.program_image);
+        program_image.resize(image_size);
+    } else {
+        // The patch section goes before the code, the decoded image is copied once behind it
+        program_image.resize(image_size);
+        std::memcpy(program_image.data() + module_start, image.program_image.data(),
+                    segments_size);
+    }
     for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
-        std::vector<u8> data = nso_file.ReadBytes(nso_header.segments_compressed_size[i],
-                                                  nso_header.segments[i].offset);
-        if (nso_header.IsSegmentCompressed(i)) {
-            data = DecompressSegment(data, nso_header.segments[i]);
-        }
-        program_image.resize(module_start + nso_header.segments[i].location +
-                             static_cast<u32>(data.size()));
-        std::memcpy(program_image.data() + module_start + nso_header.segments[i].location,
-                    data.data(), data.size());
         codeset.segments[i].addr = module_start + nso_header.segments[i].location;
         codeset.segments[i].offset = module_start + nso_header.segments[i].location;
         codeset.segments[i].size = nso_header.segments[i].size;
@@ -129,25 +304,19 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
         codeset.DataSegment().size += NSO_ARGUMENT_DATA_ALLOCATION_SIZE;
         NSOArgumentHeader args_header{
             NSO_ARGUMENT_DATA_ALLOCATION_SIZE, static_cast<u32_le>(arg_data.size()), {}};
-        const auto end_offset = program_image.size();
-        program_image.resize(static_cast<u32>(program_image.size()) +
-                             NSO_ARGUMENT_DATA_ALLOCATION_SIZE);
+        const auto end_offset = module_start + segments_size;
         std::memcpy(program_image.data() + end_offset, &args_header, sizeof(NSOArgumentHeader));
         std::memcpy(program_image.data() + end_offset + sizeof(NSOArgumentHeader), arg_data.data(),
                     arg_data.size());
     }
 
     codeset.DataSegment().size += nso_header.segments[2].bss_size;
-    u32 image_size{
-        PageAlignSize(static_cast<u32>(program_image.size()) + nso_header.segments[2].bss_size)};
-    program_image.resize(image_size);
 
     for (std::size_t i = 0; i < nso_header.segments.size(); ++i) {
         codeset.segments[i].size = PageAlignSize(codeset.segments[i].size);
     }
 
     // Apply patches if necessary
-    const auto name = nso_file.GetName();
     if (pm && (pm->HasNSOPatch(nso_header.build_id, name) || Settings::values.dump_nso)) {
         std::span<u8> patchable_section(program_image.data() + module_start,
                                         program_image.size() - module_start);
@@ -156,21 +325,15 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
         std::memcpy(pi_header.data() + sizeof(NSOHeader), patchable_section.data(),
                     patchable_section.size());
 
-        pi_header = pm->PatchNSO(pi_header, name);
+        pi_header = pm->PatchNSO(pi_header, std::string(name));
 
         std::copy(pi_header.begin() + sizeof(NSOHeader), pi_header.end(), patchable_section.data());
     }
 
 #ifdef HAS_NCE
-    // If we are computing the process code layout and using nce backend, patch.
     const auto& code = codeset.CodeSegment();
     auto* patch = patches ? &patches->operator[](patch_index) : nullptr;
-    if (patch && !load_into_process) {
-        // Patch SVCs and MRS calls in the guest code
-        while (!patch->PatchText(program_image, code)) {
-            patch = &patches->emplace_back();
-        }
-    } else if (patch) {
+    if (patch) {
         // Relocate code patch and copy to the program_image.
         if (patch->RelocateAndCopy(load_base, code, program_image, &process.GetPostHandlers())) {
             // Update patch section.
@@ -185,11 +348,6 @@ std::optional<VAddr> AppLoader_NSO::LoadModule(Kernel::KProcess& process, Core::
     }
 #endif
 
-    // If we aren't actually loading (i.e. just computing the process code layout), we are done
-    if (!load_into_process) {
-        return load_base + image_size;
-    }
-
     // Apply cheats if they exist and the program has a valid title ID
     if (pm) {
         system.SetApplicationProcessBuildID(nso_header.build_id);
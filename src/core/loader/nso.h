@@ -5,10 +5,14 @@
 
 #include <array>
 #include <optional>
+#include <span>
+#include <string_view>
 #include <type_traits>
+#include <vector>
 #include "common/common_types.h"
 #include "common/swap.h"
 #include "core/file_sys/patch_manager.h"
+#include "core/hle/kernel/physical_memory.h"
 #include "core/loader/loader.h"
 
 namespace Core {
@@ -58,6 +62,7 @@ struct NSOHeader {
     std::array<SHA256Hash, 3> segment_hashes;
 
     bool IsSegmentCompressed(size_t segment_num) const;
+    bool IsSegmentHashChecked(size_t segment_num) const;
 };
 static_assert(sizeof(NSOHeader) == 0x100, "NSOHeader has incorrect size.");
 static_assert(std::is_trivially_copyable_v<NSOHeader>, "NSOHeader must be trivially copyable.");
@@ -71,6 +76,12 @@ struct NSOArgumentHeader {
 };
 static_assert(sizeof(NSOArgumentHeader) == 0x20, "NSOArgumentHeader has incorrect size.");
 
+/// An NSO with its segments decompressed at their location in the program image, without bss.
+struct NSOImage {
+    NSOHeader header;
+    Kernel::PhysicalMemory program_image;
+};
+
 /// Loads an NSO file
 class AppLoader_NSO final : public AppLoader {
 public:
@@ -89,6 +100,17 @@ public:
         return IdentifyType(file);
     }
 
+    /**
+     * Decompresses the segments of several NSOs at once, each segment straight into its place in
+     * the program image on a worker thread. Segment hashes are checked if verify_nso_hashes is set.
+     *
+     * @param nso_files The NSOs to decode, which may be nullptr.
+     *
+     * @return The image of each NSO, std::nullopt for null, invalid or corrupted NSOs.
+     */
+    static std::vector<std::optional<NSOImage>> DecodeModules(
+        std::span<const FileSys::VirtualFile> nso_files);
+
     static std::optional<VAddr> LoadModule(Kernel::KProcess& process, Core::System& system,
                                            const FileSys::VfsFile& nso_file, VAddr load_base,
                                            bool should_pass_arguments, bool load_into_process,
@@ -96,6 +118,24 @@ public:
                                            std::vector<Core::NCE::Patcher>* patches = nullptr,
                                            s32 patch_index = -1);
 
+    /**
+     * Computes where the module after an NSO image would be loaded, without copying the image.
+     * With NCE, the SVCs and MRS calls of its code are collected in the patchers.
+     *
+     * @return The address following the module, std::nullopt on failure.
+     */
+    static std::optional<VAddr> LayoutModule(const NSOImage& image, VAddr load_base,
+                                             bool should_pass_arguments,
+                                             std::vector<Core::NCE::Patcher>* patches = nullptr,
+                                             s32 patch_index = -1);
+
+    static std::optional<VAddr> LoadModule(Kernel::KProcess& process, Core::System& system,
+                                           NSOImage image, std::string_view name, VAddr load_base,
+                                           bool should_pass_arguments, bool load_into_process,
+                                           std::optional<FileSys::PatchManager> pm = {},
+                                           std::vector<Core::NCE::Patcher>* patches = nullptr,
+                                           s32 patch_index = -1);
+
     LoadResult Load(Kernel::KProcess& process, Core::System& system) override;
 
     ResultStatus ReadNSOModules(Modules& out_modules) override;
@@ -14,6 +14,7 @@
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/settings.h"
+#include "core/file_sys/fssystem/fssystem_block_cache.h"
 #include "core/perf_stats.h"
 
 using namespace std::chrono_literals;
@@ -99,12 +100,18 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     const auto system_us_per_second = (current_system_time_us - reset_point_system_us) / interval;
     const auto current_frames = static_cast<double>(game_frames.load(std::memory_order_relaxed));
     const auto current_fps = current_frames / interval;
+    const auto cache_stats = FileSys::BlockCache::GetInstance().GetStats();
+    const auto cache_hits = cache_stats.hits - reset_point_cache_hits;
+    const auto cache_lookups = cache_hits + cache_stats.misses - reset_point_cache_misses;
     const PerfStatsResults results{
         .system_fps = static_cast<double>(system_frames) / interval,
         .average_game_fps = (current_fps + previous_fps) / 2.0,
         .frametime = duration_cast<DoubleSecs>(accumulated_frametime).count() /
                      static_cast<double>(system_frames),
         .emulation_speed = system_us_per_second.count() / 1'000'000.0,
+        .nca_cache_hit_rate = cache_lookups != 0 ? static_cast<double>(cache_hits) /
+                                                       static_cast<double>(cache_lookups)
+                                                 : -1.0,
     };
 
     // Reset counters
@@ -114,6 +121,8 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     system_frames = 0;
     game_frames.store(0, std::memory_order_relaxed);
     previous_fps = current_fps;
+    reset_point_cache_hits = cache_stats.hits;
+    reset_point_cache_misses = cache_stats.misses;
 
     return results;
 }
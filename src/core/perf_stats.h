@@ -21,6 +21,8 @@ struct PerfStatsResults {
     double frametime;
     /// Ratio of walltime / emulated time elapsed
     double emulation_speed;
+    /// Ratio of NCA block cache lookups that hit, negative if there were none
+    double nca_cache_hit_rate;
 };
 
 /**
@@ -82,6 +84,9 @@ private:
     Clock::duration previous_frame_length = Clock::duration::zero();
     /// Previously computed fps
     double previous_fps = 0;
+    /// NCA block cache lookups counted when the cumulative counters were reset
+    u64 reset_point_cache_hits = 0;
+    u64 reset_point_cache_misses = 0;
 };
 
 class SpeedLimiter {
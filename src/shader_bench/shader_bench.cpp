@@ -0,0 +1,519 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Recompiles every shader of a pipeline cache file through the shader recompiler, without a GPU,
+// and reports where the time is spent. Useful to catch compile time regressions in the IR passes
+// and the backends.
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/cityhash.h"
+#include "common/common_types.h"
+#include "common/fs/file.h"
+#include "common/fs/path_util.h"
+#include "common/logging/backend.h"
+#include "common/logging/log.h"
+#include "common/polyfill_thread.h"
+#include "common/thread_worker.h"
+#include "shader_recompiler/backend/bindings.h"
+#include "shader_recompiler/backend/glasm/emit_glasm.h"
+#include "shader_recompiler/backend/glsl/emit_glsl.h"
+#include "shader_recompiler/backend/spirv/emit_spirv.h"
+#include "shader_recompiler/environment.h"
+#include "shader_recompiler/exception.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/frontend/maxwell/control_flow.h"
+#include "shader_recompiler/frontend/maxwell/translate_program.h"
+#include "shader_recompiler/host_translate_info.h"
+#include "shader_recompiler/object_pool.h"
+#include "shader_recompiler/profile.h"
+#include "shader_recompiler/program_header.h"
+#include "shader_recompiler/runtime_info.h"
+#include "video_core/shader_environment.h"
+
+#include <getopt.h>
+
+namespace {
+
+using Shader::Maxwell::TranslateStep;
+using Shader::Maxwell::TranslateTimings;
+using VideoCommon::FileEnvironment;
+
+constexpr size_t NUM_PROGRAMS = 6;
+
+enum class Backend : u32 {
+    SPIRV,
+    GLSL,
+    GLASM,
+    Count,
+};
+
+constexpr size_t NUM_BACKENDS = static_cast<size_t>(Backend::Count);
+
+constexpr std::array<std::string_view, NUM_BACKENDS> BACKEND_NAMES{"spirv", "glsl", "glasm"};
+
+struct ShaderPools {
+    Shader::ObjectPool<Shader::IR::Inst> inst{8192};
+    Shader::ObjectPool<Shader::IR::Block> block{32};
+    Shader::ObjectPool<Shader::Maxwell::Flow::Block> flow_block{32};
+};
+
+/// Pipeline read from the cache file, graphics pipelines keep the unique hashes of their key.
+struct Pipeline {
+    std::array<u64, NUM_PROGRAMS> unique_hashes{};
+    std::vector<FileEnvironment> envs;
+    /// Hashes of the code emitted for each stage and backend, in emission order
+    std::vector<u64> digests;
+    bool is_compute{};
+};
+
+struct Statistics {
+    TranslateTimings translate;
+    std::chrono::nanoseconds cfg{};
+    std::array<std::chrono::nanoseconds, NUM_BACKENDS> emit{};
+    std::array<size_t, NUM_BACKENDS> emitted{};
+    size_t programs{};
+    size_t ir_instructions{};
+    size_t failures{};
+
+    void Merge(const Statistics& other) {
+        for (size_t step = 0; step < translate.steps.size(); ++step) {
+            translate.steps[step] += other.translate.steps[step];
+            translate.instruction_deltas[step] += other.translate.instruction_deltas[step];
+        }
+        translate.hoisted_instructions += other.translate.hoisted_instructions;
+        translate.programs_with_hoisting += other.translate.programs_with_hoisting;
+        cfg += other.cfg;
+        for (size_t backend = 0; backend < NUM_BACKENDS; ++backend) {
+            emit[backend] += other.emit[backend];
+            emitted[backend] += other.emitted[backend];
+        }
+        programs += other.programs;
+        ir_instructions += other.ir_instructions;
+        failures += other.failures;
+    }
+};
+
+/// Everything the recompilation needs to know about the fake host.
+struct Host {
+    Shader::Profile profile;
+    Shader::HostTranslateInfo info;
+};
+
+Host MakeHost(bool lowered) {
+    // Close to a recent desktop GPU, lowered hosts lack the optional types so they get emulated
+    return Host{
+        .profile =
+            Shader::Profile{
+                .supported_spirv = 0x00010600,
+                .unified_descriptor_binding = true,
+                .support_descriptor_aliasing = true,
+                .support_int8 = true,
+                .support_int16 = !lowered,
+                .support_int64 = !lowered,
+                .support_vertex_instance_id = false,
+                .support_float_controls = true,
+                .support_separate_denorm_behavior = true,
+                .support_separate_rounding_mode = true,
+                .support_fp16_denorm_preserve = true,
+                .support_fp32_denorm_preserve = true,
+                .support_fp16_denorm_flush = true,
+                .support_fp32_denorm_flush = true,
+                .support_fp16_signed_zero_nan_preserve = true,
+                .support_fp32_signed_zero_nan_preserve = true,
+                .support_fp64_signed_zero_nan_preserve = true,
+                .support_explicit_workgroup_layout = true,
+                .support_vote = true,
+                .support_viewport_index_layer_non_geometry = true,
+                .support_viewport_mask = false,
+                .support_typeless_image_loads = true,
+                .support_demote_to_helper_invocation = true,
+                .support_int64_atomics = !lowered,
+                .support_derivative_control = true,
+                .support_geometry_shader_passthrough = false,
+                .support_native_ndc = true,
+                .support_gl_nv_gpu_shader_5 = false,
+                .support_gl_amd_gpu_shader_half_float = false,
+                .support_gl_texture_shadow_lod = true,
+                .support_gl_warp_intrinsics = false,
+                .support_gl_variable_aoffi = true,
+                .support_gl_sparse_textures = true,
+                .support_gl_derivative_control = true,
+                .support_scaled_attributes = true,
+                .support_multi_viewport = true,
+                .support_geometry_streams = true,
+                .warp_size_potentially_larger_than_guest = false,
+                .lower_left_origin_mode = false,
+                .need_declared_frag_colors = false,
+                .need_fastmath_off = false,
+                .need_gather_subpixel_offset = false,
+                .min_ssbo_alignment = 16,
+                .max_user_clip_distances = 8,
+            },
+        .info =
+            Shader::HostTranslateInfo{
+                .support_float64 = !lowered,
+                .support_float16 = !lowered,
+                .support_int64 = !lowered,
+                .needs_demote_reorder = false,
+                .support_snorm_render_buffer = true,
+                .support_viewport_index_layer = true,
+                .min_ssbo_alignment = 16,
+                .support_geometry_shader_passthrough = false,
+                .support_conditional_barrier = !lowered,
+            },
+    };
+}
+
+size_t CountInstructions(const Shader::IR::Program& program) {
+    size_t count{};
+    for (const Shader::IR::Block* const block : program.blocks) {
+        count += block->Instructions().size();
+    }
+    return count;
+}
+
+/// Builds the runtime info of a stage from the stage before it. Pipeline state that isn't part
+/// of the environments, like vertex attribute types or alpha testing, keeps its defaults.
+Shader::RuntimeInfo MakeRuntimeInfo(const Shader::IR::Program* previous_program) {
+    Shader::RuntimeInfo info;
+    if (previous_program) {
+        info.previous_stage_stores = previous_program->info.stores;
+        info.previous_stage_legacy_stores_mapping = previous_program->info.legacy_stores_mapping;
+        if (previous_program->is_geometry_passthrough) {
+            info.previous_stage_stores.mask |= previous_program->info.passthrough.mask;
+        }
+    } else {
+        info.previous_stage_stores.mask.set();
+    }
+    info.input_topology = Shader::InputTopology::Triangles;
+    return info;
+}
+
+template <typename Func>
+auto Timed(std::chrono::nanoseconds& elapsed, Func&& func) {
+    const auto start{std::chrono::steady_clock::now()};
+    auto result{func()};
+    elapsed += std::chrono::steady_clock::now() - start;
+    return result;
+}
+
+/// Emits the program and returns a hash of the emitted code.
+u64 Emit(const Host& host, Backend backend, const Shader::RuntimeInfo& runtime_info,
+         Shader::IR::Program& program, Shader::Backend::Bindings& bindings, Statistics& stats) {
+    auto& elapsed{stats.emit[static_cast<size_t>(backend)]};
+    ++stats.emitted[static_cast<size_t>(backend)];
+    switch (backend) {
+    case Backend::SPIRV: {
+        const auto code{Timed(elapsed, [&] {
+            return Shader::Backend::SPIRV::EmitSPIRV(host.profile, runtime_info, program, bindings);
+        })};
+        return Common::CityHash64(reinterpret_cast<const char*>(code.data()),
+                                  code.size() * sizeof(u32));
+    }
+    case Backend::GLSL: {
+        const auto code{Timed(elapsed, [&] {
+            return Shader::Backend::GLSL::EmitGLSL(host.profile, runtime_info, program, bindings);
+        })};
+        return Common::CityHash64(code.data(), code.size());
+    }
+    case Backend::GLASM: {
+        const auto code{Timed(elapsed, [&] {
+            return Shader::Backend::GLASM::EmitGLASM(host.profile, runtime_info, program,
+                                                     bindings);
+        })};
+        return Common::CityHash64(code.data(), code.size());
+    }
+    case Backend::Count:
+        break;
+    }
+    return 0;
+}
+
+Shader::IR::Program Translate(const Host& host, ShaderPools& pools, Shader::Environment& env,
+                              u32 cfg_offset, bool exits_to_dispatcher, Statistics& stats) {
+    auto cfg{Timed(stats.cfg, [&] {
+        return std::make_unique<Shader::Maxwell::Flow::CFG>(env, pools.flow_block, cfg_offset,
+                                                            exits_to_dispatcher);
+    })};
+    auto program{Shader::Maxwell::TranslateProgram(pools.inst, pools.block, env, *cfg, host.info,
+                                                   &stats.translate)};
+    ++stats.programs;
+    stats.ir_instructions += CountInstructions(program);
+    return program;
+}
+
+/// Mirrors the pipeline caches, translating the stages of a pipeline and emitting them in order.
+void Recompile(const Host& host, Pipeline& pipeline, Backend backend, Statistics& stats) {
+    ShaderPools pools;
+    Shader::Backend::Bindings bindings;
+    if (pipeline.is_compute) {
+        FileEnvironment& env{pipeline.envs.front()};
+        auto program{Translate(host, pools, env, env.StartAddress(), false, stats)};
+        pipeline.digests.push_back(Emit(host, backend, {}, program, bindings, stats));
+        return;
+    }
+
+    std::array<Shader::IR::Program, NUM_PROGRAMS> programs;
+    const bool uses_vertex_a{pipeline.unique_hashes[0] != 0};
+    const bool uses_vertex_b{pipeline.unique_hashes[1] != 0};
+    size_t env_index{};
+    for (size_t index = 0; index < NUM_PROGRAMS; ++index) {
+        if (pipeline.unique_hashes[index] == 0) {
+            continue;
+        }
+        FileEnvironment& env{pipeline.envs[env_index++]};
+        const u32 cfg_offset{static_cast<u32>(env.StartAddress() + sizeof(Shader::ProgramHeader))};
+        auto program{Translate(host, pools, env, cfg_offset, index == 0, stats)};
+        if (uses_vertex_a && index == 1) {
+            programs[index] = Shader::Maxwell::MergeDualVertexPrograms(programs[0], program, env);
+        } else {
+            programs[index] = std::move(program);
+        }
+    }
+
+    const Shader::IR::Program* previous_stage{};
+    for (size_t index = uses_vertex_a && uses_vertex_b ? 1 : 0; index < NUM_PROGRAMS; ++index) {
+        if (pipeline.unique_hashes[index] == 0 || index == 0) {
+            continue;
+        }
+        Shader::IR::Program& program{programs[index]};
+        const auto runtime_info{MakeRuntimeInfo(previous_stage)};
+        Shader::Maxwell::ConvertLegacyToGeneric(program, runtime_info);
+        pipeline.digests.push_back(Emit(host, backend, runtime_info, program, bindings, stats));
+        previous_stage = &program;
+    }
+}
+
+std::optional<Backend> ParseBackend(std::string_view name) {
+    const auto it{std::ranges::find(BACKEND_NAMES, name)};
+    if (it == BACKEND_NAMES.end()) {
+        return std::nullopt;
+    }
+    return static_cast<Backend>(std::distance(BACKEND_NAMES.begin(), it));
+}
+
+double Milliseconds(std::chrono::nanoseconds duration) {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+void PrintReport(const Statistics& stats, std::chrono::nanoseconds wall_time, size_t num_threads) {
+    const double seconds{std::chrono::duration<double>(wall_time).count()};
+    fmt::print("Recompiled {} programs on {} threads in {:.1f} ms, {:.1f} programs/s\n",
+               stats.programs, num_threads, Milliseconds(wall_time),
+               static_cast<double>(stats.programs) / seconds);
+    fmt::print("IR instructions after optimization: {} ({:.1f} per program)\n",
+               stats.ir_instructions,
+               static_cast<double>(stats.ir_instructions) /
+                   static_cast<double>(std::max<size_t>(stats.programs, 1)));
+    const TranslateTimings& translate{stats.translate};
+    fmt::print("Instructions hoisted out of loops: {} in {} programs ({:.1f} per program)\n",
+               translate.hoisted_instructions, translate.programs_with_hoisting,
+               static_cast<double>(translate.hoisted_instructions) /
+                   static_cast<double>(std::max<size_t>(translate.programs_with_hoisting, 1)));
+    if (stats.failures != 0) {
+        fmt::print("Failed pipeline builds: {}\n", stats.failures);
+    }
+
+    // Times are summed over all threads, IR deltas are the instructions added or removed
+    fmt::print("\n{:<28} {:>12} {:>12} {:>12}\n", "Step", "Total (ms)", "Per program (us)",
+               "IR delta");
+    const auto print_row{[&](std::string_view name, std::chrono::nanoseconds elapsed,
+                             size_t count, std::string_view delta) {
+        const double per_item{Milliseconds(elapsed) * 1000.0 /
+                              static_cast<double>(std::max<size_t>(count, 1))};
+        fmt::print("{:<28} {:>12.1f} {:>12.2f} {:>12}\n", name, Milliseconds(elapsed), per_item,
+                   delta);
+    }};
+    print_row("ControlFlowGraph", stats.cfg, stats.programs, "");
+    for (size_t step = 0; step < stats.translate.steps.size(); ++step) {
+        print_row(Shader::Maxwell::NameOf(static_cast<TranslateStep>(step)),
+                  stats.translate.steps[step], stats.programs,
+                  fmt::format("{:+}", stats.translate.instruction_deltas[step]));
+    }
+    for (size_t backend = 0; backend < NUM_BACKENDS; ++backend) {
+        if (stats.emitted[backend] != 0) {
+            print_row(fmt::format("Emit {}", BACKEND_NAMES[backend]), stats.emit[backend],
+                      stats.emitted[backend], "");
+        }
+    }
+}
+
+/// Writes the digests of every pipeline, comparing them between builds catches changes in the
+/// emitted code, like an optimization pass changing its output.
+bool WriteDigests(const std::filesystem::path& path, std::span<const Pipeline> pipelines) {
+    std::string text;
+    for (size_t index = 0; index < pipelines.size(); ++index) {
+        const Pipeline& pipeline{pipelines[index]};
+        text += fmt::format("{:5} {}", index, pipeline.is_compute ? "compute " : "graphics");
+        for (const u64 digest : pipeline.digests) {
+            text += fmt::format(" {:016x}", digest);
+        }
+        text += '\n';
+    }
+    return Common::FS::WriteStringToFile(path, Common::FS::FileType::TextFile, text) ==
+           text.size();
+}
+
+void PrintHelp(const char* argv0) {
+    fmt::print("Usage: {} [options] <pipeline cache file>\n"
+               "-t, --threads=N        Number of compiler threads, defaults to one per core\n"
+               "-b, --backend=NAME     Backend to emit: spirv, glsl or glasm, can be repeated\n"
+               "-l, --lowered          Emulate a host without 64-bit and 16-bit type support\n"
+               "-o, --output=FILE      Write a hash of the code emitted for each pipeline to FILE\n"
+               "-h, --help             Display this help and exit\n",
+               argv0);
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv) {
+    Common::Log::Initialize();
+    Common::Log::SetColorConsoleBackendEnabled(true);
+    Common::Log::Start();
+
+    size_t num_threads{std::max(std::thread::hardware_concurrency(), 1U)};
+    std::vector<Backend> backends;
+    bool lowered{};
+    std::filesystem::path output_path;
+
+    static struct option long_options[] = {
+        {"threads", required_argument, 0, 't'},
+        {"backend", required_argument, 0, 'b'},
+        {"lowered", no_argument, 0, 'l'},
+        {"output", required_argument, 0, 'o'},
+        {"help", no_argument, 0, 'h'},
+        {0, 0, 0, 0},
+    };
+    int option_index = 0;
+    int arg;
+    while ((arg = getopt_long(argc, argv, "t:b:lo:h", long_options, &option_index)) != -1) {
+        switch (static_cast<char>(arg)) {
+        case 't':
+            num_threads = std::max<size_t>(std::strtoul(optarg, nullptr, 0), 1);
+            break;
+        case 'b': {
+            const auto backend{ParseBackend(optarg)};
+            if (!backend) {
+                LOG_ERROR(Shader, "Unknown backend {}", optarg);
+                PrintHelp(argv[0]);
+                return -1;
+            }
+            backends.push_back(*backend);
+            break;
+        }
+        case 'l':
+            lowered = true;
+            break;
+        case 'o':
+            output_path = optarg;
+            break;
+        case 'h':
+            PrintHelp(argv[0]);
+            return 0;
+        default:
+            PrintHelp(argv[0]);
+            return -1;
+        }
+    }
+    if (optind != argc - 1) {
+        PrintHelp(argv[0]);
+        return -1;
+    }
+    if (backends.empty()) {
+        backends.push_back(Backend::SPIRV);
+    }
+
+    const std::filesystem::path cache_path{argv[optind]};
+    const auto cache_version{VideoCommon::ReadPipelineCacheVersion(cache_path)};
+    if (!cache_version) {
+        LOG_ERROR(Shader, "{} is not a pipeline cache file",
+                  Common::FS::PathToUTF8String(cache_path));
+        return -1;
+    }
+
+    // The loader deletes files it fails to read, only ever hand it a copy
+    const auto copy_path{std::filesystem::temp_directory_path() / "citron_shader_bench.bin"};
+    std::error_code ec;
+    std::filesystem::copy_file(cache_path, copy_path,
+                               std::filesystem::copy_options::overwrite_existing, ec);
+    if (ec) {
+        LOG_ERROR(Shader, "Failed to copy {}: {}", Common::FS::PathToUTF8String(cache_path),
+                  ec.message());
+        return -1;
+    }
+
+    std::vector<Pipeline> pipelines;
+    const auto load_start{std::chrono::steady_clock::now()};
+    VideoCommon::LoadPipelines(
+        std::stop_token{}, copy_path, *cache_version,
+        [&](std::span<const char>, FileEnvironment env) {
+            Pipeline& pipeline{pipelines.emplace_back()};
+            pipeline.envs.push_back(std::move(env));
+            pipeline.is_compute = true;
+        },
+        [&](std::span<const char> key, std::vector<FileEnvironment> envs) {
+            // Both the Vulkan and the OpenGL keys start with the unique hashes of the programs
+            Pipeline pipeline;
+            if (key.size() < sizeof(pipeline.unique_hashes)) {
+                return;
+            }
+            std::memcpy(pipeline.unique_hashes.data(), key.data(),
+                        sizeof(pipeline.unique_hashes));
+            pipeline.envs = std::move(envs);
+            pipelines.push_back(std::move(pipeline));
+        });
+    std::filesystem::remove(copy_path, ec);
+    fmt::print("Loaded {} pipelines (cache version {}) in {:.1f} ms\n", pipelines.size(),
+               *cache_version, Milliseconds(std::chrono::steady_clock::now() - load_start));
+    if (pipelines.empty()) {
+        return -1;
+    }
+
+    const Host host{MakeHost(lowered)};
+    Statistics stats;
+    std::mutex stats_mutex;
+    const auto start{std::chrono::steady_clock::now()};
+    {
+        Common::ThreadWorker workers(num_threads, "ShaderBench");
+        for (Pipeline& pipeline : pipelines) {
+            // Backends of a pipeline run on the same thread, as they share its environments
+            workers.QueueWork([&host, &pipeline, &backends, &stats, &stats_mutex] {
+                Statistics local;
+                for (const Backend backend : backends) {
+                    try {
+                        Recompile(host, pipeline, backend, local);
+                    } catch (const Shader::Exception& exception) {
+                        LOG_ERROR(Shader, "{}", exception.what());
+                        ++local.failures;
+                    }
+                }
+                std::scoped_lock lock{stats_mutex};
+                stats.Merge(local);
+            });
+        }
+        workers.WaitForRequests();
+    }
+    PrintReport(stats, std::chrono::steady_clock::now() - start, num_threads);
+    if (!output_path.empty() && !WriteDigests(output_path, pipelines)) {
+        LOG_ERROR(Shader, "Failed to write {}", Common::FS::PathToUTF8String(output_path));
+        return -1;
+    }
+    return stats.failures == 0 ? 0 : 1;
+}
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <queue>
@@ -19,6 +20,31 @@
 
 namespace Shader::Maxwell {
 namespace {
+s64 CountInstructions(const IR::Program& program) {
+    s64 count{};
+    for (const IR::Block* const block : program.blocks) {
+        count += static_cast<s64>(block->Instructions().size());
+    }
+    return count;
+}
+
+/// Runs a step of the translation, adding its duration and how many instructions it added to the
+/// timings when there are any.
+template <typename Func>
+void RunStep(TranslateTimings* timings, TranslateStep step, const IR::Program& program,
+             Func&& func) {
+    if (!timings) {
+        func();
+        return;
+    }
+    const size_t index{static_cast<size_t>(step)};
+    const s64 num_insts{CountInstructions(program)};
+    const auto start{std::chrono::steady_clock::now()};
+    func();
+    timings->steps[index] += std::chrono::steady_clock::now() - start;
+    timings->instruction_deltas[index] += CountInstructions(program) - num_insts;
+}
+
 IR::BlockList GenerateBlocks(const IR::AbstractSyntaxList& syntax_list) {
     size_t num_syntax_blocks{};
     for (const auto& node : syntax_list) {
@@ -237,10 +263,51 @@ void LowerGeometryPassthrough(const IR::Program& program, const HostTranslateInf
 
 } // Anonymous namespace
 
+std::string_view NameOf(TranslateStep step) {
+    switch (step) {
+    case TranslateStep::BuildSyntaxList:
+        return "BuildSyntaxList";
+    case TranslateStep::LowerTypes:
+        return "LowerTypes";
+    case TranslateStep::SsaRewrite:
+        return "SsaRewrite";
+    case TranslateStep::ConstantPropagation:
+        return "ConstantPropagation";
+    case TranslateStep::GlobalValueNumbering:
+        return "GlobalValueNumbering";
+    case TranslateStep::LoopInvariantCodeMotion:
+        return "LoopInvariantCodeMotion";
+    case TranslateStep::Position:
+        return "Position";
+    case TranslateStep::GlobalMemoryToStorageBuffer:
+        return "GlobalMemoryToStorageBuffer";
+    case TranslateStep::Texture:
+        return "Texture";
+    case TranslateStep::Rescaling:
+        return "Rescaling";
+    case TranslateStep::DeadCodeElimination:
+        return "DeadCodeElimination";
+    case TranslateStep::Verification:
+        return "Verification";
+    case TranslateStep::CollectShaderInfo:
+        return "CollectShaderInfo";
+    case TranslateStep::Layer:
+        return "Layer";
+    case TranslateStep::VendorWorkaround:
+        return "VendorWorkaround";
+    case TranslateStep::Count:
+        break;
+    }
+    return "Invalid";
+}
+
 IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Block>& block_pool,
-                             Environment& env, Flow::CFG& cfg, const HostTranslateInfo& host_info) {
+                             Environment& env, Flow::CFG& cfg, const HostTranslateInfo& host_info,
+                             TranslateTimings* timings) {
     IR::Program program;
-    program.syntax_list = BuildASL(inst_pool, block_pool, env, cfg, host_info);
+    RunStep(timings, TranslateStep::BuildSyntaxList, program, [&] {
+        program.syntax_list = BuildASL(inst_pool, block_pool, env, cfg, host_info);
+    });
     program.blocks = GenerateBlocks(program.syntax_list);
     program.post_order_blocks = PostOrder(program.syntax_list.front());
     program.stage = env.ShaderStage();
@@ -280,37 +347,59 @@ IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool, ObjectPool<IR::Blo
     RemoveUnreachableBlocks(program);
 
     // Replace instructions before the SSA rewrite
-    if (!host_info.support_float64) {
-        Optimization::LowerFp64ToFp32(program);
-    }
-    if (!host_info.support_float16) {
-        Optimization::LowerFp16ToFp32(program);
-    }
-    if (!host_info.support_int64) {
-        Optimization::LowerInt64ToInt32(program);
-    }
-    if (!host_info.support_conditional_barrier) {
-        Optimization::ConditionalBarrierPass(program);
-    }
-    Optimization::SsaRewritePass(program);
-
-    Optimization::ConstantPropagationPass(env, program);
+    RunStep(timings, TranslateStep::LowerTypes, program, [&] {
+        if (!host_info.support_float64) {
+            Optimization::LowerFp64ToFp32(program);
+        }
+        if (!host_info.support_float16) {
+            Optimization::LowerFp16ToFp32(program);
+        }
+        if (!host_info.support_int64) {
+            Optimization::LowerInt64ToInt32(program);
+        }
+        if (!host_info.support_conditional_barrier) {
+            Optimization::ConditionalBarrierPass(program);
+        }
+    });
+    RunStep(timings, TranslateStep::SsaRewrite, program,
+            [&] { Optimization::SsaRewritePass(program); });
+
+    RunStep(timings, TranslateStep::ConstantPropagation, program,
+            [&] { Optimization::ConstantPropagationPass(env, program); });
+    RunStep(timings, TranslateStep::GlobalValueNumbering, program,
+            [&] { Optimization::GlobalValueNumberingPass(program); });
+    RunStep(timings, TranslateStep::LoopInvariantCodeMotion, program, [&] {
+        const size_t num_hoisted{Optimization::LoopInvariantCodeMotionPass(program)};
+        if (timings && num_hoisted != 0) {
+            timings->hoisted_instructions += num_hoisted;
+            ++timings->programs_with_hoisting;
+        }
+    });
 
-    Optimization::PositionPass(env, program);
+    RunStep(timings, TranslateStep::Position, program,
+            [&] { Optimization::PositionPass(env, program); });
 
-    Optimization::GlobalMemoryToStorageBufferPass(program, host_info);
-    Optimization::TexturePass(env, program, host_info);
+    RunStep(timings, TranslateStep::GlobalMemoryToStorageBuffer, program,
+            [&] { Optimization::GlobalMemoryToStorageBufferPass(program, host_info); });
+    RunStep(timings, TranslateStep::Texture, program,
+            [&] { Optimization::TexturePass(env, program, host_info); });
 
     if (Settings::values.resolution_info.active) {
-        Optimization::RescalingPass(program);
+        RunStep(timings, TranslateStep::Rescaling, program,
+                [&] { Optimization::RescalingPass(program); });
     }
-    Optimization::DeadCodeEliminationPass(program);
+    RunStep(timings, TranslateStep::DeadCodeElimination, program,
+            [&] { Optimization::DeadCodeEliminationPass(program); });
     if (Settings::values.renderer_debug) {
-        Optimization::VerificationPass(program);
+        RunStep(timings, TranslateStep::Verification, program,
+                [&] { Optimization::VerificationPass(program); });
     }
-    Optimization::CollectShaderInfoPass(env, program);
-    Optimization::LayerPass(program, host_info);
-    Optimization::VendorWorkaroundPass(program);
+    RunStep(timings, TranslateStep::CollectShaderInfo, program,
+            [&] { Optimization::CollectShaderInfoPass(env, program); });
+    RunStep(timings, TranslateStep::Layer, program,
+            [&] { Optimization::LayerPass(program, host_info); });
+    RunStep(timings, TranslateStep::VendorWorkaround, program,
+            [&] { Optimization::VendorWorkaroundPass(program); });
 
     CollectInterpolationInfo(env, program);
     AddNVNStorageBuffers(program);
@@ -3,6 +3,11 @@
 
 #pragma once
 
+#include <array>
+#include <chrono>
+#include <string_view>
+
+#include "common/common_types.h"
 #include "shader_recompiler/environment.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/program.h"
@@ -16,9 +21,46 @@ struct HostTranslateInfo;
 
 namespace Shader::Maxwell {
 
+/// Steps of TranslateProgram that can be timed.
+enum class TranslateStep : u32 {
+    BuildSyntaxList, ///< Decoding the CFG into structured IR blocks
+    LowerTypes,      ///< Lowering of the types and barriers the host doesn't support
+    SsaRewrite,
+    ConstantPropagation,
+    GlobalValueNumbering,
+    LoopInvariantCodeMotion,
+    Position,
+    GlobalMemoryToStorageBuffer,
+    Texture,
+    Rescaling,
+    DeadCodeElimination,
+    Verification,
+    CollectShaderInfo,
+    Layer,
+    VendorWorkaround,
+    Count,
+};
+
+/// Time spent in each step of TranslateProgram and the number of IR instructions each step added,
+/// negative when it removed them, accumulated across calls.
+struct TranslateTimings {
+    std::array<std::chrono::nanoseconds, static_cast<size_t>(TranslateStep::Count)> steps{};
+    std::array<s64, static_cast<size_t>(TranslateStep::Count)> instruction_deltas{};
+    /// Instructions moved out of loops and the number of programs that had any
+    size_t hoisted_instructions{};
+    size_t programs_with_hoisting{};
+};
+
+[[nodiscard]] std::string_view NameOf(TranslateStep step);
+
+/**
+ * Translates a Maxwell program to optimized IR.
+ * When timings are given, the time spent in each step is added to them.
+ */
 [[nodiscard]] IR::Program TranslateProgram(ObjectPool<IR::Inst>& inst_pool,
                                            ObjectPool<IR::Block>& block_pool, Environment& env,
-                                           Flow::CFG& cfg, const HostTranslateInfo& host_info);
+                                           Flow::CFG& cfg, const HostTranslateInfo& host_info,
+                                           TranslateTimings* timings = nullptr);
 
 [[nodiscard]] IR::Program MergeDualVertexPrograms(IR::Program& vertex_a, IR::Program& vertex_b,
                                                   Environment& env_vertex_b);
@@ -0,0 +1,266 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file implements a dominator based global value numbering pass, it replaces instructions
+// computing a value already computed by an instruction dominating them. Dominators are computed
+// with the algorithm described in
+//
+//      A Simple, Fast Dominance Algorithm.
+//      Cooper K. D., Harvey T. J., Kennedy K. (2001)
+//
+
+#include <algorithm>
+#include <functional>
+#include <span>
+#include <unordered_set>
+#include <vector>
+
+#include "common/bit_cast.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/ir_opt/pure_instructions.h"
+
+namespace Shader::Optimization {
+namespace {
+constexpr u32 NO_BLOCK = ~0U;
+
+bool IsCommutative(IR::Opcode opcode) {
+    switch (opcode) {
+    case IR::Opcode::IAdd32:
+    case IR::Opcode::IAdd64:
+    case IR::Opcode::IMul32:
+    case IR::Opcode::BitwiseAnd32:
+    case IR::Opcode::BitwiseOr32:
+    case IR::Opcode::BitwiseXor32:
+    case IR::Opcode::SMin32:
+    case IR::Opcode::UMin32:
+    case IR::Opcode::SMax32:
+    case IR::Opcode::UMax32:
+    case IR::Opcode::IEqual:
+    case IR::Opcode::INotEqual:
+    case IR::Opcode::LogicalOr:
+    case IR::Opcode::LogicalAnd:
+    case IR::Opcode::LogicalXor:
+        return true;
+    default:
+        return false;
+    }
+}
+
+size_t HashValue(const IR::Value& value) {
+    if (!value.IsImmediate()) {
+        return std::hash<const IR::Inst*>{}(value.InstRecursive());
+    }
+    // Types without a case only hash their type, equality still tells them apart
+    const size_t type{static_cast<size_t>(value.Type())};
+    switch (value.Type()) {
+    case IR::Type::Reg:
+        return type ^ static_cast<size_t>(value.Reg());
+    case IR::Type::Pred:
+        return type ^ static_cast<size_t>(value.Pred());
+    case IR::Type::Attribute:
+        return type ^ static_cast<size_t>(value.Attribute());
+    case IR::Type::Patch:
+        return type ^ static_cast<size_t>(value.Patch());
+    case IR::Type::U1:
+        return type ^ static_cast<size_t>(value.U1());
+    case IR::Type::U8:
+        return type ^ value.U8();
+    case IR::Type::U16:
+        return type ^ value.U16();
+    case IR::Type::U32:
+        return type ^ std::hash<u32>{}(value.U32());
+    case IR::Type::F32:
+        return type ^ std::hash<u32>{}(Common::BitCast<u32>(value.F32()));
+    case IR::Type::U64:
+        return type ^ std::hash<u64>{}(value.U64());
+    case IR::Type::F64:
+        return type ^ std::hash<u64>{}(Common::BitCast<u64>(value.F64()));
+    default:
+        return type;
+    }
+}
+
+void HashCombine(size_t& seed, size_t value) {
+    seed ^= value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+}
+
+/// Hashes the computation of an instruction: its opcode, flags and arguments
+struct InstHash {
+    size_t operator()(const IR::Inst* inst) const {
+        size_t seed{static_cast<size_t>(inst->GetOpcode())};
+        HashCombine(seed, inst->Flags<u32>());
+        if (IsCommutative(inst->GetOpcode())) {
+            // Order independent, so both orders of the arguments land in the same bucket
+            const size_t lhs{HashValue(inst->Arg(0).Resolve())};
+            const size_t rhs{HashValue(inst->Arg(1).Resolve())};
+            HashCombine(seed, lhs + rhs);
+            return seed;
+        }
+        const size_t num_args{inst->NumArgs()};
+        for (size_t index = 0; index < num_args; ++index) {
+            HashCombine(seed, HashValue(inst->Arg(index).Resolve()));
+        }
+        return seed;
+    }
+};
+
+/// Compares the computations of two instructions
+struct InstEqual {
+    bool operator()(const IR::Inst* lhs, const IR::Inst* rhs) const {
+        if (lhs->GetOpcode() != rhs->GetOpcode() || lhs->Flags<u32>() != rhs->Flags<u32>()) {
+            return false;
+        }
+        const auto arg{[](const IR::Inst* inst, size_t index) {
+            return inst->Arg(index).Resolve();
+        }};
+        if (IsCommutative(lhs->GetOpcode()) && arg(lhs, 0) == arg(rhs, 1) &&
+            arg(lhs, 1) == arg(rhs, 0)) {
+            return true;
+        }
+        const size_t num_args{lhs->NumArgs()};
+        for (size_t index = 0; index < num_args; ++index) {
+            if (arg(lhs, index) != arg(rhs, index)) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+/// Points the arguments of an instruction at the instructions replaced ones resolve to
+void ForwardReplacedArgs(IR::Inst& inst) {
+    if (inst.IsPseudoInstruction()) {
+        // Their argument is the instruction they are associated with
+        return;
+    }
+    const size_t num_args{inst.NumArgs()};
+    for (size_t index = 0; index < num_args; ++index) {
+        const IR::Value arg{inst.Arg(index)};
+        if (arg.IsIdentity() && !arg.IsImmediate()) {
+            inst.SetArg(index, IR::Value{arg.InstRecursive()});
+        }
+    }
+}
+
+/// Immediate dominators of the reachable blocks, indexed in post order
+std::vector<u32> ComputeDominators(const IR::Program& program, std::span<const u32> post_index) {
+    const std::span<IR::Block* const> blocks{program.post_order_blocks};
+    const u32 root{static_cast<u32>(blocks.size() - 1)};
+    std::vector<u32> idoms(blocks.size(), NO_BLOCK);
+    idoms[root] = root;
+
+    const auto intersect{[&](u32 lhs, u32 rhs) {
+        while (lhs != rhs) {
+            while (lhs < rhs) {
+                lhs = idoms[lhs];
+            }
+            while (rhs < lhs) {
+                rhs = idoms[rhs];
+            }
+        }
+        return lhs;
+    }};
+    bool changed{true};
+    while (changed) {
+        changed = false;
+        // Reverse post order, skipping the root
+        for (u32 index = root; index-- > 0;) {
+            u32 new_idom{NO_BLOCK};
+            for (const IR::Block* const pred : blocks[index]->ImmPredecessors()) {
+                const u32 pred_index{post_index[pred->GetOrder()]};
+                if (pred_index == NO_BLOCK || idoms[pred_index] == NO_BLOCK) {
+                    // Unreachable or not processed yet
+                    continue;
+                }
+                new_idom = new_idom == NO_BLOCK ? pred_index : intersect(pred_index, new_idom);
+            }
+            if (idoms[index] != new_idom) {
+                idoms[index] = new_idom;
+                changed = true;
+            }
+        }
+    }
+    return idoms;
+}
+} // Anonymous namespace
+
+void GlobalValueNumberingPass(IR::Program& program) {
+    const std::span<IR::Block* const> blocks{program.post_order_blocks};
+    if (blocks.empty()) {
+        return;
+    }
+    // Blocks are numbered in syntax list order, map them to their post order index
+    u32 max_order{};
+    for (const IR::Block* const block : program.blocks) {
+        max_order = std::max(max_order, block->GetOrder());
+        for (const IR::Block* const pred : block->ImmPredecessors()) {
+            max_order = std::max(max_order, pred->GetOrder());
+        }
+    }
+    std::vector<u32> post_index(max_order + 1, NO_BLOCK);
+    for (u32 index = 0; index < blocks.size(); ++index) {
+        post_index[blocks[index]->GetOrder()] = index;
+    }
+    const std::vector<u32> idoms{ComputeDominators(program, post_index)};
+    std::vector<std::vector<u32>> children(blocks.size());
+    for (u32 index = 0; index + 1 < blocks.size(); ++index) {
+        children[idoms[index]].push_back(index);
+    }
+    const WrittenAttributes written{CollectWrittenAttributes(program)};
+
+    // Walk the dominator tree, values computed in a block are visible to the blocks it dominates
+    std::unordered_set<IR::Inst*, InstHash, InstEqual> leaders;
+    std::vector<IR::Inst*> scope_leaders;
+    struct Scope {
+        u32 block;
+        size_t num_leaders;
+        bool entered;
+    };
+    std::vector<Scope> stack{{static_cast<u32>(blocks.size() - 1), 0, false}};
+    while (!stack.empty()) {
+        Scope& scope{stack.back()};
+        if (scope.entered) {
+            // Leaving the subtree, forget the values only it can see
+            while (scope_leaders.size() > scope.num_leaders) {
+                leaders.erase(scope_leaders.back());
+                scope_leaders.pop_back();
+            }
+            stack.pop_back();
+            continue;
+        }
+        scope.entered = true;
+        scope.num_leaders = scope_leaders.size();
+        const u32 block_index{scope.block};
+        for (IR::Inst& inst : blocks[block_index]->Instructions()) {
+            if (inst.GetOpcode() == IR::Opcode::Phi) {
+                // Operands of phis may not be visited yet, they are forwarded at the end
+                continue;
+            }
+            ForwardReplacedArgs(inst);
+            if (!IsPureInstruction(inst, program, written)) {
+                continue;
+            }
+            const auto [it, inserted]{leaders.insert(&inst)};
+            if (inserted) {
+                scope_leaders.push_back(&inst);
+            } else {
+                inst.ReplaceUsesWith(IR::Value{*it});
+            }
+        }
+        for (const u32 child : children[block_index]) {
+            stack.push_back({child, 0, false});
+        }
+    }
+    for (IR::Block* const block : blocks) {
+        for (IR::Inst& inst : block->Instructions()) {
+            if (inst.GetOpcode() != IR::Opcode::Phi) {
+                break;
+            }
+            ForwardReplacedArgs(inst);
+        }
+    }
+}
+
+} // namespace Shader::Optimization
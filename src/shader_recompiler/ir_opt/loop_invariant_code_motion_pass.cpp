@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file implements loop invariant code motion over the structured loops of the syntax list.
+// Pure instructions whose arguments are all defined outside of a loop, like constant buffer reads
+// and the address math built on them, are moved to the block entering the loop, so they are
+// computed once instead of on every iteration.
+//
+// Loops are do-while loops with a single entry: the block before the loop header branches
+// unconditionally to it and the continue block branches back to it. Moved instructions may now
+// execute when the iteration that computed them would have skipped them, that is fine because
+// pure instructions have no side effects.
+
+#include <unordered_set>
+#include <vector>
+
+#include "shader_recompiler/frontend/ir/abstract_syntax_list.h"
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/value.h"
+#include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/ir_opt/pure_instructions.h"
+
+namespace Shader::Optimization {
+namespace {
+using InstSet = std::unordered_set<const IR::Inst*>;
+
+/// Returns the only block entering the loop from outside, nullptr when there isn't exactly one
+IR::Block* Preheader(const IR::Block* header, const IR::Block* continue_block) {
+    IR::Block* preheader{};
+    for (IR::Block* const pred : header->ImmPredecessors()) {
+        if (pred == continue_block) {
+            continue;
+        }
+        if (preheader) {
+            return nullptr;
+        }
+        preheader = pred;
+    }
+    return preheader;
+}
+
+bool IsInvariant(const IR::Inst& inst, const InstSet& loop_insts) {
+    const size_t num_args{inst.NumArgs()};
+    for (size_t index = 0; index < num_args; ++index) {
+        const IR::Value arg{inst.Arg(index).Resolve()};
+        if (!arg.IsImmediate() && loop_insts.contains(arg.Inst())) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Points the arguments of the instruction past identities, they may be defined after its new
+/// location
+void ResolveArgs(IR::Inst& inst) {
+    const size_t num_args{inst.NumArgs()};
+    for (size_t index = 0; index < num_args; ++index) {
+        const IR::Value arg{inst.Arg(index)};
+        if (arg.IsIdentity()) {
+            inst.SetArg(index, arg.Resolve());
+        }
+    }
+}
+
+size_t HoistLoop(const IR::Program& program, const WrittenAttributes& written, size_t loop_index,
+                 size_t repeat_index) {
+    const IR::AbstractSyntaxList& syntax_list{program.syntax_list};
+    const IR::AbstractSyntaxNode::Data& repeat{syntax_list[repeat_index].data};
+    IR::Block* const header{repeat.repeat.loop_header};
+    IR::Block* const preheader{Preheader(header, syntax_list[loop_index].data.loop.continue_block)};
+    if (!preheader) {
+        return 0;
+    }
+    std::vector<IR::Block*> loop_blocks{header};
+    for (size_t index = loop_index + 1; index < repeat_index; ++index) {
+        if (syntax_list[index].type == IR::AbstractSyntaxNode::Type::Block) {
+            loop_blocks.push_back(syntax_list[index].data.block);
+        }
+    }
+    InstSet loop_insts;
+    for (const IR::Block* const block : loop_blocks) {
+        for (const IR::Inst& inst : block->Instructions()) {
+            loop_insts.insert(&inst);
+        }
+    }
+    // Blocks are in syntax list order, definitions are visited before their uses
+    size_t num_hoisted{};
+    for (IR::Block* const block : loop_blocks) {
+        IR::Block::InstructionList& insts{block->Instructions()};
+        auto it{insts.begin()};
+        while (it != insts.end()) {
+            IR::Inst& inst{*it};
+            if (!IsPureInstruction(inst, program, written) || !IsInvariant(inst, loop_insts)) {
+                ++it;
+                continue;
+            }
+            ResolveArgs(inst);
+            it = insts.erase(it);
+            preheader->Instructions().push_back(inst);
+            loop_insts.erase(&inst);
+            ++num_hoisted;
+        }
+    }
+    return num_hoisted;
+}
+} // Anonymous namespace
+
+size_t LoopInvariantCodeMotionPass(IR::Program& program) {
+    const WrittenAttributes written{CollectWrittenAttributes(program)};
+    const IR::AbstractSyntaxList& syntax_list{program.syntax_list};
+
+    // Inner loops are closed first, what they hoist can be hoisted again by the loops around them
+    std::vector<size_t> loop_stack;
+    size_t num_hoisted{};
+    for (size_t index = 0; index < syntax_list.size(); ++index) {
+        switch (syntax_list[index].type) {
+        case IR::AbstractSyntaxNode::Type::Loop:
+            loop_stack.push_back(index);
+            break;
+        case IR::AbstractSyntaxNode::Type::Repeat:
+            num_hoisted += HoistLoop(program, written, loop_stack.back(), index);
+            loop_stack.pop_back();
+            break;
+        default:
+            break;
+        }
+    }
+    return num_hoisted;
+}
+
+} // namespace Shader::Optimization
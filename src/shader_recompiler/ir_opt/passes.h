@@ -17,7 +17,10 @@ void ConditionalBarrierPass(IR::Program& program);
 void ConstantPropagationPass(Environment& env, IR::Program& program);
 void DeadCodeEliminationPass(IR::Program& program);
 void GlobalMemoryToStorageBufferPass(IR::Program& program, const HostTranslateInfo& host_info);
+void GlobalValueNumberingPass(IR::Program& program);
 void IdentityRemovalPass(IR::Program& program);
+/// Returns the number of instructions moved out of loops
+size_t LoopInvariantCodeMotionPass(IR::Program& program);
 void LowerFp64ToFp32(IR::Program& program);
 void LowerFp16ToFp32(IR::Program& program);
 void LowerInt64ToInt32(IR::Program& program);
@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/ir_opt/pure_instructions.h"
+
+namespace Shader::Optimization {
+
+WrittenAttributes CollectWrittenAttributes(const IR::Program& program) {
+    WrittenAttributes written;
+    for (const IR::Block* const block : program.post_order_blocks) {
+        for (const IR::Inst& inst : block->Instructions()) {
+            switch (inst.GetOpcode()) {
+            case IR::Opcode::SetAttribute:
+                written.attributes.set(static_cast<size_t>(inst.Arg(0).Attribute()));
+                break;
+            case IR::Opcode::SetAttributeIndexed:
+                written.any_indexed = true;
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    return written;
+}
+
+bool IsPureInstruction(const IR::Inst& inst, const IR::Program& program,
+                       const WrittenAttributes& written) {
+    if (inst.MayHaveSideEffects() || inst.IsPseudoInstruction() ||
+        inst.HasAssociatedPseudoOperation() || inst.Type() == IR::Type::Void) {
+        return false;
+    }
+    switch (inst.GetOpcode()) {
+    // Not values
+    case IR::Opcode::Phi:
+    case IR::Opcode::Identity:
+    case IR::Opcode::UndefU1:
+    case IR::Opcode::UndefU8:
+    case IR::Opcode::UndefU16:
+    case IR::Opcode::UndefU32:
+    case IR::Opcode::UndefU64:
+    // Rewritten by the SSA pass
+    case IR::Opcode::GetRegister:
+    case IR::Opcode::GetPred:
+    case IR::Opcode::GetGotoVariable:
+    case IR::Opcode::GetIndirectBranchVariable:
+    case IR::Opcode::GetZFlag:
+    case IR::Opcode::GetSFlag:
+    case IR::Opcode::GetCFlag:
+    case IR::Opcode::GetOFlag:
+    // Reads of state the shader or other invocations can write
+    case IR::Opcode::GetAttributeIndexed:
+    case IR::Opcode::GetPatch:
+    case IR::Opcode::IsHelperInvocation:
+    case IR::Opcode::LoadGlobalU8:
+    case IR::Opcode::LoadGlobalS8:
+    case IR::Opcode::LoadGlobalU16:
+    case IR::Opcode::LoadGlobalS16:
+    case IR::Opcode::LoadGlobal32:
+    case IR::Opcode::LoadGlobal64:
+    case IR::Opcode::LoadGlobal128:
+    case IR::Opcode::LoadStorageU8:
+    case IR::Opcode::LoadStorageS8:
+    case IR::Opcode::LoadStorageU16:
+    case IR::Opcode::LoadStorageS16:
+    case IR::Opcode::LoadStorage32:
+    case IR::Opcode::LoadStorage64:
+    case IR::Opcode::LoadStorage128:
+    case IR::Opcode::LoadLocal:
+    case IR::Opcode::LoadSharedU8:
+    case IR::Opcode::LoadSharedS8:
+    case IR::Opcode::LoadSharedU16:
+    case IR::Opcode::LoadSharedS16:
+    case IR::Opcode::LoadSharedU32:
+    case IR::Opcode::LoadSharedU64:
+    case IR::Opcode::LoadSharedU128:
+    // Texture and image instructions, implicit LODs also depend on the neighbouring invocations
+    case IR::Opcode::BindlessImageSampleImplicitLod:
+    case IR::Opcode::BindlessImageSampleExplicitLod:
+    case IR::Opcode::BindlessImageSampleDrefImplicitLod:
+    case IR::Opcode::BindlessImageSampleDrefExplicitLod:
+    case IR::Opcode::BindlessImageGather:
+    case IR::Opcode::BindlessImageGatherDref:
+    case IR::Opcode::BindlessImageFetch:
+    case IR::Opcode::BindlessImageQueryDimensions:
+    case IR::Opcode::BindlessImageQueryLod:
+    case IR::Opcode::BindlessImageGradient:
+    case IR::Opcode::BindlessImageRead:
+    case IR::Opcode::BoundImageSampleImplicitLod:
+    case IR::Opcode::BoundImageSampleExplicitLod:
+    case IR::Opcode::BoundImageSampleDrefImplicitLod:
+    case IR::Opcode::BoundImageSampleDrefExplicitLod:
+    case IR::Opcode::BoundImageGather:
+    case IR::Opcode::BoundImageGatherDref:
+    case IR::Opcode::BoundImageFetch:
+    case IR::Opcode::BoundImageQueryDimensions:
+    case IR::Opcode::BoundImageQueryLod:
+    case IR::Opcode::BoundImageGradient:
+    case IR::Opcode::BoundImageRead:
+    case IR::Opcode::ImageSampleImplicitLod:
+    case IR::Opcode::ImageSampleExplicitLod:
+    case IR::Opcode::ImageSampleDrefImplicitLod:
+    case IR::Opcode::ImageSampleDrefExplicitLod:
+    case IR::Opcode::ImageGather:
+    case IR::Opcode::ImageGatherDref:
+    case IR::Opcode::ImageFetch:
+    case IR::Opcode::ImageQueryDimensions:
+    case IR::Opcode::ImageQueryLod:
+    case IR::Opcode::ImageGradient:
+    case IR::Opcode::ImageRead:
+    // Results depend on the invocations active where they execute
+    case IR::Opcode::VoteAll:
+    case IR::Opcode::VoteAny:
+    case IR::Opcode::VoteEqual:
+    case IR::Opcode::SubgroupBallot:
+    case IR::Opcode::ShuffleIndex:
+    case IR::Opcode::ShuffleUp:
+    case IR::Opcode::ShuffleDown:
+    case IR::Opcode::ShuffleButterfly:
+    case IR::Opcode::FSwizzleAdd:
+    case IR::Opcode::DPdxFine:
+    case IR::Opcode::DPdyFine:
+    case IR::Opcode::DPdxCoarse:
+    case IR::Opcode::DPdyCoarse:
+        return false;
+    case IR::Opcode::GetAttribute:
+    case IR::Opcode::GetAttributeU32:
+        // Tessellation control shaders read the outputs written by the other invocations
+        if (program.stage == Stage::TessellationControl || written.any_indexed) {
+            return false;
+        }
+        return !written.attributes.test(static_cast<size_t>(inst.Arg(0).Attribute()));
+    default:
+        return true;
+    }
+}
+
+} // namespace Shader::Optimization
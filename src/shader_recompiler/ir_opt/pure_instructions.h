@@ -0,0 +1,27 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <bitset>
+
+#include "shader_recompiler/frontend/ir/attribute.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/frontend/ir/value.h"
+
+namespace Shader::Optimization {
+
+/// Attributes written by the program, reading them twice may not return the same value
+struct WrittenAttributes {
+    std::bitset<static_cast<size_t>(IR::Attribute::DrawID) + 1> attributes;
+    bool any_indexed{};
+};
+
+[[nodiscard]] WrittenAttributes CollectWrittenAttributes(const IR::Program& program);
+
+/// Returns true when the instruction always computes the same value from the same arguments,
+/// so passes are free to reuse or move it as long as its arguments are available
+[[nodiscard]] bool IsPureInstruction(const IR::Inst& inst, const IR::Program& program,
+                                     const WrittenAttributes& written);
+
+} // namespace Shader::Optimization
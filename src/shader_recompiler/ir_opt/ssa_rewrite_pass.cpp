@@ -13,13 +13,18 @@
 //      https://link.springer.com/chapter/10.1007/978-3-642-37051-9_6
 //
 
+#include <algorithm>
 #include <deque>
-#include <map>
 #include <span>
-#include <unordered_map>
+#include <utility>
 #include <variant>
 #include <vector>
 
+#include <boost/container/flat_map.hpp>
+#include <boost/container/small_vector.hpp>
+
+#include "common/assert.h"
+#include "shader_recompiler/frontend/ir/abstract_syntax_list.h"
 #include "shader_recompiler/frontend/ir/basic_block.h"
 #include "shader_recompiler/frontend/ir/opcodes.h"
 #include "shader_recompiler/frontend/ir/pred.h"
@@ -52,9 +57,45 @@ struct IndirectBranchVariable {
 
 using Variant = std::variant<IR::Reg, IR::Pred, ZeroFlagTag, SignFlagTag, CarryFlagTag,
                              OverflowFlagTag, GotoVariable, IndirectBranchVariable>;
-using ValueMap = std::unordered_map<IR::Block*, IR::Value>;
 
-struct DefTable {
+// Dense indices of the variables stored outside of the blocks, goto variables are stored apart
+constexpr size_t ZERO_FLAG_SLOT = IR::NUM_USER_PREDS;
+constexpr size_t SIGN_FLAG_SLOT = ZERO_FLAG_SLOT + 1;
+constexpr size_t CARRY_FLAG_SLOT = SIGN_FLAG_SLOT + 1;
+constexpr size_t OVERFLOW_FLAG_SLOT = CARRY_FLAG_SLOT + 1;
+constexpr size_t INDIRECT_BRANCH_SLOT = OVERFLOW_FLAG_SLOT + 1;
+constexpr size_t NUM_FIXED_SLOTS = INDIRECT_BRANCH_SLOT + 1;
+
+size_t Slot(IR::Pred variable) noexcept {
+    return IR::PredIndex(variable);
+}
+
+size_t Slot(ZeroFlagTag) noexcept {
+    return ZERO_FLAG_SLOT;
+}
+
+size_t Slot(SignFlagTag) noexcept {
+    return SIGN_FLAG_SLOT;
+}
+
+size_t Slot(CarryFlagTag) noexcept {
+    return CARRY_FLAG_SLOT;
+}
+
+size_t Slot(OverflowFlagTag) noexcept {
+    return OVERFLOW_FLAG_SLOT;
+}
+
+size_t Slot(IndirectBranchVariable) noexcept {
+    return INDIRECT_BRANCH_SLOT;
+}
+
+/// Current definitions of the variables, indexed by the variable and the order of the block.
+class DefTable {
+public:
+    explicit DefTable(size_t num_blocks_)
+        : num_blocks{num_blocks_}, defs(NUM_FIXED_SLOTS * num_blocks), goto_defs(num_blocks) {}
+
     const IR::Value& Def(IR::Block* block, IR::Reg variable) {
         return block->SsaRegValue(variable);
     }
@@ -62,62 +103,52 @@ struct DefTable {
         block->SetSsaRegValue(variable, value);
     }
 
-    const IR::Value& Def(IR::Block* block, IR::Pred variable) {
-        return preds[IR::PredIndex(variable)][block];
-    }
-    void SetDef(IR::Block* block, IR::Pred variable, const IR::Value& value) {
-        preds[IR::PredIndex(variable)].insert_or_assign(block, value);
-    }
-
     const IR::Value& Def(IR::Block* block, GotoVariable variable) {
-        return goto_vars[variable.index][block];
+        const auto& block_defs{goto_defs[Order(block)]};
+        const auto it{block_defs.find(GotoSlot(variable))};
+        return it != block_defs.end() ? it->second : undefined;
     }
     void SetDef(IR::Block* block, GotoVariable variable, const IR::Value& value) {
-        goto_vars[variable.index].insert_or_assign(block, value);
+        goto_defs[Order(block)].insert_or_assign(GotoSlot(variable), value);
     }
 
-    const IR::Value& Def(IR::Block* block, IndirectBranchVariable) {
-        return indirect_branch_var[block];
-    }
-    void SetDef(IR::Block* block, IndirectBranchVariable, const IR::Value& value) {
-        indirect_branch_var.insert_or_assign(block, value);
-    }
-
-    const IR::Value& Def(IR::Block* block, ZeroFlagTag) {
-        return zero_flag[block];
+    template <typename Type>
+    const IR::Value& Def(IR::Block* block, Type variable) {
+        return defs[Slot(variable) * num_blocks + Order(block)];
     }
-    void SetDef(IR::Block* block, ZeroFlagTag, const IR::Value& value) {
-        zero_flag.insert_or_assign(block, value);
+    template <typename Type>
+    void SetDef(IR::Block* block, Type variable, const IR::Value& value) {
+        defs[Slot(variable) * num_blocks + Order(block)] = value;
     }
 
-    const IR::Value& Def(IR::Block* block, SignFlagTag) {
-        return sign_flag[block];
-    }
-    void SetDef(IR::Block* block, SignFlagTag, const IR::Value& value) {
-        sign_flag.insert_or_assign(block, value);
-    }
+private:
+    static constexpr u32 NO_SLOT = ~0U;
 
-    const IR::Value& Def(IR::Block* block, CarryFlagTag) {
-        return carry_flag[block];
-    }
-    void SetDef(IR::Block* block, CarryFlagTag, const IR::Value& value) {
-        carry_flag.insert_or_assign(block, value);
+    size_t Order(IR::Block* block) const {
+        DEBUG_ASSERT(block->GetOrder() < num_blocks);
+        return block->GetOrder();
     }
 
-    const IR::Value& Def(IR::Block* block, OverflowFlagTag) {
-        return overflow_flag[block];
-    }
-    void SetDef(IR::Block* block, OverflowFlagTag, const IR::Value& value) {
-        overflow_flag.insert_or_assign(block, value);
+    /// Returns the dense slot of a goto variable, giving it the next free one on its first use
+    u32 GotoSlot(GotoVariable variable) {
+        if (variable.index >= goto_slots.size()) {
+            goto_slots.resize(variable.index + 1, NO_SLOT);
+        }
+        u32& slot{goto_slots[variable.index]};
+        if (slot == NO_SLOT) {
+            slot = num_goto_slots++;
+        }
+        return slot;
     }
 
-    std::array<ValueMap, IR::NUM_USER_PREDS> preds;
-    std::unordered_map<u32, ValueMap> goto_vars;
-    ValueMap indirect_branch_var;
-    ValueMap zero_flag;
-    ValueMap sign_flag;
-    ValueMap carry_flag;
-    ValueMap overflow_flag;
+    size_t num_blocks;
+    std::vector<IR::Value> defs;
+    /// Goto variables are defined in few blocks each, so their definitions are kept per block
+    /// instead of in a table as large as the blocks times the labels
+    std::vector<boost::container::flat_map<u32, IR::Value>> goto_defs;
+    std::vector<u32> goto_slots;
+    u32 num_goto_slots{};
+    IR::Value undefined{};
 };
 
 IR::Opcode UndefOpcode(IR::Reg) noexcept {
@@ -158,6 +189,9 @@ struct ReadState {
 
 class Pass {
 public:
+    explicit Pass(size_t num_blocks)
+        : incomplete_phi_heads(num_blocks, NO_INCOMPLETE_PHI), current_def{num_blocks} {}
+
     template <typename Type>
     void WriteVariable(Type variable, IR::Block* block, const IR::Value& value) {
         current_def.SetDef(block, variable, value);
@@ -194,7 +228,7 @@ public:
                     IR::Inst* phi{&*block->PrependNewInst(block->begin(), IR::Opcode::Phi)};
                     phi->SetFlags(IR::TypeOf(UndefOpcode(variable)));
 
-                    incomplete_phis[block].insert_or_assign(variable, phi);
+                    AddIncompletePhi(block, variable, phi);
                     stack.back().result = IR::Value{&*phi};
                 } else if (const std::span imm_preds = block->ImmPredecessors();
                            imm_preds.size() == 1) {
@@ -239,13 +273,17 @@ public:
     }
 
     void SealBlock(IR::Block* block) {
-        const auto it{incomplete_phis.find(block)};
-        if (it != incomplete_phis.end()) {
-            for (auto& pair : it->second) {
-                auto& variant{pair.first};
-                auto& phi{pair.second};
-                std::visit([&](auto& variable) { AddPhiOperands(variable, *phi, block); }, variant);
-            }
+        // Gather the phis first, adding their operands can add phis to other blocks
+        boost::container::small_vector<std::pair<Variant, IR::Inst*>, 16> phis;
+        for (u32 it = incomplete_phi_heads[block->GetOrder()]; it != NO_INCOMPLETE_PHI;
+             it = incomplete_phis[it].next) {
+            phis.emplace_back(incomplete_phis[it].variable, incomplete_phis[it].phi);
+        }
+        // Complete them in variable order, it decides where new instructions are inserted
+        std::sort(phis.begin(), phis.end(),
+                  [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+        for (auto& [variant, phi] : phis) {
+            std::visit([&](auto& variable) { AddPhiOperands(variable, *phi, block); }, variant);
         }
         block->SsaSeal();
     }
@@ -295,7 +333,28 @@ private:
         return same;
     }
 
-    std::unordered_map<IR::Block*, std::map<Variant, IR::Inst*>> incomplete_phis;
+    template <typename Type>
+    void AddIncompletePhi(IR::Block* block, Type variable, IR::Inst* phi) {
+        u32& head{incomplete_phi_heads[block->GetOrder()]};
+        incomplete_phis.push_back({
+            .variable = variable,
+            .phi = phi,
+            .next = head,
+        });
+        head = static_cast<u32>(incomplete_phis.size() - 1);
+    }
+
+    static constexpr u32 NO_INCOMPLETE_PHI = ~0U;
+
+    /// Phi waiting for its block to be sealed, linked to the previous one of the same block
+    struct IncompletePhi {
+        Variant variable;
+        IR::Inst* phi;
+        u32 next;
+    };
+
+    std::vector<IncompletePhi> incomplete_phis;
+    std::vector<u32> incomplete_phi_heads;
     DefTable current_def;
 };
 
@@ -391,7 +450,11 @@ IR::Type GetConcreteType(IR::Inst* inst) {
 } // Anonymous namespace
 
 void SsaRewritePass(IR::Program& program) {
-    Pass pass;
+    // Blocks are numbered in syntax list order, including the unreachable ones
+    const size_t num_blocks{static_cast<size_t>(
+        std::ranges::count(program.syntax_list, IR::AbstractSyntaxNode::Type::Block,
+                           &IR::AbstractSyntaxNode::type))};
+    Pass pass(num_blocks);
     const auto end{program.post_order_blocks.rend()};
     for (auto block = program.post_order_blocks.rbegin(); block != end; ++block) {
         VisitBlock(pass, *block);
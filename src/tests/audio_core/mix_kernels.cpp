@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "audio_core/renderer/command/mix/mix_kernels.h"
+#include "common/common_types.h"
+
+namespace {
+using namespace AudioCore::Renderer;
+
+constexpr std::array<MixKernelIsa, 3> VECTOR_ISAS{MixKernelIsa::SSE41, MixKernelIsa::AVX2,
+                                                  MixKernelIsa::NEON};
+
+std::vector<s32> RandomSamples(std::mt19937& rng, size_t count) {
+    // Mostly audio range samples, with some full range ones to exercise the wrap around
+    std::uniform_int_distribution<s32> audio(-0x800000, 0x7FFFFF);
+    std::uniform_int_distribution<s32> full;
+    std::vector<s32> samples(count);
+    for (s32& sample : samples) {
+        sample = rng() % 8 == 0 ? full(rng) : audio(rng);
+    }
+    return samples;
+}
+
+template <size_t Q>
+void CompareWithScalar(MixKernelIsa isa) {
+    std::mt19937 rng(Q);
+    std::uniform_real_distribution<f32> volumes(-4.0f, 4.0f);
+    // Odd counts leave a tail for the scalar kernel, 240 is a usual renderer sample count
+    static constexpr std::array<u32, 6> sample_counts{1, 7, 16, 33, 160, 240};
+    for (const u32 sample_count : sample_counts) {
+        for (int iteration = 0; iteration < 32; ++iteration) {
+            f32 volume = volumes(rng);
+            f32 ramp = iteration % 4 == 0 ? 0.0f : volumes(rng) / static_cast<f32>(sample_count);
+            if (iteration == 1) {
+                // Too large for the vector kernels, this must fall back to the scalar kernel
+                volume = 70000.0f;
+            }
+            const auto input = RandomSamples(rng, sample_count);
+            const auto output = RandomSamples(rng, sample_count);
+
+            auto expected = output;
+            auto result = output;
+            const s32 expected_last =
+                MixKernel<Q>(expected, input, volume, ramp, sample_count, MixKernelIsa::Scalar);
+            const s32 result_last = MixKernel<Q>(result, input, volume, ramp, sample_count, isa);
+            REQUIRE(result == expected);
+            REQUIRE(result_last == expected_last);
+
+            GainKernel<Q>(expected, input, volume, ramp, sample_count, MixKernelIsa::Scalar);
+            GainKernel<Q>(result, input, volume, ramp, sample_count, isa);
+            REQUIRE(result == expected);
+
+            // In place, as when the input and output mix buffers are the same
+            expected = input;
+            result = input;
+            GainKernel<Q>(expected, expected, volume, ramp, sample_count, MixKernelIsa::Scalar);
+            GainKernel<Q>(result, result, volume, ramp, sample_count, isa);
+            REQUIRE(result == expected);
+        }
+    }
+}
+
+} // Anonymous namespace
+
+TEST_CASE("MixKernels[MatchScalar]", "[audio_core]") {
+    for (const MixKernelIsa isa : VECTOR_ISAS) {
+        if (!IsMixKernelIsaSupported(isa)) {
+            continue;
+        }
+        CompareWithScalar<15>(isa);
+        CompareWithScalar<23>(isa);
+    }
+}
+
+TEST_CASE("MixKernels[Benchmark]", "[.][benchmark][audio_core]") {
+    static constexpr u32 SAMPLE_COUNT = 240;
+    std::mt19937 rng(0);
+    const auto input = RandomSamples(rng, SAMPLE_COUNT);
+    std::vector<s32> output(SAMPLE_COUNT);
+    for (const MixKernelIsa isa : {MixKernelIsa::Scalar, MixKernelIsa::SSE41, MixKernelIsa::AVX2,
+                                   MixKernelIsa::NEON}) {
+        if (!IsMixKernelIsaSupported(isa)) {
+            continue;
+        }
+        const auto name = fmt::format("isa={}", static_cast<u32>(isa));
+        BENCHMARK("mix ramp " + name) {
+            return MixKernel<15>(output, input, 0.5f, 0.001f, SAMPLE_COUNT, isa);
+        };
+        BENCHMARK("gain " + name) {
+            GainKernel<15>(output, input, 0.5f, 0.0f, SAMPLE_COUNT, isa);
+            return output[0];
+        };
+    }
+}
@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "audio_core/renderer/command/resample/resample.h"
+#include "common/common_types.h"
+
+namespace {
+using namespace AudioCore;
+using namespace AudioCore::Renderer;
+
+/// Samples written for each voice per 5ms renderer update at 48 kHz.
+constexpr u32 SAMPLES_PER_UPDATE = 240;
+
+constexpr std::array<f32, 6> RATIOS{0.5f, 32000.0f / 48000.0f, 1.0f, 1.2f, 1.5f, 2.0f};
+
+std::vector<s16> RandomInput(f32 ratio) {
+    // The high quality filter reads up to 8 samples past the read position
+    const auto size{static_cast<size_t>(SAMPLES_PER_UPDATE * ratio) + 16};
+    std::mt19937 rng(static_cast<u32>(size));
+    std::uniform_int_distribution<int> distribution(-0x8000, 0x7FFF);
+    std::vector<s16> input(size);
+    for (s16& sample : input) {
+        sample = static_cast<s16>(distribution(rng));
+    }
+    return input;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("Resample[MatchScalar]", "[audio_core]") {
+    for (const MixKernelIsa isa : {MixKernelIsa::SSE41, MixKernelIsa::AVX2, MixKernelIsa::NEON}) {
+        if (!IsMixKernelIsaSupported(isa)) {
+            continue;
+        }
+        for (const SrcQuality quality : {SrcQuality::Medium, SrcQuality::High}) {
+            for (const f32 ratio_value : RATIOS) {
+                const Common::FixedPoint<49, 15> ratio{ratio_value};
+                const auto input{RandomInput(ratio_value)};
+                // An odd count leaves samples for the scalar filter
+                for (const u32 count : {SAMPLES_PER_UPDATE, SAMPLES_PER_UPDATE - 3}) {
+                    Common::FixedPoint<49, 15> expected_fraction{0.25f};
+                    Common::FixedPoint<49, 15> fraction{0.25f};
+                    std::vector<s32> expected(count);
+                    std::vector<s32> result(count);
+                    Resample(expected, input, ratio, expected_fraction, count, quality,
+                             MixKernelIsa::Scalar);
+                    Resample(result, input, ratio, fraction, count, quality, isa);
+                    REQUIRE(result == expected);
+                    REQUIRE(fraction == expected_fraction);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Resample[Benchmark]", "[.][benchmark][audio_core]") {
+    static constexpr u32 UPDATES = 20000;
+    const f32 ratio_value{32000.0f / 48000.0f};
+    const Common::FixedPoint<49, 15> ratio{ratio_value};
+    const auto input{RandomInput(ratio_value)};
+    std::vector<s32> output(SAMPLES_PER_UPDATE);
+    for (const MixKernelIsa isa : {MixKernelIsa::Scalar, MixKernelIsa::SSE41, MixKernelIsa::AVX2,
+                                   MixKernelIsa::NEON}) {
+        if (!IsMixKernelIsaSupported(isa)) {
+            continue;
+        }
+        for (const SrcQuality quality : {SrcQuality::Medium, SrcQuality::High}) {
+            const auto start{std::chrono::steady_clock::now()};
+            for (u32 update = 0; update < UPDATES; update++) {
+                Common::FixedPoint<49, 15> fraction{0};
+                Resample(output, input, ratio, fraction, SAMPLES_PER_UPDATE, quality, isa);
+            }
+            const std::chrono::duration<double, std::milli> elapsed{
+                std::chrono::steady_clock::now() - start};
+            // Each update is one voice's share of a 5ms renderer update
+            fmt::print("32 kHz -> 48 kHz, quality={} isa={}: {:.1f} voices per ms\n",
+                       static_cast<u32>(quality), static_cast<u32>(isa),
+                       UPDATES / elapsed.count());
+        }
+    }
+}
@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/bounded_threadsafe_queue.h"
+#include "common/common_types.h"
+
+namespace {
+
+struct Command {
+    u64 fence{};
+    std::array<u64, 4> payload{};
+};
+
+/// Queue locking on every push and pop, as SPSCQueue behind MPSCQueue used to.
+template <typename T, size_t Capacity = 0x1000>
+class LockedQueue {
+public:
+    void EmplaceWait(const T& value) {
+        std::scoped_lock write_lock{write_mutex};
+        const size_t write_index = m_write_index.load(std::memory_order::relaxed);
+        {
+            std::unique_lock lock{producer_cv_mutex};
+            producer_cv.wait(lock, [this, write_index] {
+                return write_index - m_read_index.load(std::memory_order::acquire) < Capacity;
+            });
+        }
+        m_data[write_index % Capacity] = value;
+        ++m_write_index;
+        std::scoped_lock lock{consumer_cv_mutex};
+        consumer_cv.notify_one();
+    }
+
+    void PopWait(T& value, std::stop_token stop_token) {
+        const size_t read_index = m_read_index.load(std::memory_order::relaxed);
+        {
+            std::unique_lock lock{consumer_cv_mutex};
+            Common::CondvarWait(consumer_cv, lock, stop_token, [this, read_index] {
+                return read_index != m_write_index.load(std::memory_order::acquire);
+            });
+            if (stop_token.stop_requested()) {
+                return;
+            }
+        }
+        value = m_data[read_index % Capacity];
+        ++m_read_index;
+        std::scoped_lock lock{producer_cv_mutex};
+        producer_cv.notify_one();
+    }
+
+private:
+    alignas(128) std::atomic_size_t m_read_index{0};
+    alignas(128) std::atomic_size_t m_write_index{0};
+    std::array<T, Capacity> m_data;
+    std::mutex write_mutex;
+    std::condition_variable_any producer_cv;
+    std::mutex producer_cv_mutex;
+    std::condition_variable_any consumer_cv;
+    std::mutex consumer_cv_mutex;
+};
+
+/// Mimics the GPU thread: commands are pushed under a lock and consumed by a worker thread.
+template <typename Queue>
+class CommandStress {
+public:
+    CommandStress() {
+        consumer = std::jthread([this](std::stop_token stop_token) {
+            Command command;
+            while (!stop_token.stop_requested()) {
+                queue.PopWait(command, stop_token);
+                signaled_fence.store(command.fence, std::memory_order_release);
+            }
+        });
+    }
+
+    /// Pushes count commands without waiting for them to be processed.
+    u64 Push(size_t count) {
+        for (size_t i = 0; i < count; ++i) {
+            std::scoped_lock lock{write_lock};
+            queue.EmplaceWait(Command{++last_fence, {}});
+        }
+        return last_fence;
+    }
+
+    /// Waits until the consumer has processed the command with the given fence.
+    void Wait(u64 fence) const {
+        while (signaled_fence.load(std::memory_order_acquire) < fence) {
+            std::this_thread::yield();
+        }
+    }
+
+private:
+    Queue queue;
+    std::mutex write_lock;
+    u64 last_fence{};
+    std::atomic<u64> signaled_fence{};
+    std::jthread consumer;
+};
+
+template <typename Queue>
+void RunStressBenchmarks(const char* name) {
+    static constexpr size_t COMMANDS = 0x10000;
+    CommandStress<Queue> stress;
+    BENCHMARK(std::string(name) + " throughput, 65536 commands") {
+        const u64 fence = stress.Push(COMMANDS);
+        stress.Wait(fence);
+        return fence;
+    };
+    BENCHMARK(std::string(name) + " producer latency, single command") {
+        const u64 fence = stress.Push(1);
+        stress.Wait(fence);
+        return fence;
+    };
+}
+
+template <size_t Capacity>
+void RunThreaded() {
+    static constexpr u32 COUNT = 0x40000;
+    Common::SPSCQueue<u32, Capacity> queue;
+    std::jthread producer([&queue] {
+        for (u32 i = 0; i < COUNT; ++i) {
+            queue.EmplaceWait(i);
+        }
+    });
+    bool in_order = true;
+    for (u32 i = 0; i < COUNT; ++i) {
+        in_order &= queue.PopWait() == i;
+    }
+    REQUIRE(in_order);
+}
+
+} // Anonymous namespace
+
+TEST_CASE("SPSCQueue: Try", "[common]") {
+    Common::SPSCQueue<u32, 4> queue;
+    u32 value{};
+    REQUIRE(!queue.TryPop(value));
+    for (u32 i = 0; i < 4; ++i) {
+        REQUIRE(queue.TryEmplace(i));
+    }
+    REQUIRE(!queue.TryEmplace(4U));
+    for (u32 i = 0; i < 4; ++i) {
+        REQUIRE(queue.TryPop(value));
+        REQUIRE(value == i);
+    }
+    REQUIRE(!queue.TryPop(value));
+}
+
+TEST_CASE("SPSCQueue: Batched release", "[common]") {
+    // Slots of queues with 128 entries are released two at a time
+    Common::SPSCQueue<u32, 128> queue;
+    u32 value{};
+    for (u32 i = 0; i < 128; ++i) {
+        REQUIRE(queue.TryEmplace(i));
+    }
+    REQUIRE(queue.TryPop(value));
+    REQUIRE(!queue.TryEmplace(128U));
+    REQUIRE(queue.TryPop(value));
+    REQUIRE(queue.TryEmplace(128U));
+    REQUIRE(queue.TryEmplace(129U));
+    REQUIRE(!queue.TryEmplace(130U));
+
+    // Draining the queue releases everything
+    for (u32 i = 2; i < 130; ++i) {
+        REQUIRE(queue.TryPop(value));
+        REQUIRE(value == i);
+    }
+    REQUIRE(!queue.TryPop(value));
+    for (u32 i = 0; i < 128; ++i) {
+        REQUIRE(queue.TryEmplace(i));
+    }
+}
+
+TEST_CASE("SPSCQueue: Threaded", "[common]") {
+    // A small capacity makes both sides wait on each other constantly
+    RunThreaded<8>();
+    // The default capacity releases slots in batches
+    RunThreaded<Common::detail::DefaultCapacity>();
+}
+
+TEST_CASE("SPSCQueue: Stop waiting", "[common]") {
+    Common::SPSCQueue<u32, 8> queue;
+    std::stop_source stop_source;
+    std::jthread consumer([&queue, token = stop_source.get_token()] {
+        u32 value{};
+        queue.PopWait(value, token);
+    });
+    // Hangs if requesting a stop doesn't wake up the consumer
+    stop_source.request_stop();
+    consumer.join();
+}
+
+TEST_CASE("SPSCQueue: Benchmark", "[.][benchmark][common]") {
+    RunStressBenchmarks<Common::SPSCQueue<Command>>("lock-free");
+    RunStressBenchmarks<LockedQueue<Command>>("locked");
+}
@@ -1,16 +1,23 @@
 // SPDX-FileCopyrightText: 2016 Dolphin Emulator Project
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
 #include <array>
 #include <bitset>
 #include <chrono>
 #include <cstdlib>
 #include <memory>
 #include <optional>
+#include <random>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
+#include "common/wall_clock.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 
@@ -40,6 +47,36 @@ struct ScopeInit final {
     Core::Timing::CoreTiming core_timing;
 };
 
+using OptionalDelay = std::optional<std::chrono::nanoseconds>;
+
+/// Single core timing, time only moves forward when ticks are added.
+struct SingleCoreScopeInit final {
+    SingleCoreScopeInit() {
+        core_timing.SetMulticore(false);
+        core_timing.Initialize([]() {});
+    }
+
+    void AdvanceTimeNs(u64 ns) {
+        core_timing.AddTicks(ns * Common::WallClock::CPUTickFreq / 1'000'000'000 + 1);
+    }
+
+    Core::Timing::CoreTiming core_timing;
+};
+
+/// Records the scheduled time and the id of every event that fires.
+struct FiredLog {
+    std::shared_ptr<Core::Timing::EventType> MakeEvent(u32 id) {
+        return Core::Timing::CreateEvent(
+            "event" + std::to_string(id),
+            [this, id](s64 time, std::chrono::nanoseconds) -> OptionalDelay {
+                fired.emplace_back(time, id);
+                return std::nullopt;
+            });
+    }
+
+    std::vector<std::pair<s64, u32>> fired;
+};
+
 u64 TestTimerSpeed(Core::Timing::CoreTiming& core_timing) {
     const u64 start = core_timing.GetGlobalTimeNs().count();
     volatile u64 placebo = 0;
@@ -139,3 +176,147 @@ TEST_CASE("CoreTiming[BasicOrderNoPausing]", "[core]") {
     printf("HostTimer No Pausing Timer Time: %.3f %.6f\n", timer_time / 1000.f,
            timer_time / 1000000.f);
 }
+
+TEST_CASE("CoreTiming[EventOrder]", "[core]") {
+    SingleCoreScopeInit guard;
+    auto& core_timing = guard.core_timing;
+    FiredLog log;
+    std::mt19937 rng(1234);
+
+    // Lots of events share the same time, those have to fire in scheduling order
+    std::vector<std::shared_ptr<Core::Timing::EventType>> events;
+    std::vector<std::pair<s64, u32>> expected;
+    const s64 start = core_timing.GetGlobalTimeNs().count();
+    for (u32 id = 0; id < 500; ++id) {
+        const s64 delay = static_cast<s64>(rng() % 64) * 1000;
+        events.push_back(log.MakeEvent(id));
+        core_timing.ScheduleEvent(std::chrono::nanoseconds{delay}, events.back());
+        expected.emplace_back(start + delay, id);
+    }
+    std::ranges::stable_sort(expected, {}, &std::pair<s64, u32>::first);
+
+    guard.AdvanceTimeNs(32'000);
+    core_timing.Advance();
+    REQUIRE(log.fired.size() > 0);
+    REQUIRE(log.fired.size() < expected.size());
+
+    guard.AdvanceTimeNs(1'000'000);
+    REQUIRE(!core_timing.Advance().has_value());
+    REQUIRE(log.fired == expected);
+}
+
+TEST_CASE("CoreTiming[Unschedule]", "[core]") {
+    SingleCoreScopeInit guard;
+    auto& core_timing = guard.core_timing;
+    FiredLog log;
+    std::mt19937 rng(4321);
+
+    std::array<std::shared_ptr<Core::Timing::EventType>, 4> events;
+    for (u32 id = 0; id < events.size(); ++id) {
+        events[id] = log.MakeEvent(id);
+    }
+    std::vector<std::pair<s64, u32>> expected;
+    const s64 start = core_timing.GetGlobalTimeNs().count();
+    for (u32 i = 0; i < 200; ++i) {
+        const u32 id = static_cast<u32>(rng() % events.size());
+        const s64 delay = static_cast<s64>(rng() % 100) * 1000 + 1000;
+        core_timing.ScheduleEvent(std::chrono::nanoseconds{delay}, events[id]);
+        if (id != 2) {
+            expected.emplace_back(start + delay, id);
+        }
+    }
+    std::ranges::stable_sort(expected, {}, &std::pair<s64, u32>::first);
+
+    // Every pending instance of the event is removed, the others are left in order
+    core_timing.UnscheduleEvent(events[2], Core::Timing::UnscheduleEventType::NoWait);
+    guard.AdvanceTimeNs(1'000'000);
+    core_timing.Advance();
+    REQUIRE(log.fired == expected);
+}
+
+TEST_CASE("CoreTiming[LoopingEvent]", "[core]") {
+    SingleCoreScopeInit guard;
+    auto& core_timing = guard.core_timing;
+    std::vector<s64> loop_times;
+    std::vector<s64> stopped_times;
+    std::shared_ptr<Core::Timing::EventType> stopped_event;
+
+    const auto loop_event = Core::Timing::CreateEvent(
+        "loop", [&](s64 time, std::chrono::nanoseconds) -> OptionalDelay {
+            loop_times.push_back(time);
+            // Switch to a longer period after the third call
+            if (loop_times.size() >= 3) {
+                return std::chrono::nanoseconds{2000};
+            }
+            return std::nullopt;
+        });
+    stopped_event = Core::Timing::CreateEvent(
+        "stopped", [&](s64 time, std::chrono::nanoseconds) -> OptionalDelay {
+            stopped_times.push_back(time);
+            if (stopped_times.size() == 2) {
+                core_timing.UnscheduleEvent(stopped_event,
+                                            Core::Timing::UnscheduleEventType::NoWait);
+            }
+            return std::nullopt;
+        });
+
+    const s64 start = core_timing.GetGlobalTimeNs().count();
+    core_timing.ScheduleLoopingEvent(std::chrono::nanoseconds{1000},
+                                     std::chrono::nanoseconds{1000}, loop_event);
+    core_timing.ScheduleLoopingEvent(std::chrono::nanoseconds{500}, std::chrono::nanoseconds{500},
+                                     stopped_event);
+
+    guard.AdvanceTimeNs(10'000);
+    core_timing.Advance();
+
+    const std::vector<s64> expected_loop{start + 1000, start + 2000, start + 3000,
+                                         start + 5000, start + 7000, start + 9000};
+    REQUIRE(loop_times == expected_loop);
+    REQUIRE(stopped_times == std::vector<s64>{start + 500, start + 1000});
+
+    core_timing.UnscheduleEvent(loop_event, Core::Timing::UnscheduleEventType::NoWait);
+    guard.AdvanceTimeNs(10'000);
+    REQUIRE(!core_timing.Advance().has_value());
+    REQUIRE(loop_times.size() == expected_loop.size());
+}
+
+TEST_CASE("CoreTiming[Benchmark]", "[.][benchmark][core]") {
+    static constexpr size_t OPERATIONS_PER_THREAD = 1000;
+    static constexpr size_t PENDING_EVENTS = 64;
+    const auto no_op = [](s64, std::chrono::nanoseconds) -> OptionalDelay { return std::nullopt; };
+
+    ScopeInit guard;
+    auto& core_timing = guard.core_timing;
+
+    // Keep a realistic amount of events pending far in the future
+    std::vector<std::shared_ptr<Core::Timing::EventType>> background;
+    for (size_t i = 0; i < PENDING_EVENTS; ++i) {
+        background.push_back(Core::Timing::CreateEvent("background", no_op));
+        core_timing.ScheduleEvent(std::chrono::seconds{60 + i}, background.back());
+    }
+
+    for (const size_t num_threads : {1U, 4U}) {
+        std::vector<std::shared_ptr<Core::Timing::EventType>> events;
+        for (size_t i = 0; i < num_threads; ++i) {
+            events.push_back(Core::Timing::CreateEvent("contended", no_op));
+        }
+        BENCHMARK(std::to_string(num_threads) + " threads, " +
+                  std::to_string(OPERATIONS_PER_THREAD) + " reschedules per thread") {
+            std::vector<std::jthread> threads;
+            for (size_t i = 0; i < num_threads; ++i) {
+                threads.emplace_back([&core_timing, &event = events[i]] {
+                    for (size_t op = 0; op < OPERATIONS_PER_THREAD; ++op) {
+                        core_timing.UnscheduleEvent(event,
+                                                    Core::Timing::UnscheduleEventType::NoWait);
+                        core_timing.ScheduleEvent(std::chrono::seconds{1}, event);
+                    }
+                });
+            }
+            threads.clear();
+            return core_timing.HasPendingEvents();
+        };
+        for (const auto& event : events) {
+            core_timing.UnscheduleEvent(event);
+        }
+    }
+}
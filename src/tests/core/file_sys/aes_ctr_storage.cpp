@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "common/literals.h"
+#include "core/file_sys/fssystem/fssystem_aes_ctr_storage.h"
+#include "core/file_sys/fssystem/fssystem_crypto_pipeline.h"
+#include "core/file_sys/vfs/vfs_vector.h"
+
+namespace {
+using namespace Common::Literals;
+using namespace FileSys;
+
+constexpr std::array<u8, AesCtrStorage::KeySize> KEY{0x00, 0x11, 0x22, 0x33, 0x44, 0x55,
+                                                     0x66, 0x77, 0x88, 0x99, 0xAA, 0xBB,
+                                                     0xCC, 0xDD, 0xEE, 0xFF};
+
+std::vector<u8> RandomBytes(size_t size) {
+    std::mt19937 rng(static_cast<u32>(size));
+    std::vector<u8> data(size);
+    for (u8& value : data) {
+        value = static_cast<u8>(rng());
+    }
+    return data;
+}
+
+/// Builds a synthetic AES-CTR encrypted NCA section holding the given plain text.
+std::shared_ptr<AesCtrStorage> MakeEncryptedSection(const std::vector<u8>& plain_text) {
+    std::array<u8, AesCtrStorage::IvSize> iv{};
+    AesCtrStorage::MakeIv(iv.data(), iv.size(), 0x0123456789ABCDEF, 0);
+    auto storage = std::make_shared<AesCtrStorage>(
+        std::make_shared<VectorVfsFile>(std::vector<u8>(plain_text.size())), KEY.data(),
+        KEY.size(), iv.data(), iv.size());
+    storage->Write(plain_text.data(), plain_text.size(), 0);
+    return storage;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("AesCtrStorage[PipelinedRead]", "[core]") {
+    // Not a multiple of the chunk size, so the last chunk is partial
+    const auto plain_text = RandomBytes(8_MiB + 0x1230);
+    const auto storage = MakeEncryptedSection(plain_text);
+
+    for (const size_t offset : {size_t{0}, size_t{0x10}, size_t{0x3000}}) {
+        const size_t size = plain_text.size() - offset;
+        REQUIRE(CryptoPipeline::IsEnabled(size));
+
+        std::vector<u8> pipelined(size);
+        REQUIRE(storage->Read(pipelined.data(), size, offset) == size);
+        REQUIRE(std::equal(pipelined.begin(), pipelined.end(), plain_text.begin() + offset));
+
+        // Reads too small for the pipeline must agree with it
+        std::vector<u8> serial(size);
+        static constexpr size_t SERIAL_SIZE = 64_KiB;
+        for (size_t done = 0; done < size; done += SERIAL_SIZE) {
+            const size_t cur_size = std::min(SERIAL_SIZE, size - done);
+            REQUIRE(!CryptoPipeline::IsEnabled(cur_size));
+            storage->Read(serial.data() + done, cur_size, offset + done);
+        }
+        REQUIRE(serial == pipelined);
+    }
+}
+
+TEST_CASE("AesCtrStorage[Benchmark]", "[.][benchmark][core]") {
+    static constexpr size_t SECTION_SIZE = 256_MiB;
+    const auto storage = MakeEncryptedSection(RandomBytes(SECTION_SIZE));
+    std::vector<u8> buffer(8_MiB);
+    for (const size_t read_size : {64_KiB, 8_MiB}) {
+        const auto start{std::chrono::steady_clock::now()};
+        for (size_t offset = 0; offset < SECTION_SIZE; offset += read_size) {
+            storage->Read(buffer.data(), read_size, offset);
+        }
+        const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+        fmt::print("AES-CTR section, {} KiB reads ({}): {:.2f} GB/s\n", read_size / 1_KiB,
+                   CryptoPipeline::IsEnabled(read_size) ? "pipelined" : "serial",
+                   SECTION_SIZE / elapsed.count() / 1e9);
+    }
+}
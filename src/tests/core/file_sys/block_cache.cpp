@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/file_sys/fssystem/fssystem_block_cache.h"
+#include "core/file_sys/vfs/vfs_vector.h"
+
+namespace {
+using namespace FileSys;
+
+std::vector<u8> RandomBytes(size_t size) {
+    std::mt19937 rng(static_cast<u32>(size));
+    std::vector<u8> data(size);
+    for (u8& value : data) {
+        value = static_cast<u8>(rng());
+    }
+    return data;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("BlockCache[Read]", "[core]") {
+    // Not a multiple of the block size, so the last block is partial
+    const auto data = RandomBytes(1_MiB + 0x123);
+    BlockCache cache(BlockCache::ShardCount * 8 * BlockCacheBlockSize);
+    const auto base = std::make_shared<VectorVfsFile>(data);
+    const BlockCacheStorage storage(base, cache);
+
+    std::mt19937 rng(1234);
+    std::vector<u8> buffer(3 * BlockCacheBlockSize);
+    for (int i = 0; i < 1000; i++) {
+        const size_t offset = rng() % data.size();
+        const size_t size = rng() % buffer.size();
+        const size_t expected_size = std::min(size, data.size() - offset);
+        REQUIRE(storage.Read(buffer.data(), size, offset) == expected_size);
+        REQUIRE(std::equal(buffer.begin(), buffer.begin() + expected_size, data.begin() + offset));
+    }
+
+    const auto stats = cache.GetStats();
+    REQUIRE(stats.hits > 0);
+    REQUIRE(stats.misses > 0);
+    REQUIRE(stats.used_size <= stats.capacity);
+
+    // Repeated reads of the same block are served from the cache
+    storage.Read(buffer.data(), 0x100, 0x10);
+    const u64 hits = cache.GetStats().hits;
+    storage.Read(buffer.data(), 0x100, 0x10);
+    REQUIRE(cache.GetStats().hits == hits + 1);
+
+    // Shrinking the budget evicts blocks
+    cache.SetCapacity(0);
+    REQUIRE(cache.GetStats().used_size == 0);
+    REQUIRE(storage.Read(buffer.data(), 0x100, 0x10) == 0x100);
+    REQUIRE(std::equal(buffer.begin(), buffer.begin() + 0x100, data.begin() + 0x10));
+}
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "common/literals.h"
+#include "core/file_sys/vfs/vfs_real.h"
+
+namespace {
+using namespace Common::Literals;
+using namespace FileSys;
+
+/// Temporary file removed when going out of scope.
+class TemporaryFile {
+public:
+    explicit TemporaryFile(size_t size)
+        : path{std::filesystem::temp_directory_path() /
+               fmt::format("citron_real_vfs_file_{}.bin", size)},
+          data(size) {
+        std::mt19937 rng(static_cast<u32>(size));
+        for (u8& value : data) {
+            value = static_cast<u8>(rng());
+        }
+        std::ofstream file(path, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()),
+                   static_cast<std::streamsize>(data.size()));
+    }
+
+    ~TemporaryFile() {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+
+    std::string GetPath() const {
+        return path.string();
+    }
+
+    const std::vector<u8>& GetData() const {
+        return data;
+    }
+
+private:
+    std::filesystem::path path;
+    std::vector<u8> data;
+};
+
+} // Anonymous namespace
+
+TEST_CASE("RealVfsFile[MappedRead]", "[core]") {
+    const TemporaryFile temporary_file(16_MiB + 0x123);
+    const TemporaryFile writable_file(16_MiB + 0x456);
+    const auto& data = temporary_file.GetData();
+    RealVfsFilesystem filesystem;
+
+    // Read-only files this large are mapped, writable ones are not. Files are cached by path, so
+    // the writable one is another file.
+    const auto mapped = filesystem.OpenFile(temporary_file.GetPath(), OpenMode::Read);
+    const auto writable = filesystem.OpenFile(writable_file.GetPath(), OpenMode::ReadWrite);
+    REQUIRE(mapped != nullptr);
+    REQUIRE(writable != nullptr);
+    REQUIRE(mapped->GetSize() == data.size());
+
+    const auto view = mapped->ReadView(0x100, 0x1000);
+    REQUIRE(view.size() == 0x100);
+    REQUIRE(std::equal(view.begin(), view.end(), data.begin() + 0x1000));
+    REQUIRE(writable->ReadView(0x100, 0x1000).empty());
+
+    std::vector<u8> buffer(64_KiB);
+    for (const size_t offset : {size_t{0}, size_t{12345}, data.size() - 0x100}) {
+        const size_t expected_size = std::min(buffer.size(), data.size() - offset);
+        REQUIRE(mapped->Read(buffer.data(), buffer.size(), offset) == expected_size);
+        REQUIRE(std::equal(buffer.begin(), buffer.begin() + expected_size, data.begin() + offset));
+    }
+    REQUIRE(mapped->Read(buffer.data(), buffer.size(), data.size()) == 0);
+
+    // Recreating the file truncates it, the mapping is dropped instead of faulting on later reads
+    REQUIRE(filesystem.CreateFile(temporary_file.GetPath(), OpenMode::Read) != nullptr);
+    REQUIRE(mapped->Read(buffer.data(), buffer.size(), 0) == 0);
+    REQUIRE(mapped->ReadView(0x100, 0).empty());
+}
+
+TEST_CASE("RealVfsFile[Benchmark]", "[.][benchmark][core]") {
+    static constexpr size_t READ_SIZE = 64_KiB;
+    static constexpr size_t READS_PER_THREAD = 0x4000;
+    const TemporaryFile temporary_file(512_MiB);
+    const size_t file_size = temporary_file.GetData().size();
+
+    // Writable files use the locked file reads. Files are cached by path, so each mode opens the
+    // file through its own filesystem.
+    for (const OpenMode mode : {OpenMode::ReadWrite, OpenMode::Read}) {
+        RealVfsFilesystem filesystem;
+        const auto file = filesystem.OpenFile(temporary_file.GetPath(), mode);
+        for (const u32 num_threads : {1U, 4U, 8U}) {
+            const auto start{std::chrono::steady_clock::now()};
+            {
+                std::vector<std::jthread> threads;
+                for (u32 thread = 0; thread < num_threads; ++thread) {
+                    threads.emplace_back([&file, file_size, thread] {
+                        std::mt19937_64 rng(thread);
+                        std::vector<u8> buffer(READ_SIZE);
+                        for (size_t i = 0; i < READS_PER_THREAD; ++i) {
+                            const size_t offset = (rng() % (file_size - READ_SIZE)) & ~0xFFFULL;
+                            file->Read(buffer.data(), READ_SIZE, offset);
+                        }
+                    });
+                }
+            }
+            const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+            const double total_bytes = double(num_threads) * READS_PER_THREAD * READ_SIZE;
+            fmt::print("{} random 64 KiB reads, {} threads: {:.2f} GB/s\n",
+                       mode == OpenMode::Read ? "mapped" : "file", num_threads,
+                       total_bytes / elapsed.count() / 1e9);
+        }
+    }
+}
@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "core/file_sys/registered_cache.h"
+#include "core/file_sys/registered_cache_index.h"
+#include "core/file_sys/vfs/vfs_real.h"
+
+namespace {
+using namespace FileSys;
+
+/// Temporary directory removed when going out of scope.
+class TemporaryDirectory {
+public:
+    explicit TemporaryDirectory(std::string_view name)
+        : path{std::filesystem::temp_directory_path() / name} {
+        std::filesystem::remove_all(path);
+        std::filesystem::create_directories(path);
+    }
+
+    ~TemporaryDirectory() {
+        std::error_code ec;
+        std::filesystem::remove_all(path, ec);
+    }
+
+    const std::filesystem::path& GetPath() const {
+        return path;
+    }
+
+private:
+    std::filesystem::path path;
+};
+
+} // Anonymous namespace
+
+TEST_CASE("RegisteredCacheIndex[RoundTrip]", "[core]") {
+    const TemporaryDirectory directory("citron_registered_cache_index");
+    const auto index_path = directory.GetPath() / "index.bin";
+    const std::array<u8, 4> cnmt{1, 2, 3, 4};
+
+    {
+        RegisteredCacheIndex index(index_path, "/nand");
+        REQUIRE(!index.Find("/a.nca", 0x100, 1));
+        index.Insert("/a.nca", {.size = 0x100, .modified = 1, .title_id = 0, .cnmt = {}});
+        index.Insert("/b.nca", {.size = 0x200, .modified = 2, .title_id = 0x1234, .cnmt = cnmt});
+        REQUIRE(index.Save());
+    }
+
+    {
+        RegisteredCacheIndex index(index_path, "/nand");
+        const auto meta = index.Find("/b.nca", 0x200, 2);
+        REQUIRE(meta);
+        REQUIRE(meta->title_id == 0x1234);
+        REQUIRE(std::equal(meta->cnmt.begin(), meta->cnmt.end(), cnmt.begin(), cnmt.end()));
+        REQUIRE(index.Find("/a.nca", 0x100, 1));
+
+        // Changed files miss
+        REQUIRE(!index.Find("/a.nca", 0x101, 1));
+        REQUIRE(!index.Find("/a.nca", 0x100, 3));
+    }
+
+    // Indexes written for another directory are ignored
+    RegisteredCacheIndex index(index_path, "/sdmc");
+    REQUIRE(!index.Find("/a.nca", 0x100, 1));
+}
+
+TEST_CASE("RegisteredCacheIndex[Corrupted]", "[core]") {
+    const TemporaryDirectory directory("citron_registered_cache_index_corrupted");
+    const auto index_path = directory.GetPath() / "index.bin";
+    {
+        RegisteredCacheIndex index(index_path, "/nand");
+        index.Insert("/a.nca", {.size = 0x100, .modified = 1, .title_id = 0, .cnmt = {}});
+        REQUIRE(index.Save());
+    }
+
+    // An entry count larger than what the file holds is rejected before anything is allocated
+    {
+        std::fstream file(index_path, std::ios::in | std::ios::out | std::ios::binary);
+        const u32 num_entries = std::numeric_limits<u32>::max();
+        file.seekp(0x10);
+        file.write(reinterpret_cast<const char*>(&num_entries), sizeof(num_entries));
+    }
+    RegisteredCacheIndex index(index_path, "/nand");
+    REQUIRE(!index.Find("/a.nca", 0x100, 1));
+}
+
+TEST_CASE("RegisteredCacheIndex[Benchmark]", "[.][benchmark][core]") {
+    static constexpr size_t NUM_ENTRIES = 4000;
+    const TemporaryDirectory directory("citron_registered_cache_benchmark");
+    const auto nand_path = directory.GetPath() / "registered";
+    const auto index_path = directory.GetPath() / "index.bin";
+    std::filesystem::create_directories(nand_path);
+
+    // Synthetic NCAs laid out as installed ones, in the two-digit directory of their id hash
+    {
+        RealVfsFilesystem filesystem;
+        const PlaceholderCache placeholders(
+            filesystem.OpenDirectory(nand_path.string(), OpenMode::ReadWrite));
+        std::mt19937_64 rng(1234);
+        std::vector<u8> data(0x4000);
+        for (size_t i = 0; i < NUM_ENTRIES; ++i) {
+            NcaID id;
+            std::ranges::generate(id, [&] { return static_cast<u8>(rng()); });
+            std::ranges::generate(data, [&] { return static_cast<u8>(rng()); });
+            REQUIRE(placeholders.Create(id, data.size()));
+            REQUIRE(placeholders.Write(id, 0, data));
+        }
+    }
+
+    // The first indexed refresh parses everything and writes the index, the second one reads it
+    static constexpr std::array RUNS{std::tuple{"no index", false, NUM_ENTRIES},
+                                     std::tuple{"cold index", true, NUM_ENTRIES},
+                                     std::tuple{"warm index", true, size_t{0}}};
+    for (const auto& [label, indexed, expected_parsed] : RUNS) {
+        RealVfsFilesystem filesystem;
+        const auto dir = filesystem.OpenDirectory(nand_path.string(), OpenMode::Read);
+        size_t num_parsed{};
+        const auto parse{[&num_parsed](const VirtualFile& file, const NcaID&) {
+            ++num_parsed;
+            return file;
+        }};
+        const auto start{std::chrono::steady_clock::now()};
+        const RegisteredCache cache(dir, indexed ? index_path : std::filesystem::path{}, parse);
+        const std::chrono::duration<double, std::milli> elapsed{std::chrono::steady_clock::now() -
+                                                                start};
+        fmt::print("Refresh of {} NCAs, {}: {:.1f} ms\n", NUM_ENTRIES, label, elapsed.count());
+
+        // Every NCA is found, and only parsed when the index doesn't have it
+        REQUIRE(num_parsed == expected_parsed);
+    }
+}
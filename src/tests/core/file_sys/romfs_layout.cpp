@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "core/file_sys/romfs.h"
+#include "core/file_sys/vfs/vfs_vector.h"
+
+namespace {
+using namespace FileSys;
+
+VirtualDir MakeTree(size_t num_dirs, size_t files_per_dir) {
+    std::vector<VirtualDir> dirs;
+    for (size_t dir = 0; dir < num_dirs; ++dir) {
+        std::vector<VirtualFile> files;
+        for (size_t file = 0; file < files_per_dir; ++file) {
+            std::vector<u8> data(dir * 7 + file * 13 + 1, static_cast<u8>(dir ^ file));
+            files.push_back(std::make_shared<VectorVfsFile>(std::move(data),
+                                                            fmt::format("file{}.bin", file)));
+        }
+        dirs.push_back(std::make_shared<VectorVfsDirectory>(std::move(files),
+                                                            std::vector<VirtualDir>{},
+                                                            fmt::format("dir{}", dir)));
+    }
+    return std::make_shared<VectorVfsDirectory>(std::vector<VirtualFile>{}, std::move(dirs));
+}
+
+} // Anonymous namespace
+
+TEST_CASE("RomFS[SavedLayout]", "[core]") {
+    const auto layout_path = std::filesystem::temp_directory_path() / "citron_romfs_layout.bin";
+    const auto tree = MakeTree(8, 16);
+
+    const auto built = CreateRomFS(tree, nullptr, layout_path, 1234);
+    REQUIRE(built != nullptr);
+    REQUIRE(OpenRomFSLayout(tree, nullptr, layout_path, 4321) == nullptr);
+
+    // The saved layout produces the same RomFS, reading the files of the tree lazily
+    const auto loaded = OpenRomFSLayout(tree, nullptr, layout_path, 1234);
+    REQUIRE(loaded != nullptr);
+    REQUIRE(loaded->ReadAllBytes() == built->ReadAllBytes());
+    REQUIRE(loaded->ReadAllBytes() == CreateRomFS(tree)->ReadAllBytes());
+
+    // A file count larger than what the layout holds is rejected before anything is allocated
+    {
+        std::fstream file(layout_path, std::ios::in | std::ios::out | std::ios::binary);
+        const u64 num_files = std::numeric_limits<u64>::max() / 2;
+        file.seekp(0x10);
+        file.write(reinterpret_cast<const char*>(&num_files), sizeof(num_files));
+    }
+    REQUIRE(OpenRomFSLayout(tree, nullptr, layout_path, 1234) == nullptr);
+
+    std::filesystem::remove(layout_path);
+}
@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "core/file_sys/vfs/vfs_concat.h"
+#include "core/file_sys/vfs/vfs_copy_stats.h"
+#include "core/file_sys/vfs/vfs_offset.h"
+#include "core/file_sys/vfs/vfs_vector.h"
+
+namespace {
+using namespace FileSys;
+
+std::vector<u8> Iota(size_t size, u8 first) {
+    std::vector<u8> data(size);
+    std::iota(data.begin(), data.end(), first);
+    return data;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("VfsFile[ReadView]", "[core]") {
+    const auto first = Iota(0x100, 0);
+    const auto second = Iota(0x80, 0x40);
+    std::vector<VirtualFile> files{std::make_shared<VectorVfsFile>(first),
+                                   std::make_shared<VectorVfsFile>(second)};
+    const auto concat = ConcatenatedVfsFile::MakeConcatenatedFile("concat", std::move(files));
+    const auto offset = std::make_shared<OffsetVfsFile>(concat, 0x100, 0x40);
+
+    // Views within one file are lent without copying
+    const auto before = GetCopyStats();
+    const auto view = offset->ReadView(0x20, 0x10);
+    REQUIRE(view.size() == 0x20);
+    REQUIRE(std::equal(view.begin(), view.end(), first.begin() + 0x50));
+    REQUIRE(GetCopyStats() == before);
+
+    // Views are trimmed to the end of the file
+    const auto tail = offset->ReadView(0x100, 0xF0);
+    REQUIRE(tail.size() == 0x10);
+    REQUIRE(std::equal(tail.begin(), tail.end(), second.begin() + 0x30));
+
+    // Spanning both files needs a copy, which Read still makes
+    REQUIRE(offset->ReadView(0x20, 0xB0).empty());
+    std::vector<u8> buffer(0x20);
+    REQUIRE(offset->Read(buffer.data(), buffer.size(), 0xB0) == buffer.size());
+    REQUIRE(std::equal(buffer.begin(), buffer.begin() + 0x10, first.begin() + 0xF0));
+    REQUIRE(std::equal(buffer.begin() + 0x10, buffer.end(), second.begin()));
+
+    const auto after = GetCopyStats();
+    const auto vector_layer = static_cast<size_t>(CopyLayer::VectorFile);
+    REQUIRE(after[vector_layer] - before[vector_layer] == buffer.size());
+
+    REQUIRE(offset->ReadView(0x10, 0x100).empty());
+}
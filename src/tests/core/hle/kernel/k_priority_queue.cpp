@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "core/hle/kernel/k_affinity_mask.h"
+#include "core/hle/kernel/k_priority_queue.h"
+
+namespace {
+using namespace Kernel;
+
+constexpr size_t NumCores = 4;
+constexpr s32 LowestPriority = 63;
+constexpr s32 HighestPriority = 0;
+
+/// Stand-in for KThread with only what the priority queue uses.
+class TestThread {
+public:
+    class QueueEntry {
+    public:
+        constexpr void Initialize() {
+            m_prev = nullptr;
+            m_next = nullptr;
+        }
+
+        constexpr TestThread* GetPrev() const {
+            return m_prev;
+        }
+        constexpr TestThread* GetNext() const {
+            return m_next;
+        }
+        constexpr void SetPrev(TestThread* thread) {
+            m_prev = thread;
+        }
+        constexpr void SetNext(TestThread* thread) {
+            m_next = thread;
+        }
+
+    private:
+        TestThread* m_prev{};
+        TestThread* m_next{};
+    };
+
+    QueueEntry& GetPriorityQueueEntry(s32 core) {
+        return m_entries[core];
+    }
+    const QueueEntry& GetPriorityQueueEntry(s32 core) const {
+        return m_entries[core];
+    }
+
+    const KAffinityMask& GetAffinityMask() const {
+        return m_affinity;
+    }
+    KAffinityMask& GetAffinityMask() {
+        return m_affinity;
+    }
+
+    s32 GetActiveCore() const {
+        return m_core;
+    }
+    void SetActiveCore(s32 core) {
+        m_core = core;
+    }
+
+    s32 GetPriority() const {
+        return m_priority;
+    }
+    void SetPriority(s32 priority) {
+        m_priority = priority;
+    }
+
+    bool IsDummyThread() const {
+        return false;
+    }
+
+    bool runnable{};
+
+private:
+    std::array<QueueEntry, NumCores> m_entries{};
+    KAffinityMask m_affinity;
+    s32 m_core{};
+    s32 m_priority{};
+};
+
+template <bool UseArrayQueues>
+using TestQueue =
+    KPriorityQueue<TestThread, NumCores, LowestPriority, HighestPriority, UseArrayQueues>;
+
+std::vector<TestThread> MakeThreads(size_t count, std::mt19937& rng) {
+    std::vector<TestThread> threads(count);
+    for (TestThread& thread : threads) {
+        const u64 affinity = (rng() % ((1U << NumCores) - 1)) + 1;
+        thread.GetAffinityMask().SetAffinityMask(affinity);
+        thread.SetActiveCore(std::countr_zero(affinity));
+        thread.SetPriority(static_cast<s32>(24 + rng() % 16));
+    }
+    return threads;
+}
+
+/// Walks the queues the way KScheduler::UpdateHighestPriorityThreads does.
+template <typename Queue>
+void Visit(const Queue& queue, s32 core, std::vector<const TestThread*>& out) {
+    out.push_back(queue.GetScheduledFront(core));
+    for (const TestThread* thread = queue.GetSuggestedFront(core); thread != nullptr;
+         thread = queue.GetSuggestedNext(core, thread)) {
+        out.push_back(thread);
+        if (const TestThread* same = queue.GetSamePriorityNext(core, thread)) {
+            out.push_back(same);
+        }
+    }
+}
+
+/**
+ * Simulates a thread waking or going back to sleep on a condition variable, or the occasional
+ * yield, priority change and migration, applying the operation to all the given queues.
+ */
+template <typename... Queues>
+void Step(std::vector<TestThread>& threads, std::mt19937& rng, Queues&... queues) {
+    TestThread& thread = threads[rng() % threads.size()];
+    const u32 op = rng() % 16;
+    if (!thread.runnable) {
+        thread.runnable = true;
+        (queues.PushBack(&thread), ...);
+    } else if (op < 10) {
+        thread.runnable = false;
+        (queues.Remove(&thread), ...);
+    } else if (op < 12) {
+        (queues.MoveToScheduledBack(&thread), ...);
+    } else if (op < 14) {
+        const s32 prev_priority = thread.GetPriority();
+        thread.SetPriority(static_cast<s32>(24 + rng() % 16));
+        (queues.ChangePriority(prev_priority, op == 13, &thread), ...);
+    } else {
+        const s32 prev_core = thread.GetActiveCore();
+        const s32 core = static_cast<s32>(rng() % NumCores);
+        if (thread.GetAffinityMask().GetAffinity(core)) {
+            thread.SetActiveCore(core);
+            (queues.ChangeCore(prev_core, &thread, op == 15), ...);
+        }
+    }
+}
+
+} // Anonymous namespace
+
+TEST_CASE("KPriorityQueue[ArrayQueues]", "[core]") {
+    std::mt19937 rng(1234);
+    auto threads = MakeThreads(64, rng);
+    TestQueue<false> linked_queue;
+    TestQueue<true> array_queue;
+
+    // Both layouts must schedule identically
+    std::vector<const TestThread*> linked_visited;
+    std::vector<const TestThread*> array_visited;
+    for (int i = 0; i < 5000; ++i) {
+        Step(threads, rng, linked_queue, array_queue);
+        linked_visited.clear();
+        array_visited.clear();
+        for (s32 core = 0; core < static_cast<s32>(NumCores); ++core) {
+            Visit(linked_queue, core, linked_visited);
+            Visit(array_queue, core, array_visited);
+        }
+        REQUIRE(linked_visited == array_visited);
+    }
+}
+
+TEST_CASE("KPriorityQueue[Benchmark]", "[.][benchmark][core]") {
+    static constexpr size_t NUM_STEPS = 200000;
+
+    const auto run = [](auto& queue, std::string_view label) {
+        std::mt19937 rng(1234);
+        auto threads = MakeThreads(96, rng);
+        std::vector<const TestThread*> visited;
+
+        const auto start{std::chrono::steady_clock::now()};
+        for (size_t step = 0; step < NUM_STEPS; ++step) {
+            Step(threads, rng, queue);
+            visited.clear();
+            for (s32 core = 0; core < static_cast<s32>(NumCores); ++core) {
+                Visit(queue, core, visited);
+            }
+        }
+        const std::chrono::duration<double, std::milli> elapsed{std::chrono::steady_clock::now() -
+                                                                start};
+        fmt::print("{} scheduler steps, {} queues: {:.1f} ms\n", NUM_STEPS, label,
+                   elapsed.count());
+    };
+    TestQueue<false> linked_queue;
+    TestQueue<true> array_queue;
+    run(linked_queue, "linked");
+    run(array_queue, "array");
+}
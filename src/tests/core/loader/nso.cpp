@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_funcs.h"
+#include "common/lz4_compression.h"
+#include "common/settings.h"
+#include "core/file_sys/vfs/vfs_vector.h"
+#include "core/loader/nso.h"
+
+namespace {
+using namespace Loader;
+
+constexpr std::array<u32, 3> SEGMENT_SIZES{0x2345, 0x800, 0x123};
+constexpr std::array<u32, 3> SEGMENT_LOCATIONS{0, 0x3000, 0x4000};
+constexpr u32 BSS_SIZE = 0x1800;
+
+std::vector<u8> SegmentData(size_t segment) {
+    std::vector<u8> data(SEGMENT_SIZES[segment]);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<u8>(i * 7 + segment);
+    }
+    return data;
+}
+
+/// NSO with a compressed text segment and uncompressed rodata and data segments.
+FileSys::VirtualFile MakeNSO() {
+    NSOHeader header{};
+    header.magic = Common::MakeMagic('N', 'S', 'O', '0');
+    header.flags = 1;
+    std::vector<u8> body;
+    for (size_t segment = 0; segment < 3; ++segment) {
+        std::vector<u8> data = SegmentData(segment);
+        if (segment == 0) {
+            data = Common::Compression::CompressDataLZ4(data.data(), data.size());
+        }
+        header.segments[segment] = {
+            .offset = static_cast<u32>(sizeof(NSOHeader) + body.size()),
+            .location = SEGMENT_LOCATIONS[segment],
+            .size = SEGMENT_SIZES[segment],
+            .alignment = 0,
+        };
+        header.segments_compressed_size[segment] = static_cast<u32>(data.size());
+        body.insert(body.end(), data.begin(), data.end());
+    }
+    header.segments[2].bss_size = BSS_SIZE;
+
+    std::vector<u8> file(sizeof(NSOHeader));
+    std::memcpy(file.data(), &header, sizeof(NSOHeader));
+    file.insert(file.end(), body.begin(), body.end());
+    return std::make_shared<FileSys::VectorVfsFile>(std::move(file), "main");
+}
+
+} // Anonymous namespace
+
+TEST_CASE("NSO[DecodeAndLayout]", "[core]") {
+    const std::array files{MakeNSO(), FileSys::VirtualFile{}};
+    const auto images = AppLoader_NSO::DecodeModules(files);
+    REQUIRE(images.size() == 2);
+    REQUIRE(images[0]);
+    REQUIRE(!images[1]);
+
+    // Segments are decoded at their location
+    const NSOImage& image = *images[0];
+    REQUIRE(image.program_image.size() == SEGMENT_LOCATIONS[2] + SEGMENT_SIZES[2]);
+    for (size_t segment = 0; segment < 3; ++segment) {
+        const auto data = SegmentData(segment);
+        REQUIRE(std::equal(data.begin(), data.end(),
+                           image.program_image.begin() + SEGMENT_LOCATIONS[segment]));
+    }
+
+    // The next module starts after the page aligned data and bss, and the arguments when passed
+    static constexpr VAddr LOAD_BASE = 0x10000;
+    REQUIRE(AppLoader_NSO::LayoutModule(image, LOAD_BASE, false) == LOAD_BASE + 0x6000);
+    const auto program_args = Settings::values.program_args.GetValue();
+    Settings::values.program_args = "-arg";
+    REQUIRE(AppLoader_NSO::LayoutModule(image, LOAD_BASE, true) ==
+            LOAD_BASE + 0x6000 + NSO_ARGUMENT_DATA_ALLOCATION_SIZE);
+    Settings::values.program_args = program_args;
+}
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/ir_emitter.h"
+#include "shader_recompiler/frontend/ir/post_order.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/object_pool.h"
+
+namespace {
+using namespace Shader;
+
+struct TestProgram {
+    explicit TestProgram(size_t num_blocks) {
+        for (size_t index = 0; index < num_blocks; ++index) {
+            IR::Block* const block{block_pool.Create(inst_pool)};
+            block->SetOrder(static_cast<u32>(index));
+            IR::AbstractSyntaxNode node{};
+            node.type = IR::AbstractSyntaxNode::Type::Block;
+            node.data.block = block;
+            program.syntax_list.push_back(node);
+            program.blocks.push_back(block);
+        }
+        program.stage = Stage::Fragment;
+    }
+
+    IR::IREmitter Emitter(size_t index) {
+        return IR::IREmitter{*program.blocks[index]};
+    }
+
+    void Optimize() {
+        program.post_order_blocks = IR::PostOrder(program.syntax_list.front());
+        Optimization::GlobalValueNumberingPass(program);
+        Optimization::DeadCodeEliminationPass(program);
+    }
+
+    size_t Count(size_t index, IR::Opcode opcode) const {
+        const IR::Block::InstructionList& insts{program.blocks[index]->Instructions()};
+        return static_cast<size_t>(std::ranges::count(insts, opcode, &IR::Inst::GetOpcode));
+    }
+
+    ObjectPool<IR::Inst> inst_pool;
+    ObjectPool<IR::Block> block_pool;
+    IR::Program program;
+};
+
+} // Anonymous namespace
+
+TEST_CASE("GlobalValueNumbering[Dominance]", "[shader]") {
+    // 0 -> 1, 0 -> 2, 1 -> 3, 2 -> 3
+    TestProgram test(4);
+    IR::Block* const* const blocks{test.program.blocks.data()};
+    blocks[0]->AddBranch(blocks[1]);
+    blocks[0]->AddBranch(blocks[2]);
+    blocks[1]->AddBranch(blocks[3]);
+    blocks[2]->AddBranch(blocks[3]);
+
+    const IR::U32 binding{IR::Value{0U}};
+    const IR::U32 offset{IR::Value{16U}};
+    const auto add_cbufs{[&](size_t index, bool swap) {
+        IR::IREmitter ir{test.Emitter(index)};
+        const IR::U32 a{ir.GetCbuf(binding, offset)};
+        const IR::U32 b{ir.GetCbuf(binding, ir.Imm32(32))};
+        const IR::U32 sum{swap ? ir.IAdd(b, a) : ir.IAdd(a, b)};
+        ir.SetAttribute(IR::Attribute::Generic0X + index, ir.BitCast<IR::F32>(sum), ir.Imm32(0));
+    }};
+    add_cbufs(0, false);
+    add_cbufs(1, true);
+    add_cbufs(2, false);
+    add_cbufs(3, true);
+    {
+        // Duplicates in the same block, reading written attributes is kept
+        IR::IREmitter ir{test.Emitter(3)};
+        const IR::F32 front_face{ir.GetAttribute(IR::Attribute::FrontFace)};
+        const IR::F32 generic{ir.GetAttribute(IR::Attribute::Generic0X)};
+        ir.SetAttribute(IR::Attribute::Generic1Y, IR::F32{ir.FPAdd(front_face, generic)},
+                        ir.Imm32(0));
+        ir.SetAttribute(IR::Attribute::Generic1Z,
+                        IR::F32{ir.FPAdd(ir.GetAttribute(IR::Attribute::FrontFace),
+                                         ir.GetAttribute(IR::Attribute::Generic0X))},
+                        ir.Imm32(0));
+        const IR::U64 address{ir.Imm64(u64{0x1000})};
+        const IR::U32 sum{ir.IAdd(ir.LoadGlobal32(address), ir.LoadGlobal32(address))};
+        ir.SetAttribute(IR::Attribute::Generic1W, ir.BitCast<IR::F32>(sum), ir.Imm32(0));
+    }
+    test.Optimize();
+
+    // Everything the entry block computes is reused by the blocks it dominates
+    REQUIRE(test.Count(0, IR::Opcode::GetCbufU32) == 2);
+    REQUIRE(test.Count(0, IR::Opcode::IAdd32) == 1);
+    for (size_t index = 1; index < 4; ++index) {
+        REQUIRE(test.Count(index, IR::Opcode::GetCbufU32) == 0);
+    }
+    REQUIRE(test.Count(1, IR::Opcode::IAdd32) == 0);
+    REQUIRE(test.Count(2, IR::Opcode::IAdd32) == 0);
+
+    // FrontFace is read once, Generic0X is written by the entry block
+    REQUIRE(test.Count(3, IR::Opcode::GetAttribute) == 3);
+    REQUIRE(test.Count(3, IR::Opcode::FPAdd32) == 2);
+    REQUIRE(test.Count(3, IR::Opcode::LoadGlobal32) == 2);
+    REQUIRE(test.Count(3, IR::Opcode::IAdd32) == 1);
+}
+
+TEST_CASE("GlobalValueNumbering[Siblings]", "[shader]") {
+    // 0 -> 1, 0 -> 2, 1 -> 3, 2 -> 3
+    TestProgram test(4);
+    IR::Block* const* const blocks{test.program.blocks.data()};
+    blocks[0]->AddBranch(blocks[1]);
+    blocks[0]->AddBranch(blocks[2]);
+    blocks[1]->AddBranch(blocks[3]);
+    blocks[2]->AddBranch(blocks[3]);
+
+    const auto mul_position{[&](size_t index) {
+        IR::IREmitter ir{test.Emitter(index)};
+        const IR::F32 x{ir.GetAttribute(IR::Attribute::PositionX)};
+        ir.SetAttribute(IR::Attribute::Generic0X + index, IR::F32{ir.FPMul(x, x)}, ir.Imm32(0));
+    }};
+    mul_position(1);
+    mul_position(2);
+    mul_position(3);
+    test.Optimize();
+
+    // Neither branch dominates the other or the merge block
+    for (size_t index = 1; index < 4; ++index) {
+        REQUIRE(test.Count(index, IR::Opcode::GetAttribute) == 1);
+        REQUIRE(test.Count(index, IR::Opcode::FPMul32) == 1);
+    }
+}
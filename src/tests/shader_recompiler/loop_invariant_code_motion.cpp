@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/ir_emitter.h"
+#include "shader_recompiler/frontend/ir/post_order.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/object_pool.h"
+
+namespace {
+using namespace Shader;
+
+constexpr size_t PREHEADER = 0;
+constexpr size_t HEADER = 1;
+constexpr size_t BODY = 2;
+constexpr size_t CONTINUE = 3;
+constexpr size_t MERGE = 4;
+
+/// Program with a single loop, the body accumulates into R0 until it reaches 100
+struct LoopProgram {
+    LoopProgram() {
+        for (u32 index = 0; index <= MERGE; ++index) {
+            IR::Block* const block{block_pool.Create(inst_pool)};
+            block->SetOrder(index);
+            program.blocks.push_back(block);
+        }
+        IR::Block* const* const blocks{program.blocks.data()};
+        blocks[PREHEADER]->AddBranch(blocks[HEADER]);
+        blocks[HEADER]->AddBranch(blocks[BODY]);
+        blocks[BODY]->AddBranch(blocks[CONTINUE]);
+        blocks[CONTINUE]->AddBranch(blocks[HEADER]);
+        blocks[CONTINUE]->AddBranch(blocks[MERGE]);
+
+        IR::IREmitter{*blocks[PREHEADER]}.SetReg(IR::Reg::R0, IR::U32{IR::Value{0U}});
+        IR::IREmitter merge{*blocks[MERGE]};
+        merge.SetAttribute(IR::Attribute::Generic0X,
+                           merge.BitCast<IR::F32>(merge.GetReg(IR::Reg::R0)), merge.Imm32(0));
+        program.stage = Stage::Fragment;
+    }
+
+    IR::IREmitter Emitter(size_t index) {
+        return IR::IREmitter{*program.blocks[index]};
+    }
+
+    size_t Optimize() {
+        IR::IREmitter ir{Emitter(CONTINUE)};
+        const IR::U1 less{ir.ILessThan(ir.GetReg(IR::Reg::R0), ir.Imm32(100), false)};
+        const IR::U1 cond{ir.ConditionRef(less)};
+
+        IR::Block* const* const blocks{program.blocks.data()};
+        const auto add_node{[&](IR::AbstractSyntaxNode::Type type) -> IR::AbstractSyntaxNode& {
+            IR::AbstractSyntaxNode& node{program.syntax_list.emplace_back()};
+            node.type = type;
+            return node;
+        }};
+        add_node(IR::AbstractSyntaxNode::Type::Block).data.block = blocks[PREHEADER];
+        add_node(IR::AbstractSyntaxNode::Type::Block).data.block = blocks[HEADER];
+        auto& loop{add_node(IR::AbstractSyntaxNode::Type::Loop).data.loop};
+        loop.body = blocks[BODY];
+        loop.continue_block = blocks[CONTINUE];
+        loop.merge = blocks[MERGE];
+        add_node(IR::AbstractSyntaxNode::Type::Block).data.block = blocks[BODY];
+        add_node(IR::AbstractSyntaxNode::Type::Block).data.block = blocks[CONTINUE];
+        auto& repeat{add_node(IR::AbstractSyntaxNode::Type::Repeat).data.repeat};
+        repeat.cond = cond;
+        repeat.loop_header = blocks[HEADER];
+        repeat.merge = blocks[MERGE];
+        add_node(IR::AbstractSyntaxNode::Type::Block).data.block = blocks[MERGE];
+        add_node(IR::AbstractSyntaxNode::Type::Return);
+
+        program.post_order_blocks = IR::PostOrder(program.syntax_list.front());
+        Optimization::SsaRewritePass(program);
+        const size_t num_hoisted{Optimization::LoopInvariantCodeMotionPass(program)};
+        Optimization::DeadCodeEliminationPass(program);
+        Optimization::VerificationPass(program);
+        return num_hoisted;
+    }
+
+    size_t Count(size_t index, IR::Opcode opcode) const {
+        const IR::Block::InstructionList& insts{program.blocks[index]->Instructions()};
+        return static_cast<size_t>(std::ranges::count(insts, opcode, &IR::Inst::GetOpcode));
+    }
+
+    ObjectPool<IR::Inst> inst_pool;
+    ObjectPool<IR::Block> block_pool;
+    IR::Program program;
+};
+
+} // Anonymous namespace
+
+TEST_CASE("LoopInvariantCodeMotion[Hoist]", "[shader]") {
+    LoopProgram test;
+    {
+        // R0 += cbuf[0][cbuf[0][16] * 4 + 32] * 3
+        IR::IREmitter ir{test.Emitter(BODY)};
+        const IR::U32 binding{ir.Imm32(0)};
+        const IR::U32 index{ir.GetCbuf(binding, ir.Imm32(16))};
+        const IR::U32 offset{ir.IAdd(ir.ShiftLeftLogical(index, ir.Imm32(2)), ir.Imm32(32))};
+        const IR::U32 scaled{ir.IMul(ir.GetCbuf(binding, offset), ir.Imm32(3))};
+        ir.SetReg(IR::Reg::R0, ir.IAdd(ir.GetReg(IR::Reg::R0), scaled));
+    }
+    REQUIRE(test.Optimize() == 5);
+
+    // Only the accumulation is left in the loop
+    REQUIRE(test.Count(PREHEADER, IR::Opcode::GetCbufU32) == 2);
+    REQUIRE(test.Count(PREHEADER, IR::Opcode::ShiftLeftLogical32) == 1);
+    REQUIRE(test.Count(PREHEADER, IR::Opcode::IAdd32) == 1);
+    REQUIRE(test.Count(PREHEADER, IR::Opcode::IMul32) == 1);
+    REQUIRE(test.Count(BODY, IR::Opcode::GetCbufU32) == 0);
+    REQUIRE(test.Count(BODY, IR::Opcode::IMul32) == 0);
+    REQUIRE(test.Count(BODY, IR::Opcode::IAdd32) == 1);
+    REQUIRE(test.Count(CONTINUE, IR::Opcode::ULessThan) == 1);
+}
+
+TEST_CASE("LoopInvariantCodeMotion[Variant]", "[shader]") {
+    LoopProgram test;
+    {
+        // R0 += cbuf[0][R0 * 4] + global[0x1000]
+        IR::IREmitter ir{test.Emitter(BODY)};
+        const IR::U32 counter{ir.GetReg(IR::Reg::R0)};
+        const IR::U32 offset{ir.ShiftLeftLogical(counter, ir.Imm32(2))};
+        const IR::U32 cbuf{ir.GetCbuf(ir.Imm32(0), offset)};
+        const IR::U32 global{ir.LoadGlobal32(ir.Imm64(u64{0x1000}))};
+        ir.SetReg(IR::Reg::R0, ir.IAdd(counter, ir.IAdd(cbuf, global)));
+    }
+    REQUIRE(test.Optimize() == 0);
+
+    REQUIRE(test.Count(BODY, IR::Opcode::ShiftLeftLogical32) == 1);
+    REQUIRE(test.Count(BODY, IR::Opcode::GetCbufU32) == 1);
+    REQUIRE(test.Count(BODY, IR::Opcode::LoadGlobal32) == 1);
+    REQUIRE(test.Count(BODY, IR::Opcode::IAdd32) == 2);
+}
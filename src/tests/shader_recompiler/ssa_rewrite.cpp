@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "shader_recompiler/frontend/ir/basic_block.h"
+#include "shader_recompiler/frontend/ir/ir_emitter.h"
+#include "shader_recompiler/frontend/ir/post_order.h"
+#include "shader_recompiler/frontend/ir/program.h"
+#include "shader_recompiler/ir_opt/passes.h"
+#include "shader_recompiler/object_pool.h"
+
+TEST_CASE("SsaRewrite[GotoVariables]", "[shader]") {
+    using namespace Shader;
+
+    // Chain of blocks where each one reads the goto variable of the previous one and sets its own,
+    // with as many labels as blocks. A table of definitions per label and block would take
+    // NUM_BLOCKS * NUM_BLOCKS values here, a few hundred megabytes.
+    constexpr u32 NUM_BLOCKS = 4096;
+    ObjectPool<IR::Inst> inst_pool;
+    ObjectPool<IR::Block> block_pool;
+    IR::Program program;
+    for (u32 index = 0; index < NUM_BLOCKS; ++index) {
+        IR::Block* const block{block_pool.Create(inst_pool)};
+        block->SetOrder(index);
+        IR::AbstractSyntaxNode node{};
+        node.type = IR::AbstractSyntaxNode::Type::Block;
+        node.data.block = block;
+        program.syntax_list.push_back(node);
+        program.blocks.push_back(block);
+        if (index != 0) {
+            program.blocks[index - 1]->AddBranch(block);
+        }
+        // Label ids are spread like the ones of the structured control flow
+        IR::IREmitter ir{*block};
+        const IR::U1 previous{index == 0 ? ir.Imm1(true) : ir.GetGotoVariable((index - 1) * 3)};
+        ir.SetGotoVariable(index * 3, ir.LogicalNot(previous));
+    }
+    IR::IREmitter ir{*program.blocks.back()};
+    const IR::U1 last{ir.GetGotoVariable((NUM_BLOCKS - 1) * 3)};
+    const IR::F32 value{ir.Select(last, ir.Imm32(1.0f), ir.Imm32(0.0f))};
+    ir.SetAttribute(IR::Attribute::Generic0X, value, ir.Imm32(0));
+    program.syntax_list.emplace_back().type = IR::AbstractSyntaxNode::Type::Return;
+    program.post_order_blocks = IR::PostOrder(program.syntax_list.front());
+    program.stage = Stage::Fragment;
+
+    Optimization::SsaRewritePass(program);
+    Optimization::DeadCodeEliminationPass(program);
+    Optimization::VerificationPass(program);
+
+    const auto count{[&](IR::Opcode opcode) {
+        size_t num_insts{};
+        for (const IR::Block* const block : program.blocks) {
+            num_insts += std::ranges::count(block->Instructions(), opcode, &IR::Inst::GetOpcode);
+        }
+        return num_insts;
+    }};
+    // Every negation feeds the next one up to the attribute store
+    REQUIRE(count(IR::Opcode::GetGotoVariable) == 0);
+    REQUIRE(count(IR::Opcode::LogicalNot) == NUM_BLOCKS);
+}
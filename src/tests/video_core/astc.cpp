@@ -0,0 +1,145 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "common/cityhash.h"
+#include "common/common_types.h"
+#include "common/div_ceil.h"
+#include "video_core/textures/astc.h"
+
+namespace {
+
+// Two void extent blocks followed by random blocks that decode without errors for every
+// footprint. Stored as the little endian halves of each block.
+constexpr std::array<std::array<u64, 2>, 50> BLOCKS{{
+    // Void extent, opaque red and translucent gray
+    {0xFFFFFFFFFFFFFDFC, 0xFFFF00000000FFFF},
+    {0xFFFFFFFFFFFFFDFC, 0x4040808080808080},
+    {0x51607FDF621B79DE, 0x68CCAB0DFF9DB1F9},
+    {0x5599A77FCF78759E, 0xA557CAE86E3EDE8D},
+    {0xFD85700F3CF62043, 0x0E55CA49507AC9DF},
+    {0xFEDBDC828DB2279F, 0xCB0ACF64D7A2CEAB},
+    {0xC589B3A893DB455F, 0xD92F126887ED80D0},
+    {0x71358FA1DD25A411, 0xFAB60668BC6DEF6F},
+    {0xBCB8622661F7D3BF, 0x9DC9C4AE10402A79},
+    {0x86F5E65968159B0E, 0x24BF80D49A05739D},
+    {0xB27045F1E1D88001, 0xF40770FBA2DCB682},
+    {0xF133831C33494B3E, 0xE01B005200C8E3AD},
+    {0x230EF90E25B1D051, 0x458E4C2368DAD208},
+    {0x65B9A8D291C3451D, 0x5040D731A906CA20},
+    {0x259855A5A4B37DFC, 0xBB66568DB122C9B4},
+    {0x94632F0E085F7033, 0xF4B57F2FD1E4627F},
+    {0xBB8CD4589CFCC3DE, 0xDD14AAE0DA7B41F0},
+    {0x95BF35DE891BDBDE, 0xBFB803DB98BD828F},
+    {0x2243A38CE65A2021, 0xFD6FB1CD044181B8},
+    {0x9F3EB88D14523212, 0x89EDA42586C761B4},
+    {0xDA0EAB0FD2E2C3CE, 0xE1D14A059BCC1B3F},
+    {0x11B110AC75FCCE01, 0x9B07146F36DA4C12},
+    {0xFC2BD047AE12218F, 0x2E09ACC5FC3B39E1},
+    {0x7D1322F541C28DFC, 0x8E1A88C1D1CC6048},
+    {0x65E0E678D7D5275F, 0xE1124F2CB8DE34FE},
+    {0xA1032E5B42075A32, 0x5905854F84831E92},
+    {0x6B18363D9562CB9D, 0x9BC77E2024F8A103},
+    {0x807205CF1044810D, 0x6B2C4E6DB92A66D8},
+    {0xCF654AFF612D212D, 0xC2C1BEFFB6FC8E7C},
+    {0x8E5C64B1D5D98FCD, 0xB19FB2DC1A838EEF},
+    {0xFD6DE978249EEBCE, 0x0F8E054453636243},
+    {0xD470FBD97C86C71F, 0x7C3D7486BB66C0FB},
+    {0x503565CB010B038F, 0x493022933FA0BA27},
+    {0x5D579CE317649B9D, 0x9E7F3427975249E7},
+    {0x88F1F2613DE477BD, 0xB4F7317118A4491B},
+    {0xF522460C005CC5AF, 0x122957A359C6A9E5},
+    {0xCEFE886C9DEBA253, 0xA4D8800ED806AA49},
+    {0x8B847897BB2BFDFC, 0x24220F1F509BB143},
+    {0xDA07B58A31413A21, 0xE612113E0E51E3D2},
+    {0x947E80676DCBAB2E, 0x559EDF75DACA944D},
+    {0x17F5E00A3C9E4DFC, 0x71665DEB09B217D6},
+    {0x1304A66209EA232E, 0x99E5317F159A8C58},
+    {0x9D3247DBE737815F, 0xD787550531380856},
+    {0x36E94CD02B612223, 0x2C0147B8F14F3D68},
+    {0xCE1CDDCCDCE1F811, 0x840548C325299755},
+    {0x33B9BA69F27CDB9E, 0xFEFB508E0B526A10},
+    {0x8F07B3EC476A75DF, 0xA79CC97FA2260FA4},
+    {0x86548CD8F2B96C11, 0x69D547CB888363E5},
+    {0xE59FEB3B2C3A9B4D, 0x9030939038C02BE2},
+    {0x2815287FA863753F, 0xD49D37E45A3E0B85},
+}};
+
+struct Footprint {
+    u32 width;
+    u32 height;
+    u64 hash;
+};
+
+// Hashes of the decoded images, generated with the original scalar decoder
+constexpr std::array FOOTPRINTS{
+    Footprint{4, 4, 0xE8A1B6AF82DF9C4F},
+    Footprint{5, 4, 0xA0E9FB8C19A9BDD3},
+    Footprint{5, 5, 0x75D0B5E484EDD27C},
+    Footprint{6, 5, 0xA702B0CCD61655A1},
+    Footprint{6, 6, 0x386EFAD1869FA5EA},
+    Footprint{8, 5, 0x6CBFE7BA3B3D35E2},
+    Footprint{8, 6, 0x00E12D764F848EBC},
+    Footprint{8, 8, 0x7C634DF06352281A},
+    Footprint{10, 5, 0x424CA708777ED8E3},
+    Footprint{10, 6, 0x783604BDBBC15A0F},
+    Footprint{10, 8, 0x78F10B9878186D7A},
+    Footprint{10, 10, 0xB00EE634625B3738},
+    Footprint{12, 10, 0x824B00A5B0653EAD},
+    Footprint{12, 12, 0x39349748E7EC9885},
+};
+
+std::vector<u8> MakeImage(u32 block_width, u32 block_height, u32 width, u32 height, u32 depth) {
+    const size_t num_blocks = Common::DivCeil(width, block_width) *
+                              Common::DivCeil(height, block_height) * depth;
+    std::vector<u8> data(num_blocks * 16);
+    for (size_t block = 0; block < num_blocks; ++block) {
+        std::memcpy(data.data() + block * 16, BLOCKS[block % BLOCKS.size()].data(), 16);
+    }
+    return data;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("ASTC[Decompress]", "[video_core]") {
+    for (const Footprint& footprint : FOOTPRINTS) {
+        // Sizes that are not a multiple of the footprint exercise the partial edge blocks
+        const u32 width = footprint.width * 9 - 3;
+        const u32 height = footprint.height * 7 - 1;
+        const u32 depth = 3;
+        const auto data = MakeImage(footprint.width, footprint.height, width, height, depth);
+        std::vector<u8> output(static_cast<size_t>(width) * height * depth * 4);
+
+        Tegra::Texture::ASTC::Decompress(data, width, height, depth, footprint.width,
+                                         footprint.height, output);
+
+        INFO(fmt::format("{}x{}", footprint.width, footprint.height));
+        REQUIRE(Common::CityHash64(reinterpret_cast<const char*>(output.data()), output.size()) ==
+                footprint.hash);
+    }
+}
+
+TEST_CASE("ASTC[Benchmark]", "[.][benchmark][video_core]") {
+    const u32 width = 1024;
+    const u32 height = 1024;
+    for (const Footprint& footprint : FOOTPRINTS) {
+        const auto data = MakeImage(footprint.width, footprint.height, width, height, 1);
+        std::vector<u8> output(static_cast<size_t>(width) * height * 4);
+
+        // Report the decoded megabytes so the mean time converts directly to MB/s
+        BENCHMARK(fmt::format("{}x{} ({} MB)", footprint.width, footprint.height,
+                              output.size() / (1024 * 1024))) {
+            Tegra::Texture::ASTC::Decompress(data, width, height, 1, footprint.width,
+                                             footprint.height, output);
+            return output[0];
+        };
+    }
+}
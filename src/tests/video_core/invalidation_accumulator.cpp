@@ -0,0 +1,59 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/invalidation_accumulator.h"
+
+namespace {
+using Range = std::pair<GPUVAddr, size_t>;
+
+std::vector<Range> Collect(VideoCommon::InvalidationAccumulator& accumulator) {
+    std::vector<Range> ranges;
+    accumulator.Callback([&ranges](GPUVAddr address, size_t size) {
+        ranges.emplace_back(address, size);
+    });
+    accumulator.Clear();
+    return ranges;
+}
+} // Anonymous namespace
+
+TEST_CASE("MergeRanges", "[video_core]") {
+    std::vector<Range> ranges{
+        {0x3000, 0x100}, {0x1000, 0x100}, {0x1100, 0x80}, {0x1040, 0x10}, {0x2000, 0x1000},
+    };
+    VideoCommon::MergeRanges(ranges);
+    REQUIRE(ranges == std::vector<Range>{{0x1000, 0x180}, {0x2000, 0x1100}});
+}
+
+TEST_CASE("InvalidationAccumulator: Merges interleaved writes", "[video_core]") {
+    VideoCommon::InvalidationAccumulator accumulator;
+    // Two interleaved streams of writes, each one breaking the other's run
+    for (GPUVAddr offset = 0; offset < 0x400; offset += 0x20) {
+        accumulator.Add(0x10000 + offset, 0x20);
+        accumulator.Add(0x20000 + offset, 0x20);
+    }
+    // Rewrites of already collected memory
+    accumulator.Add(0x10100, 0x8);
+    accumulator.Add(0x20200, 0x40);
+
+    REQUIRE(Collect(accumulator) == std::vector<Range>{{0x10000, 0x400}, {0x20000, 0x400}});
+    REQUIRE(accumulator.NumAdded() == 66);
+    REQUIRE(accumulator.NumDispatched() == 2);
+    REQUIRE(Collect(accumulator).empty());
+}
+
+TEST_CASE("InvalidationAccumulator: Keeps disjoint writes apart", "[video_core]") {
+    VideoCommon::InvalidationAccumulator accumulator;
+    accumulator.Add(0x5000, 0x10);
+    accumulator.Add(0x1000, 0x10);
+    accumulator.Add(0x1045, 0x4);
+    accumulator.Add(0x503F, 0x1);
+    // Writes are widened to 32 byte granularity
+    REQUIRE(Collect(accumulator) ==
+            std::vector<Range>{{0x1000, 0x20}, {0x1040, 0x20}, {0x5000, 0x40}});
+}
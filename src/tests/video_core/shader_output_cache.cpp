@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/shader_output_cache.h"
+
+namespace {
+using VideoCommon::ShaderOutput;
+using VideoCommon::ShaderOutputCache;
+
+std::vector<ShaderOutput> MakeOutputs() {
+    std::vector<ShaderOutput> outputs(2);
+    outputs[0].stage_index = 0;
+    outputs[0].info.uses_fp16 = true;
+    outputs[0].info.constant_buffer_mask = 0b101;
+    outputs[0].info.stores.Set(Shader::IR::Attribute::PositionX);
+    outputs[0].info.legacy_stores_mapping.emplace(Shader::IR::Attribute::ColorFrontDiffuseR,
+                                                  Shader::IR::Attribute::Generic3X);
+    outputs[0].info.constant_buffer_descriptors.push_back({.index = 1, .count = 1});
+    outputs[0].SetCode(std::array<u32, 3>{0x07230203, 1, 2});
+    outputs[1].stage_index = 4;
+    outputs[1].info.texture_descriptors.push_back({.type = Shader::TextureType::Color2D,
+                                                   .cbuf_index = 2,
+                                                   .cbuf_offset = 0x30,
+                                                   .count = 1});
+    outputs[1].SetCode(std::array<u32, 2>{0x07230203, 3});
+    return outputs;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("ShaderOutputCache[RoundTrip]", "[video_core]") {
+    const auto path = std::filesystem::temp_directory_path() / "citron_shader_output_cache.bin";
+    std::filesystem::remove(path);
+    const std::array<char, 4> key{'k', 'e', 'y', '0'};
+    const std::array<char, 4> other_key{'k', 'e', 'y', '1'};
+    const std::vector<ShaderOutput> outputs = MakeOutputs();
+    std::vector<ShaderOutput> found;
+
+    {
+        ShaderOutputCache cache(path, 1);
+        REQUIRE(!cache.Find(key, found));
+        cache.Insert(key, outputs, std::chrono::milliseconds{5});
+        cache.FinishLoading();
+    }
+    {
+        ShaderOutputCache cache(path, 1);
+        REQUIRE(!cache.Find(other_key, found));
+        REQUIRE(cache.Find(key, found));
+        REQUIRE(found.size() == outputs.size());
+        REQUIRE(found[0].code == outputs[0].code);
+        REQUIRE(found[0].CodeWords() == outputs[0].CodeWords());
+        REQUIRE(found[0].info.uses_fp16);
+        REQUIRE(found[0].info.constant_buffer_mask == 0b101);
+        REQUIRE(found[0].info.stores.mask == outputs[0].info.stores.mask);
+        REQUIRE(found[0].info.legacy_stores_mapping == outputs[0].info.legacy_stores_mapping);
+        REQUIRE(found[0].info.constant_buffer_descriptors ==
+                outputs[0].info.constant_buffer_descriptors);
+        REQUIRE(found[1].stage_index == 4);
+        REQUIRE(found[1].info.texture_descriptors == outputs[1].info.texture_descriptors);
+        REQUIRE(found[1].CodeWords() == outputs[1].CodeWords());
+
+        // Entries become unreachable once loading finished
+        cache.FinishLoading();
+        REQUIRE(!cache.Find(key, found));
+    }
+    {
+        // Another salt discards the file
+        ShaderOutputCache cache(path, 2);
+        REQUIRE(!cache.Find(key, found));
+    }
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,168 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "common/common_types.h"
+#include "common/div_ceil.h"
+#include "video_core/textures/decoders.h"
+
+namespace {
+using namespace Tegra::Texture;
+
+constexpr std::array<u32, 8> BYTES_PER_PIXEL_CASES{1, 2, 3, 4, 6, 8, 12, 16};
+constexpr u32 MAX_BLOCK_HEIGHT = 5;
+
+/// Byte by byte reference implementation driven by the TRM swizzle table.
+void ReferenceUnswizzle(std::span<u8> output, std::span<const u8> input, u32 bytes_per_pixel,
+                        u32 width, u32 height, u32 depth, u32 block_height, u32 block_depth) {
+    static constexpr SwizzleTable table = MakeSwizzleTable();
+    const u32 pitch = width * bytes_per_pixel;
+    const u32 gobs_in_x = Common::DivCeil(pitch, GOB_SIZE_X);
+    const u32 block_size = gobs_in_x << (GOB_SIZE_SHIFT + block_height + block_depth);
+    const u32 slice_size = Common::DivCeil(height, GOB_SIZE_Y << block_height) * block_size;
+    const u32 block_height_mask = (1U << block_height) - 1;
+    const u32 block_depth_mask = (1U << block_depth) - 1;
+
+    for (u32 z = 0; z < depth; ++z) {
+        const u32 offset_z = (z >> block_depth) * slice_size +
+                             ((z & block_depth_mask) << (GOB_SIZE_SHIFT + block_height));
+        for (u32 y = 0; y < height; ++y) {
+            const u32 gob_y = y / GOB_SIZE_Y;
+            const u32 offset_y = (gob_y >> block_height) * block_size +
+                                 ((gob_y & block_height_mask) << GOB_SIZE_SHIFT);
+            for (u32 x = 0; x < pitch; ++x) {
+                const u32 offset_x = (x / GOB_SIZE_X)
+                                     << (GOB_SIZE_SHIFT + block_height + block_depth);
+                const u32 swizzled_offset =
+                    offset_z + offset_y + offset_x + table[y % GOB_SIZE_Y][x % GOB_SIZE_X];
+                output[(z * height + y) * pitch + x] = input[swizzled_offset];
+            }
+        }
+    }
+}
+
+std::vector<u8> RandomBytes(size_t size) {
+    std::mt19937 rng(size);
+    std::vector<u8> data(size);
+    for (u8& value : data) {
+        value = static_cast<u8>(rng());
+    }
+    return data;
+}
+
+} // Anonymous namespace
+
+TEST_CASE("Swizzle[UnswizzleMatchesReference]", "[video_core]") {
+    // Odd widths exercise the unaligned tail, wide ones exercise the whole GOB line path.
+    static constexpr std::array<u32, 3> widths{7, 64, 203};
+    for (const u32 bytes_per_pixel : BYTES_PER_PIXEL_CASES) {
+        for (u32 block_height = 0; block_height <= MAX_BLOCK_HEIGHT; ++block_height) {
+            for (const u32 width : widths) {
+                const u32 height = 37;
+                const u32 depth = 2;
+                const u32 block_depth = 1;
+                const auto swizzled = RandomBytes(
+                    CalculateSize(true, bytes_per_pixel, width, height, depth, block_height,
+                                  block_depth));
+                const size_t linear_size =
+                    CalculateSize(false, bytes_per_pixel, width, height, depth, 0, 0);
+                std::vector<u8> expected(linear_size);
+                std::vector<u8> result(linear_size);
+
+                ReferenceUnswizzle(expected, swizzled, bytes_per_pixel, width, height, depth,
+                                   block_height, block_depth);
+                UnswizzleTexture(result, swizzled, bytes_per_pixel, width, height, depth,
+                                 block_height, block_depth);
+                REQUIRE(result == expected);
+
+                std::vector<u8> reswizzled(swizzled.size());
+                SwizzleTexture(reswizzled, result, bytes_per_pixel, width, height, depth,
+                               block_height, block_depth);
+                std::vector<u8> roundtrip(linear_size);
+                UnswizzleTexture(roundtrip, reswizzled, bytes_per_pixel, width, height, depth,
+                                 block_height, block_depth);
+                REQUIRE(roundtrip == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("Swizzle[SubrectMatchesFullTexture]", "[video_core]") {
+    for (const u32 bytes_per_pixel : {1U, 2U, 4U, 8U, 16U}) {
+        for (u32 block_height = 0; block_height <= MAX_BLOCK_HEIGHT; ++block_height) {
+            const u32 width = 300 / bytes_per_pixel;
+            const u32 height = 40;
+            const u32 pitch = width * bytes_per_pixel;
+            const auto swizzled = RandomBytes(
+                CalculateSize(true, bytes_per_pixel, width, height, 1, block_height, 0));
+            std::vector<u8> full(static_cast<size_t>(pitch) * height);
+            UnswizzleTexture(full, swizzled, bytes_per_pixel, width, height, 1, block_height, 0);
+
+            // Start off a GOB boundary so the head, body and tail of each line are all used.
+            const u32 origin_x = 3;
+            const u32 origin_y = 5;
+            const u32 extent_x = width - 5;
+            const u32 extent_y = height - origin_y;
+            const u32 sub_pitch = extent_x * bytes_per_pixel;
+            std::vector<u8> sub(static_cast<size_t>(sub_pitch) * extent_y);
+            UnswizzleSubrect(sub, swizzled, bytes_per_pixel, width, height, 1, origin_x, origin_y,
+                             extent_x, extent_y, block_height, 0, sub_pitch);
+            for (u32 y = 0; y < extent_y; ++y) {
+                const u8* const expected =
+                    full.data() + (origin_y + y) * pitch + origin_x * bytes_per_pixel;
+                REQUIRE(std::memcmp(sub.data() + y * sub_pitch, expected, sub_pitch) == 0);
+            }
+
+            std::vector<u8> reswizzled = swizzled;
+            std::ranges::fill(sub, u8{0});
+            SwizzleSubrect(reswizzled, sub, bytes_per_pixel, width, height, 1, origin_x, origin_y,
+                           extent_x, extent_y, block_height, 0, sub_pitch);
+            UnswizzleTexture(full, reswizzled, bytes_per_pixel, width, height, 1, block_height, 0);
+            for (u32 y = 0; y < extent_y; ++y) {
+                const u8* const line =
+                    full.data() + (origin_y + y) * pitch + origin_x * bytes_per_pixel;
+                REQUIRE(std::all_of(line, line + sub_pitch, [](u8 value) { return value == 0; }));
+            }
+        }
+    }
+}
+
+TEST_CASE("Swizzle[Benchmark]", "[.][benchmark][video_core]") {
+    const u32 width = 1024;
+    const u32 height = 1024;
+    for (const u32 bytes_per_pixel : BYTES_PER_PIXEL_CASES) {
+        for (u32 block_height = 0; block_height <= MAX_BLOCK_HEIGHT; ++block_height) {
+            const auto swizzled = RandomBytes(
+                CalculateSize(true, bytes_per_pixel, width, height, 1, block_height, 0));
+            std::vector<u8> linear(CalculateSize(false, bytes_per_pixel, width, height, 1, 0, 0));
+            std::vector<u8> output(swizzled.size());
+            const std::string name =
+                fmt::format("bpp={} block_height={}", bytes_per_pixel, block_height);
+
+            BENCHMARK("reference " + name) {
+                ReferenceUnswizzle(linear, swizzled, bytes_per_pixel, width, height, 1,
+                                   block_height, 0);
+                return linear[0];
+            };
+            BENCHMARK("unswizzle " + name) {
+                UnswizzleTexture(linear, swizzled, bytes_per_pixel, width, height, 1, block_height,
+                                 0);
+                return linear[0];
+            };
+            BENCHMARK("swizzle " + name) {
+                SwizzleTexture(output, linear, bytes_per_pixel, width, height, 1, block_height, 0);
+                return output[0];
+            };
+        }
+    }
+}
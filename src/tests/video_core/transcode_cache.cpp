@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <filesystem>
+#include <random>
+#include <vector>
+
+#include <boost/container/small_vector.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "common/common_types.h"
+#include "video_core/texture_cache/transcode_cache.h"
+
+namespace {
+using VideoCommon::BufferImageCopy;
+using VideoCommon::TranscodeCache;
+using Copies = boost::container::small_vector<BufferImageCopy, 16>;
+
+constexpr size_t DATA_SIZE = 0x4000;
+/// Room for two entries of incompressible data but not three
+constexpr u64 SIZE_LIMIT = DATA_SIZE * 5 / 2;
+
+std::filesystem::path MakeDirectory(const char* name) {
+    const auto directory = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(directory);
+    return directory;
+}
+
+std::vector<u8> MakeData(u32 seed) {
+    std::mt19937 rng{seed};
+    std::vector<u8> data(DATA_SIZE);
+    for (u8& value : data) {
+        value = static_cast<u8>(rng());
+    }
+    return data;
+}
+
+std::array<BufferImageCopy, 2> MakeCopies() {
+    return {
+        BufferImageCopy{
+            .buffer_offset = 0,
+            .buffer_size = DATA_SIZE / 2,
+            .image_extent = {.width = 32, .height = 32, .depth = 1},
+        },
+        BufferImageCopy{
+            .buffer_offset = DATA_SIZE / 2,
+            .buffer_size = DATA_SIZE / 2,
+            .image_subresource = {.base_level = 1, .base_layer = 0, .num_layers = 1},
+            .image_extent = {.width = 16, .height = 16, .depth = 1},
+        },
+    };
+}
+
+bool Load(TranscodeCache& cache, u64 key, std::vector<u8>& output, Copies& copies) {
+    output.assign(DATA_SIZE, 0);
+    copies.clear();
+    return cache.Load(key, output, copies);
+}
+
+} // Anonymous namespace
+
+TEST_CASE("TranscodeCache[HitAndMiss]", "[video_core]") {
+    const auto directory = MakeDirectory("citron_transcode_cache_hit");
+    const std::vector<u8> data = MakeData(1);
+    const auto copies = MakeCopies();
+    std::vector<u8> output;
+    Copies found_copies;
+
+    {
+        TranscodeCache cache(directory, SIZE_LIMIT);
+        REQUIRE(!Load(cache, 1, output, found_copies));
+        cache.Store(1, data, copies);
+    }
+    {
+        TranscodeCache cache(directory, SIZE_LIMIT);
+        REQUIRE(!Load(cache, 2, output, found_copies));
+        REQUIRE(Load(cache, 1, output, found_copies));
+        REQUIRE(output == data);
+        REQUIRE(found_copies.size() == copies.size());
+        REQUIRE(found_copies[1].buffer_offset == copies[1].buffer_offset);
+        REQUIRE(found_copies[1].image_subresource.base_level == 1);
+        REQUIRE(found_copies[1].image_extent.width == 16);
+
+        // Entries that do not fit the destination are misses
+        std::vector<u8> small_output(DATA_SIZE / 2);
+        REQUIRE(!cache.Load(1, small_output, found_copies));
+    }
+    {
+        // Corrupted entries are misses
+        std::filesystem::resize_file(directory / "0000000000000001.bin", 0x20);
+        TranscodeCache cache(directory, SIZE_LIMIT);
+        REQUIRE(!Load(cache, 1, output, found_copies));
+    }
+    std::filesystem::remove_all(directory);
+}
+
+TEST_CASE("TranscodeCache[Eviction]", "[video_core]") {
+    const auto directory = MakeDirectory("citron_transcode_cache_eviction");
+    const auto copies = MakeCopies();
+    std::vector<u8> output;
+    Copies found_copies;
+
+    {
+        TranscodeCache cache(directory, SIZE_LIMIT);
+        cache.Store(1, MakeData(1), copies);
+        cache.Store(2, MakeData(2), copies);
+    }
+    {
+        // Using the first entry makes the second one the least recently used
+        TranscodeCache cache(directory, SIZE_LIMIT);
+        REQUIRE(Load(cache, 1, output, found_copies));
+        cache.Store(3, MakeData(3), copies);
+    }
+    REQUIRE(!std::filesystem::exists(directory / "0000000000000002.bin"));
+    {
+        TranscodeCache cache(directory, SIZE_LIMIT);
+        REQUIRE(Load(cache, 1, output, found_copies));
+        REQUIRE(output == MakeData(1));
+        REQUIRE(!Load(cache, 2, output, found_copies));
+        REQUIRE(Load(cache, 3, output, found_copies));
+        REQUIRE(output == MakeData(3));
+    }
+    {
+        // Lowering the limit evicts down to the most recently used entry
+        TranscodeCache cache(directory, SIZE_LIMIT / 2);
+        REQUIRE(!Load(cache, 1, output, found_copies));
+        REQUIRE(Load(cache, 3, output, found_copies));
+    }
+    std::filesystem::remove_all(directory);
+}
@@ -51,12 +51,12 @@ static void RunThread(std::stop_token stop_token, Core::System& system,
         } else {
             ASSERT(false);
         }
-        state.signaled_fence.store(next.fence);
+        state.signaled_fence.store(next.fence, std::memory_order_release);
         if (next.block) {
-            // We have to lock the write_lock to ensure that the condition_variable wait not get a
+            // We have to lock the fence_lock to ensure that the condition_variable wait not get a
             // race between the check and the lock itself.
-            std::scoped_lock lk{state.write_lock};
-            state.cv.notify_all();
+            std::scoped_lock lk{state.fence_lock};
+            state.fence_cv.notify_all();
         }
     }
 }
@@ -112,13 +112,18 @@ u64 ThreadManager::PushCommand(CommandData&& command_data, bool block) {
         block = true;
     }
 
-    std::unique_lock lk(state.write_lock);
-    const u64 fence{++state.last_fence};
-    state.queue.EmplaceWait(std::move(command_data), fence, block);
+    u64 fence;
+    {
+        std::scoped_lock lk{state.write_lock};
+        fence = ++state.last_fence;
+        state.queue.EmplaceWait(std::move(command_data), fence, block);
+    }
 
     if (block) {
-        Common::CondvarWait(state.cv, lk, thread.get_stop_token(), [this, fence] {
-            return fence <= state.signaled_fence.load(std::memory_order_relaxed);
+        // Wait on a separate lock so other producers can keep pushing in the meantime
+        std::unique_lock lk{state.fence_lock};
+        Common::CondvarWait(state.fence_cv, lk, thread.get_stop_token(), [this, fence] {
+            return fence <= state.signaled_fence.load(std::memory_order_acquire);
         });
     }
 
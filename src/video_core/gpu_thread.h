@@ -89,12 +89,14 @@ struct CommandDataContainer {
 
 /// Struct used to synchronize the GPU thread
 struct SynchState final {
-    using CommandQueue = Common::MPSCQueue<CommandDataContainer>;
+    /// Producers are serialized by write_lock, so the queue only ever sees a single producer
+    using CommandQueue = Common::SPSCQueue<CommandDataContainer>;
     std::mutex write_lock;
     CommandQueue queue;
     u64 last_fence{};
     std::atomic<u64> signaled_fence{};
-    std::condition_variable_any cv;
+    std::mutex fence_lock;
+    std::condition_variable_any fence_cv;
 };
 
 /// Class used to manage the GPU thread
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <utility>
 #include <vector>
 
@@ -10,12 +11,41 @@
 
 namespace VideoCommon {
 
+/**
+ * Sorts a container of (address, size) pairs and merges overlapping and adjacent ranges in place.
+ * Invalidating the merged ranges is equivalent to invalidating each of the original ones.
+ */
+template <typename Container>
+void MergeRanges(Container& ranges) {
+    if (ranges.size() < 2) {
+        return;
+    }
+    std::ranges::sort(ranges, {}, [](const auto& range) { return range.first; });
+    auto merged = ranges.begin();
+    for (auto it = std::next(ranges.begin()); it != ranges.end(); ++it) {
+        const auto merged_end = merged->first + merged->second;
+        if (it->first <= merged_end) {
+            const auto end = std::max(merged_end, it->first + it->second);
+            merged->second = end - merged->first;
+        } else {
+            *++merged = *it;
+        }
+    }
+    ranges.erase(std::next(merged), ranges.end());
+}
+
+/**
+ * Collects the ranges written between two flushes so they can be invalidated at once.
+ * Consecutive writes are merged as they are added, the remaining overlapping and adjacent ranges
+ * are merged when the ranges are dispatched.
+ */
 class InvalidationAccumulator {
 public:
     InvalidationAccumulator() = default;
     ~InvalidationAccumulator() = default;
 
     void Add(GPUVAddr address, size_t size) {
+        ++num_added;
         const auto reset_values = [&]() {
             if (has_collected) {
                 buffer.emplace_back(start_address, accumulated_size);
@@ -27,8 +57,9 @@ public:
         if (address >= start_address && address + size <= last_collection) [[likely]] {
             return;
         }
-        size = ((address + size + atomicity_size_mask) & atomicity_mask) - address;
-        address = address & atomicity_mask;
+        const GPUVAddr aligned_address = address & atomicity_mask;
+        size = ((address + size + atomicity_size_mask) & atomicity_mask) - aligned_address;
+        address = aligned_address;
         if (!has_collected) [[unlikely]] {
             reset_values();
             has_collected = true;
@@ -59,11 +90,23 @@ public:
             return;
         }
         buffer.emplace_back(start_address, accumulated_size);
+        MergeRanges(buffer);
+        num_dispatched += buffer.size();
         for (auto& [address, size] : buffer) {
             func(address, size);
         }
     }
 
+    /// Returns the number of ranges added since the accumulator was created.
+    u64 NumAdded() const {
+        return num_added;
+    }
+
+    /// Returns the number of merged ranges dispatched since the accumulator was created.
+    u64 NumDispatched() const {
+        return num_dispatched;
+    }
+
 private:
     static constexpr size_t atomicity_bits = 5;
     static constexpr size_t atomicity_size = 1ULL << atomicity_bits;
@@ -73,7 +116,9 @@ private:
     GPUVAddr last_collection{};
     size_t accumulated_size{};
     bool has_collected{};
-    std::vector<std::pair<VAddr, size_t>> buffer;
+    u64 num_added{};
+    u64 num_dispatched{};
+    std::vector<std::pair<GPUVAddr, size_t>> buffer;
 };
 
 } // namespace VideoCommon
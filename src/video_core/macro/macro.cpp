@@ -68,7 +68,7 @@ void MacroEngine::ClearCode(u32 method) {
     uploaded_macro_code.erase(method);
 }
 
-void MacroEngine::Execute(u32 method, const std::vector<u32>& parameters) {
+void MacroEngine::Execute(u32 method, std::span<const u32> parameters) {
     auto compiled_macro = macro_cache.find(method);
     if (compiled_macro != macro_cache.end()) {
         const auto& cache_info = compiled_macro->second;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <vector>
 #include "common/bit_field.h"
@@ -106,7 +107,7 @@ public:
      * @param parameters The parameters of the macro
      * @param method     The method to execute
      */
-    virtual void Execute(const std::vector<u32>& parameters, u32 method) = 0;
+    virtual void Execute(std::span<const u32> parameters, u32 method) = 0;
 };
 
 class MacroEngine {
@@ -121,7 +122,7 @@ public:
     void ClearCode(u32 method);
 
     // Compiles the macro if its not in the cache, and executes the compiled macro
-    void Execute(u32 method, const std::vector<u32>& parameters);
+    void Execute(u32 method, std::span<const u32> parameters);
 
 protected:
     virtual std::unique_ptr<CachedMacro> Compile(const std::vector<u32>& code) = 0;
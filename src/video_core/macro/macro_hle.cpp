@@ -59,7 +59,7 @@ class HLE_DrawArraysIndirect final : public HLEMacroImpl {
 public:
     explicit HLE_DrawArraysIndirect(Maxwell3D& maxwell3d_) : HLEMacroImpl(maxwell3d_) {}
 
-    void Execute(const std::vector<u32>& parameters, [[maybe_unused]] u32 method) override {
+    void Execute(std::span<const u32> parameters, [[maybe_unused]] u32 method) override {
         auto topology = static_cast<Maxwell3D::Regs::PrimitiveTopology>(parameters[0]);
         if (!maxwell3d.AnyParametersDirty() || !IsTopologySafe(topology)) {
             Fallback(parameters);
@@ -91,7 +91,7 @@ public:
     }
 
 private:
-    void Fallback(const std::vector<u32>& parameters) {
+    void Fallback(std::span<const u32> parameters) {
         SCOPE_EXIT {
             if (extended) {
                 maxwell3d.engine_state = Maxwell3D::EngineHint::None;
@@ -140,7 +140,7 @@ class HLE_DrawIndexedIndirect final : public HLEMacroImpl {
 public:
     explicit HLE_DrawIndexedIndirect(Maxwell3D& maxwell3d_) : HLEMacroImpl(maxwell3d_) {}
 
-    void Execute(const std::vector<u32>& parameters, [[maybe_unused]] u32 method) override {
+    void Execute(std::span<const u32> parameters, [[maybe_unused]] u32 method) override {
         auto topology = static_cast<Maxwell3D::Regs::PrimitiveTopology>(parameters[0]);
         if (!maxwell3d.AnyParametersDirty() || !IsTopologySafe(topology)) {
             Fallback(parameters);
@@ -182,7 +182,7 @@ public:
     }
 
 private:
-    void Fallback(const std::vector<u32>& parameters) {
+    void Fallback(std::span<const u32> parameters) {
         maxwell3d.RefreshParameters();
         const u32 instance_count = (maxwell3d.GetRegisterValue(0xD1B) & parameters[2]);
         const u32 element_base = parameters[4];
@@ -217,7 +217,7 @@ class HLE_MultiLayerClear final : public HLEMacroImpl {
 public:
     explicit HLE_MultiLayerClear(Maxwell3D& maxwell3d_) : HLEMacroImpl(maxwell3d_) {}
 
-    void Execute(const std::vector<u32>& parameters, [[maybe_unused]] u32 method) override {
+    void Execute(std::span<const u32> parameters, [[maybe_unused]] u32 method) override {
         maxwell3d.RefreshParameters();
         ASSERT(parameters.size() == 1);
 
@@ -235,7 +235,7 @@ class HLE_MultiDrawIndexedIndirectCount final : public HLEMacroImpl {
 public:
     explicit HLE_MultiDrawIndexedIndirectCount(Maxwell3D& maxwell3d_) : HLEMacroImpl(maxwell3d_) {}
 
-    void Execute(const std::vector<u32>& parameters, [[maybe_unused]] u32 method) override {
+    void Execute(std::span<const u32> parameters, [[maybe_unused]] u32 method) override {
         const auto topology = static_cast<Maxwell3D::Regs::PrimitiveTopology>(parameters[2]);
         if (!IsTopologySafe(topology)) {
             Fallback(parameters);
@@ -280,7 +280,7 @@ public:
     }
 
 private:
-    void Fallback(const std::vector<u32>& parameters) {
+    void Fallback(std::span<const u32> parameters) {
         SCOPE_EXIT {
             // Clean everything.
             maxwell3d.regs.vertex_id_base = 0x0;
@@ -326,7 +326,7 @@ class HLE_DrawIndirectByteCount final : public HLEMacroImpl {
 public:
     explicit HLE_DrawIndirectByteCount(Maxwell3D& maxwell3d_) : HLEMacroImpl(maxwell3d_) {}
 
-    void Execute(const std::vector<u32>& parameters, [[maybe_unused]] u32 method) override {
+    void Execute(std::span<const u32> parameters, [[maybe_unused]] u32 method) override {
         const bool force = maxwell3d.Rasterizer().HasDrawTransformFeedback();
 
         auto topology = static_cast<Maxwell3D::Regs::PrimitiveTopology>(parameters[0] & 0xFFFFU);
@@ -351,7 +351,7 @@ public:
     }
 
 private:
-    void Fallback(const std::vector<u32>& parameters) {
+    void Fallback(std::span<const u32> parameters) {
         maxwell3d.RefreshParameters();
 
         maxwell3d.regs.draw.begin = parameters[0];
@@ -368,7 +368,7 @@ class HLE_C713C83D8F63CCF3 final : public HLEMacroImpl {
 public:
     explicit HLE_C713C83D8F63CCF3(Maxwell3D& maxwell3d_) : HLEMacroImpl(maxwell3d_) {}
 
-    void Execute(const std::vector<u32>& parameters, [[maybe_unused]] u32 method) override {
+    void Execute(std::span<const u32> parameters, [[maybe_unused]] u32 method) override {
         maxwell3d.RefreshParameters();
         const u32 offset = (parameters[0] & 0x3FFFFFFF) << 2;
         const u32 address = maxwell3d.regs.shadow_scratch[24];
@@ -384,7 +384,7 @@ class HLE_D7333D26E0A93EDE final : public HLEMacroImpl {
 public:
     explicit HLE_D7333D26E0A93EDE(Maxwell3D& maxwell3d_) : HLEMacroImpl(maxwell3d_) {}
 
-    void Execute(const std::vector<u32>& parameters, [[maybe_unused]] u32 method) override {
+    void Execute(std::span<const u32> parameters, [[maybe_unused]] u32 method) override {
         maxwell3d.RefreshParameters();
         const size_t index = parameters[0];
         const u32 address = maxwell3d.regs.shadow_scratch[42 + index];
@@ -400,7 +400,7 @@ class HLE_BindShader final : public HLEMacroImpl {
 public:
     explicit HLE_BindShader(Maxwell3D& maxwell3d_) : HLEMacroImpl(maxwell3d_) {}
 
-    void Execute(const std::vector<u32>& parameters, [[maybe_unused]] u32 method) override {
+    void Execute(std::span<const u32> parameters, [[maybe_unused]] u32 method) override {
         maxwell3d.RefreshParameters();
         auto& regs = maxwell3d.regs;
         const u32 index = parameters[0];
@@ -430,7 +430,7 @@ class HLE_SetRasterBoundingBox final : public HLEMacroImpl {
 public:
     explicit HLE_SetRasterBoundingBox(Maxwell3D& maxwell3d_) : HLEMacroImpl(maxwell3d_) {}
 
-    void Execute(const std::vector<u32>& parameters, [[maybe_unused]] u32 method) override {
+    void Execute(std::span<const u32> parameters, [[maybe_unused]] u32 method) override {
         maxwell3d.RefreshParameters();
         const u32 raster_mode = parameters[0];
         auto& regs = maxwell3d.regs;
@@ -446,7 +446,7 @@ class HLE_ClearConstBuffer final : public HLEMacroImpl {
 public:
     explicit HLE_ClearConstBuffer(Maxwell3D& maxwell3d_) : HLEMacroImpl(maxwell3d_) {}
 
-    void Execute(const std::vector<u32>& parameters, [[maybe_unused]] u32 method) override {
+    void Execute(std::span<const u32> parameters, [[maybe_unused]] u32 method) override {
         maxwell3d.RefreshParameters();
         static constexpr std::array<u32, base_size> zeroes{};
         auto& regs = maxwell3d.regs;
@@ -462,7 +462,7 @@ class HLE_ClearMemory final : public HLEMacroImpl {
 public:
     explicit HLE_ClearMemory(Maxwell3D& maxwell3d_) : HLEMacroImpl(maxwell3d_) {}
 
-    void Execute(const std::vector<u32>& parameters, [[maybe_unused]] u32 method) override {
+    void Execute(std::span<const u32> parameters, [[maybe_unused]] u32 method) override {
         maxwell3d.RefreshParameters();
 
         const u32 needed_memory = parameters[2] / sizeof(u32);
@@ -487,7 +487,7 @@ class HLE_TransformFeedbackSetup final : public HLEMacroImpl {
 public:
     explicit HLE_TransformFeedbackSetup(Maxwell3D& maxwell3d_) : HLEMacroImpl(maxwell3d_) {}
 
-    void Execute(const std::vector<u32>& parameters, [[maybe_unused]] u32 method) override {
+    void Execute(std::span<const u32> parameters, [[maybe_unused]] u32 method) override {
         maxwell3d.RefreshParameters();
 
         auto& regs = maxwell3d.regs;
@@ -2,7 +2,11 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <array>
-#include <optional>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <span>
+#include <vector>
 
 #include "common/assert.h"
 #include "common/logging/log.h"
@@ -14,63 +18,131 @@ MICROPROFILE_DEFINE(MacroInterp, "GPU", "Execute macro interpreter", MP_RGB(128,
 
 namespace Tegra {
 namespace {
+class MacroInterpreterImpl;
+
+/// Program counter returned by handlers to stop the execution.
+constexpr u32 EXIT_PC = std::numeric_limits<u32>::max();
+
+struct Instruction;
+
+/**
+ * Executes a pre-decoded instruction located at pc. Returns the program counter of the next
+ * instruction to execute, or EXIT_PC when the macro is done.
+ */
+using Handler = u32 (*)(MacroInterpreterImpl& self, const Instruction& inst, u32 pc);
+
+/// Macro instruction decoded once when the macro is compiled.
+struct Instruction {
+    /// Executes the instruction, its exit and branch behaviour, and possibly the next instruction.
+    Handler handler;
+    /// Executes the instruction on its own, as done in the delay slot of a branch or exit.
+    Handler delay_slot_handler;
+
+    u32 raw;
+    u32 dst;
+    u32 src_a;
+    u32 src_b;
+    s32 immediate;
+    u32 bf_src_bit;
+    u32 bf_dst_bit;
+    u32 bitfield_mask;
+    /// Index of the instruction a taken branch jumps to.
+    u32 branch_target;
+};
+
 class MacroInterpreterImpl final : public CachedMacro {
 public:
-    explicit MacroInterpreterImpl(Engines::Maxwell3D& maxwell3d_, const std::vector<u32>& code_)
-        : maxwell3d{maxwell3d_}, code{code_} {}
+    explicit MacroInterpreterImpl(Engines::Maxwell3D& maxwell3d_, const std::vector<u32>& code)
+        : maxwell3d{maxwell3d_} {
+        Decode(code);
+    }
 
-    void Execute(const std::vector<u32>& params, u32 method) override;
+    void Execute(std::span<const u32> params, u32 method) override;
 
 private:
-    /// Resets the execution engine state, zeroing registers, etc.
-    void Reset();
+    /// Builds the pre-decoded program, fusing instruction pairs where possible.
+    void Decode(std::span<const u32> code);
 
-    /**
-     * Executes a single macro instruction located at the current program counter. Returns whether
-     * the interpreter should keep running.
-     *
-     * @param is_delay_slot Whether the current step is being executed due to a delay slot in a
-     *                      previous instruction.
-     */
-    bool Step(bool is_delay_slot);
+    /// Executes the instruction at pc as the delay slot of the previous one.
+    void ExecuteDelaySlot(u32 pc) {
+        const Instruction& inst = program[pc];
+        inst.delay_slot_handler(*this, inst, pc);
+    }
 
-    /// Calculates the result of an ALU operation. src_a OP src_b;
-    u32 GetALUResult(Macro::ALUOperation operation, u32 src_a, u32 src_b);
+    template <Macro::Operation operation, Macro::ALUOperation alu_operation>
+    u32 Compute(const Instruction& inst);
 
-    /// Performs the result operation on the input result and stores it in the specified register
-    /// (if necessary).
-    void ProcessResult(Macro::ResultOperation operation, u32 reg, u32 result);
+    template <Macro::ResultOperation result_operation>
+    void ProcessResult(u32 reg, u32 result);
 
-    /// Evaluates the branch condition and returns whether the branch should be taken or not.
-    bool EvaluateBranchCondition(Macro::BranchCondition cond, u32 value) const;
+    template <Macro::Operation operation, Macro::ALUOperation alu_operation,
+              Macro::ResultOperation result_operation>
+    static u32 Run(MacroInterpreterImpl& self, const Instruction& inst, u32 pc);
 
-    /// Reads an opcode at the current program counter location.
-    Macro::Opcode GetOpcode() const;
+    template <Macro::Operation operation, Macro::ALUOperation alu_operation,
+              Macro::ResultOperation result_operation>
+    static u32 RunAfterSetMethod(MacroInterpreterImpl& self, const Instruction& inst, u32 pc);
 
-    /// Returns the specified register's value. Register 0 is hardcoded to always return 0.
-    u32 GetRegister(u32 register_id) const;
+    template <Macro::BranchCondition condition, bool annul, bool is_exit>
+    static u32 Branch(MacroInterpreterImpl& self, const Instruction& inst, u32 pc);
 
-    /// Sets the register to the input value.
-    void SetRegister(u32 register_id, u32 value);
+    static u32 Exit(MacroInterpreterImpl& self, const Instruction& inst, u32 pc);
+    static u32 BranchInDelaySlot(MacroInterpreterImpl& self, const Instruction& inst, u32 pc);
+    static u32 Unimplemented(MacroInterpreterImpl& self, const Instruction& inst, u32 pc);
+    static u32 OutOfBounds(MacroInterpreterImpl& self, const Instruction& inst, u32 pc);
 
-    /// Sets the method address to use for the next Send instruction.
-    void SetMethodAddress(u32 address);
+    template <Macro::Operation operation, Macro::ALUOperation alu_operation,
+              Macro::ResultOperation result_operation>
+    struct RunSelector {
+        static constexpr Handler value = &Run<operation, alu_operation, result_operation>;
+    };
 
-    /// Calls a GPU Engine method with the input parameter.
-    void Send(u32 value);
+    template <Macro::Operation operation, Macro::ALUOperation alu_operation,
+              Macro::ResultOperation result_operation>
+    struct FusedSelector {
+        static constexpr Handler value =
+            &RunAfterSetMethod<operation, alu_operation, result_operation>;
+    };
 
-    /// Reads a GPU register located at the method address.
-    u32 Read(u32 method) const;
+    template <template <Macro::Operation, Macro::ALUOperation, Macro::ResultOperation>
+              class Selector,
+              Macro::ResultOperation result_operation>
+    static Handler SelectByOperation(Macro::Opcode opcode);
+
+    template <template <Macro::Operation, Macro::ALUOperation, Macro::ResultOperation>
+              class Selector>
+    static Handler SelectHandler(Macro::Opcode opcode);
+
+    template <Macro::BranchCondition condition>
+    static Handler SelectBranchHandler(Macro::Opcode opcode);
+
+    /// Sets the register to the input value.
+    void SetRegister(u32 register_id, u32 value) {
+        // Register 0 is hardwired as the zero register.
+        // Ensure no writes to it actually occur.
+        if (register_id != 0) {
+            registers[register_id] = value;
+        }
+    }
+
+    /// Calls a GPU Engine method with the input parameter.
+    void Send(u32 value) {
+        maxwell3d.CallMethod(method_address.address, value, true);
+        // Increment the method address by the method increment.
+        method_address.address.Assign(method_address.address.Value() +
+                                      method_address.increment.Value());
+    }
 
     /// Returns the next parameter in the parameter queue.
-    u32 FetchParameter();
+    u32 FetchParameter() {
+        ASSERT(next_parameter_index < num_parameters);
+        return parameters[next_parameter_index++];
+    }
 
     Engines::Maxwell3D& maxwell3d;
 
-    /// Current program counter
-    u32 pc{};
-    /// Program counter to execute at after the delay slot is executed.
-    std::optional<u32> delayed_pc;
+    /// Decoded instructions, followed by one that catches execution past the end of the code.
+    std::vector<Instruction> program;
 
     /// General purpose macro registers.
     std::array<u32, Macro::NUM_MACRO_REGISTERS> registers = {};
@@ -86,16 +158,21 @@ private:
     u32 next_parameter_index = 0;
 
     bool carry_flag = false;
-    const std::vector<u32>& code;
 };
 
-void MacroInterpreterImpl::Execute(const std::vector<u32>& params, u32 method) {
+void MacroInterpreterImpl::Execute(std::span<const u32> params, u32 method) {
     MICROPROFILE_SCOPE(MacroInterp);
-    Reset();
 
+    registers = {};
     registers[1] = params[0];
-    num_parameters = params.size();
+    method_address.raw = 0;
+    carry_flag = false;
+    // The next parameter index starts at 1, because $r1 already has the value of the first
+    // parameter.
+    next_parameter_index = 1;
 
+    // Sends may start other macros and grow the caller's parameter list, keep a copy.
+    num_parameters = params.size();
     if (num_parameters > parameters_capacity) {
         parameters_capacity = num_parameters;
         parameters = std::make_unique<u32[]>(num_parameters);
@@ -103,254 +180,315 @@ void MacroInterpreterImpl::Execute(const std::vector<u32>& params, u32 method) {
     std::memcpy(parameters.get(), params.data(), num_parameters * sizeof(u32));
 
     // Execute the code until we hit an exit condition.
-    bool keep_executing = true;
-    while (keep_executing) {
-        keep_executing = Step(false);
+    u32 pc = 0;
+    while (pc != EXIT_PC) {
+        const Instruction& inst = program[pc];
+        pc = inst.handler(*this, inst, pc);
     }
 
     // Assert the the macro used all the input parameters
     ASSERT(next_parameter_index == num_parameters);
 }
 
-void MacroInterpreterImpl::Reset() {
-    registers = {};
-    pc = 0;
-    delayed_pc = {};
-    method_address.raw = 0;
-    num_parameters = 0;
-    // The next parameter index starts at 1, because $r1 already has the value of the first
-    // parameter.
-    next_parameter_index = 1;
-    carry_flag = false;
-}
-
-bool MacroInterpreterImpl::Step(bool is_delay_slot) {
-    u32 base_address = pc;
-
-    Macro::Opcode opcode = GetOpcode();
-    pc += 4;
-
-    // Update the program counter if we were delayed
-    if (delayed_pc) {
-        ASSERT(is_delay_slot);
-        pc = *delayed_pc;
-        delayed_pc = {};
-    }
-
-    switch (opcode.operation) {
-    case Macro::Operation::ALU: {
-        u32 result = GetALUResult(opcode.alu_operation, GetRegister(opcode.src_a),
-                                  GetRegister(opcode.src_b));
-        ProcessResult(opcode.result_operation, opcode.dst, result);
-        break;
-    }
-    case Macro::Operation::AddImmediate: {
-        ProcessResult(opcode.result_operation, opcode.dst,
-                      GetRegister(opcode.src_a) + opcode.immediate);
-        break;
-    }
-    case Macro::Operation::ExtractInsert: {
-        u32 dst = GetRegister(opcode.src_a);
-        u32 src = GetRegister(opcode.src_b);
-
-        src = (src >> opcode.bf_src_bit) & opcode.GetBitfieldMask();
-        dst &= ~(opcode.GetBitfieldMask() << opcode.bf_dst_bit);
-        dst |= src << opcode.bf_dst_bit;
-        ProcessResult(opcode.result_operation, opcode.dst, dst);
-        break;
-    }
-    case Macro::Operation::ExtractShiftLeftImmediate: {
-        u32 dst = GetRegister(opcode.src_a);
-        u32 src = GetRegister(opcode.src_b);
-
-        u32 result = ((src >> dst) & opcode.GetBitfieldMask()) << opcode.bf_dst_bit;
-
-        ProcessResult(opcode.result_operation, opcode.dst, result);
-        break;
-    }
-    case Macro::Operation::ExtractShiftLeftRegister: {
-        u32 dst = GetRegister(opcode.src_a);
-        u32 src = GetRegister(opcode.src_b);
-
-        u32 result = ((src >> opcode.bf_src_bit) & opcode.GetBitfieldMask()) << dst;
-
-        ProcessResult(opcode.result_operation, opcode.dst, result);
-        break;
-    }
-    case Macro::Operation::Read: {
-        u32 result = Read(GetRegister(opcode.src_a) + opcode.immediate);
-        ProcessResult(opcode.result_operation, opcode.dst, result);
-        break;
-    }
-    case Macro::Operation::Branch: {
-        ASSERT_MSG(!is_delay_slot, "Executing a branch in a delay slot is not valid");
-        u32 value = GetRegister(opcode.src_a);
-        bool taken = EvaluateBranchCondition(opcode.branch_condition, value);
-        if (taken) {
-            // Ignore the delay slot if the branch has the annul bit.
-            if (opcode.branch_annul) {
-                pc = base_address + opcode.GetBranchTarget();
-                return true;
-            }
-
-            delayed_pc = base_address + opcode.GetBranchTarget();
-            // Execute one more instruction due to the delay slot.
-            return Step(true);
+template <Macro::Operation operation, Macro::ALUOperation alu_operation>
+u32 MacroInterpreterImpl::Compute(const Instruction& inst) {
+    const u32 src_a = registers[inst.src_a];
+    const u32 src_b = registers[inst.src_b];
+
+    if constexpr (operation == Macro::Operation::ALU) {
+        if constexpr (alu_operation == Macro::ALUOperation::Add) {
+            const u64 result{static_cast<u64>(src_a) + src_b};
+            carry_flag = result > 0xffffffff;
+            return static_cast<u32>(result);
+        } else if constexpr (alu_operation == Macro::ALUOperation::AddWithCarry) {
+            const u64 result{static_cast<u64>(src_a) + src_b + (carry_flag ? 1ULL : 0ULL)};
+            carry_flag = result > 0xffffffff;
+            return static_cast<u32>(result);
+        } else if constexpr (alu_operation == Macro::ALUOperation::Subtract) {
+            const u64 result{static_cast<u64>(src_a) - src_b};
+            carry_flag = result < 0x100000000;
+            return static_cast<u32>(result);
+        } else if constexpr (alu_operation == Macro::ALUOperation::SubtractWithBorrow) {
+            const u64 result{static_cast<u64>(src_a) - src_b - (carry_flag ? 0ULL : 1ULL)};
+            carry_flag = result < 0x100000000;
+            return static_cast<u32>(result);
+        } else if constexpr (alu_operation == Macro::ALUOperation::Xor) {
+            return src_a ^ src_b;
+        } else if constexpr (alu_operation == Macro::ALUOperation::Or) {
+            return src_a | src_b;
+        } else if constexpr (alu_operation == Macro::ALUOperation::And) {
+            return src_a & src_b;
+        } else if constexpr (alu_operation == Macro::ALUOperation::AndNot) {
+            return src_a & ~src_b;
+        } else if constexpr (alu_operation == Macro::ALUOperation::Nand) {
+            return ~(src_a & src_b);
+        } else {
+            UNIMPLEMENTED_MSG("Unimplemented ALU operation {}",
+                              Macro::Opcode{inst.raw}.alu_operation.Value());
+            return 0;
         }
-        break;
-    }
-    default:
-        UNIMPLEMENTED_MSG("Unimplemented macro operation {}", opcode.operation.Value());
-        break;
-    }
-
-    // An instruction with the Exit flag will not actually
-    // cause an exit if it's executed inside a delay slot.
-    if (opcode.is_exit && !is_delay_slot) {
-        // Exit has a delay slot, execute the next instruction
-        Step(true);
-        return false;
+    } else if constexpr (operation == Macro::Operation::AddImmediate) {
+        return src_a + inst.immediate;
+    } else if constexpr (operation == Macro::Operation::ExtractInsert) {
+        u32 dst = src_a;
+        const u32 src = (src_b >> inst.bf_src_bit) & inst.bitfield_mask;
+        dst &= ~(inst.bitfield_mask << inst.bf_dst_bit);
+        dst |= src << inst.bf_dst_bit;
+        return dst;
+    } else if constexpr (operation == Macro::Operation::ExtractShiftLeftImmediate) {
+        return ((src_b >> src_a) & inst.bitfield_mask) << inst.bf_dst_bit;
+    } else if constexpr (operation == Macro::Operation::ExtractShiftLeftRegister) {
+        return ((src_b >> inst.bf_src_bit) & inst.bitfield_mask) << src_a;
+    } else {
+        static_assert(operation == Macro::Operation::Read);
+        return maxwell3d.GetRegisterValue(src_a + inst.immediate);
     }
-
-    return true;
 }
 
-u32 MacroInterpreterImpl::GetALUResult(Macro::ALUOperation operation, u32 src_a, u32 src_b) {
-    switch (operation) {
-    case Macro::ALUOperation::Add: {
-        const u64 result{static_cast<u64>(src_a) + src_b};
-        carry_flag = result > 0xffffffff;
-        return static_cast<u32>(result);
-    }
-    case Macro::ALUOperation::AddWithCarry: {
-        const u64 result{static_cast<u64>(src_a) + src_b + (carry_flag ? 1ULL : 0ULL)};
-        carry_flag = result > 0xffffffff;
-        return static_cast<u32>(result);
-    }
-    case Macro::ALUOperation::Subtract: {
-        const u64 result{static_cast<u64>(src_a) - src_b};
-        carry_flag = result < 0x100000000;
-        return static_cast<u32>(result);
-    }
-    case Macro::ALUOperation::SubtractWithBorrow: {
-        const u64 result{static_cast<u64>(src_a) - src_b - (carry_flag ? 0ULL : 1ULL)};
-        carry_flag = result < 0x100000000;
-        return static_cast<u32>(result);
-    }
-    case Macro::ALUOperation::Xor:
-        return src_a ^ src_b;
-    case Macro::ALUOperation::Or:
-        return src_a | src_b;
-    case Macro::ALUOperation::And:
-        return src_a & src_b;
-    case Macro::ALUOperation::AndNot:
-        return src_a & ~src_b;
-    case Macro::ALUOperation::Nand:
-        return ~(src_a & src_b);
-
-    default:
-        UNIMPLEMENTED_MSG("Unimplemented ALU operation {}", operation);
-        return 0;
-    }
-}
-
-void MacroInterpreterImpl::ProcessResult(Macro::ResultOperation operation, u32 reg, u32 result) {
-    switch (operation) {
-    case Macro::ResultOperation::IgnoreAndFetch:
+template <Macro::ResultOperation result_operation>
+void MacroInterpreterImpl::ProcessResult(u32 reg, u32 result) {
+    if constexpr (result_operation == Macro::ResultOperation::IgnoreAndFetch) {
         // Fetch parameter and ignore result.
         SetRegister(reg, FetchParameter());
-        break;
-    case Macro::ResultOperation::Move:
+    } else if constexpr (result_operation == Macro::ResultOperation::Move) {
         // Move result.
         SetRegister(reg, result);
-        break;
-    case Macro::ResultOperation::MoveAndSetMethod:
+    } else if constexpr (result_operation == Macro::ResultOperation::MoveAndSetMethod) {
         // Move result and use as Method Address.
         SetRegister(reg, result);
-        SetMethodAddress(result);
-        break;
-    case Macro::ResultOperation::FetchAndSend:
+        method_address.raw = result;
+    } else if constexpr (result_operation == Macro::ResultOperation::FetchAndSend) {
         // Fetch parameter and send result.
         SetRegister(reg, FetchParameter());
         Send(result);
-        break;
-    case Macro::ResultOperation::MoveAndSend:
+    } else if constexpr (result_operation == Macro::ResultOperation::MoveAndSend) {
         // Move and send result.
         SetRegister(reg, result);
         Send(result);
-        break;
-    case Macro::ResultOperation::FetchAndSetMethod:
+    } else if constexpr (result_operation == Macro::ResultOperation::FetchAndSetMethod) {
         // Fetch parameter and use result as Method Address.
         SetRegister(reg, FetchParameter());
-        SetMethodAddress(result);
-        break;
-    case Macro::ResultOperation::MoveAndSetMethodFetchAndSend:
+        method_address.raw = result;
+    } else if constexpr (result_operation ==
+                         Macro::ResultOperation::MoveAndSetMethodFetchAndSend) {
         // Move result and use as Method Address, then fetch and send parameter.
         SetRegister(reg, result);
-        SetMethodAddress(result);
+        method_address.raw = result;
         Send(FetchParameter());
-        break;
-    case Macro::ResultOperation::MoveAndSetMethodSend:
+    } else {
+        static_assert(result_operation == Macro::ResultOperation::MoveAndSetMethodSend);
         // Move result and use as Method Address, then send bits 12:17 of result.
         SetRegister(reg, result);
-        SetMethodAddress(result);
+        method_address.raw = result;
         Send((result >> 12) & 0b111111);
-        break;
-    default:
-        UNIMPLEMENTED_MSG("Unimplemented result operation {}", operation);
-        break;
     }
 }
 
-bool MacroInterpreterImpl::EvaluateBranchCondition(Macro::BranchCondition cond, u32 value) const {
-    switch (cond) {
-    case Macro::BranchCondition::Zero:
-        return value == 0;
-    case Macro::BranchCondition::NotZero:
-        return value != 0;
+template <Macro::Operation operation, Macro::ALUOperation alu_operation,
+          Macro::ResultOperation result_operation>
+u32 MacroInterpreterImpl::Run(MacroInterpreterImpl& self, const Instruction& inst, u32 pc) {
+    self.ProcessResult<result_operation>(inst.dst,
+                                         self.Compute<operation, alu_operation>(inst));
+    return pc + 1;
+}
+
+/**
+ * Superinstruction for the common pair of an immediate add setting the method address, followed by
+ * an instruction sending a value to it. Jumps into the second instruction still find it decoded on
+ * its own at the next index.
+ */
+template <Macro::Operation operation, Macro::ALUOperation alu_operation,
+          Macro::ResultOperation result_operation>
+u32 MacroInterpreterImpl::RunAfterSetMethod(MacroInterpreterImpl& self, const Instruction& inst,
+                                            u32 pc) {
+    self.ProcessResult<Macro::ResultOperation::MoveAndSetMethod>(
+        inst.dst, self.Compute<Macro::Operation::AddImmediate, Macro::ALUOperation::Add>(inst));
+    const Instruction& next = self.program[pc + 1];
+    self.ProcessResult<result_operation>(next.dst, self.Compute<operation, alu_operation>(next));
+    return pc + 2;
+}
+
+template <Macro::BranchCondition condition, bool annul, bool is_exit>
+u32 MacroInterpreterImpl::Branch(MacroInterpreterImpl& self, const Instruction& inst, u32 pc) {
+    const u32 value = self.registers[inst.src_a];
+    const bool taken = condition == Macro::BranchCondition::Zero ? value == 0 : value != 0;
+    if (taken) {
+        // Ignore the delay slot if the branch has the annul bit.
+        if (!annul) {
+            // Execute one more instruction due to the delay slot.
+            self.ExecuteDelaySlot(pc + 1);
+        }
+        return inst.branch_target;
     }
-    UNREACHABLE();
+    if (is_exit) {
+        // Exit has a delay slot, execute the next instruction
+        self.ExecuteDelaySlot(pc + 1);
+        return EXIT_PC;
+    }
+    return pc + 1;
 }
 
-Macro::Opcode MacroInterpreterImpl::GetOpcode() const {
-    ASSERT((pc % sizeof(u32)) == 0);
-    ASSERT(pc < code.size() * sizeof(u32));
-    return {code[pc / sizeof(u32)]};
+u32 MacroInterpreterImpl::Exit(MacroInterpreterImpl& self, const Instruction& inst, u32 pc) {
+    // An instruction with the Exit flag will not actually
+    // cause an exit if it's executed inside a delay slot.
+    inst.delay_slot_handler(self, inst, pc);
+    // Exit has a delay slot, execute the next instruction
+    self.ExecuteDelaySlot(pc + 1);
+    return EXIT_PC;
 }
 
-u32 MacroInterpreterImpl::GetRegister(u32 register_id) const {
-    return registers.at(register_id);
+u32 MacroInterpreterImpl::BranchInDelaySlot(MacroInterpreterImpl& self, const Instruction& inst,
+                                            u32 pc) {
+    ASSERT_MSG(false, "Executing a branch in a delay slot is not valid");
+    return pc + 1;
 }
 
-void MacroInterpreterImpl::SetRegister(u32 register_id, u32 value) {
-    // Register 0 is hardwired as the zero register.
-    // Ensure no writes to it actually occur.
-    if (register_id == 0) {
-        return;
-    }
+u32 MacroInterpreterImpl::Unimplemented(MacroInterpreterImpl& self, const Instruction& inst,
+                                        u32 pc) {
+    UNIMPLEMENTED_MSG("Unimplemented macro operation {}",
+                      Macro::Opcode{inst.raw}.operation.Value());
+    return pc + 1;
+}
 
-    registers.at(register_id) = value;
+u32 MacroInterpreterImpl::OutOfBounds(MacroInterpreterImpl& self, const Instruction& inst,
+                                      u32 pc) {
+    ASSERT_MSG(false, "Macro executed past the end of its code");
+    return EXIT_PC;
 }
 
-void MacroInterpreterImpl::SetMethodAddress(u32 address) {
-    method_address.raw = address;
+template <template <Macro::Operation, Macro::ALUOperation, Macro::ResultOperation> class Selector,
+          Macro::ResultOperation result_operation>
+Handler MacroInterpreterImpl::SelectByOperation(Macro::Opcode opcode) {
+    using Macro::ALUOperation;
+    using Macro::Operation;
+    switch (opcode.operation) {
+    case Operation::ALU:
+        switch (opcode.alu_operation) {
+        case ALUOperation::Add:
+            return Selector<Operation::ALU, ALUOperation::Add, result_operation>::value;
+        case ALUOperation::AddWithCarry:
+            return Selector<Operation::ALU, ALUOperation::AddWithCarry, result_operation>::value;
+        case ALUOperation::Subtract:
+            return Selector<Operation::ALU, ALUOperation::Subtract, result_operation>::value;
+        case ALUOperation::SubtractWithBorrow:
+            return Selector<Operation::ALU, ALUOperation::SubtractWithBorrow,
+                            result_operation>::value;
+        case ALUOperation::Xor:
+            return Selector<Operation::ALU, ALUOperation::Xor, result_operation>::value;
+        case ALUOperation::Or:
+            return Selector<Operation::ALU, ALUOperation::Or, result_operation>::value;
+        case ALUOperation::And:
+            return Selector<Operation::ALU, ALUOperation::And, result_operation>::value;
+        case ALUOperation::AndNot:
+            return Selector<Operation::ALU, ALUOperation::AndNot, result_operation>::value;
+        case ALUOperation::Nand:
+            return Selector<Operation::ALU, ALUOperation::Nand, result_operation>::value;
+        default:
+            // Invalid encodings log when executed and produce zero.
+            return Selector<Operation::ALU, static_cast<ALUOperation>(4), result_operation>::value;
+        }
+    case Operation::AddImmediate:
+        return Selector<Operation::AddImmediate, ALUOperation::Add, result_operation>::value;
+    case Operation::ExtractInsert:
+        return Selector<Operation::ExtractInsert, ALUOperation::Add, result_operation>::value;
+    case Operation::ExtractShiftLeftImmediate:
+        return Selector<Operation::ExtractShiftLeftImmediate, ALUOperation::Add,
+                        result_operation>::value;
+    case Operation::ExtractShiftLeftRegister:
+        return Selector<Operation::ExtractShiftLeftRegister, ALUOperation::Add,
+                        result_operation>::value;
+    case Operation::Read:
+        return Selector<Operation::Read, ALUOperation::Add, result_operation>::value;
+    default:
+        return nullptr;
+    }
 }
 
-void MacroInterpreterImpl::Send(u32 value) {
-    maxwell3d.CallMethod(method_address.address, value, true);
-    // Increment the method address by the method increment.
-    method_address.address.Assign(method_address.address.Value() +
-                                  method_address.increment.Value());
+template <template <Macro::Operation, Macro::ALUOperation, Macro::ResultOperation> class Selector>
+Handler MacroInterpreterImpl::SelectHandler(Macro::Opcode opcode) {
+    using Macro::ResultOperation;
+    switch (opcode.result_operation) {
+    case ResultOperation::IgnoreAndFetch:
+        return SelectByOperation<Selector, ResultOperation::IgnoreAndFetch>(opcode);
+    case ResultOperation::Move:
+        return SelectByOperation<Selector, ResultOperation::Move>(opcode);
+    case ResultOperation::MoveAndSetMethod:
+        return SelectByOperation<Selector, ResultOperation::MoveAndSetMethod>(opcode);
+    case ResultOperation::FetchAndSend:
+        return SelectByOperation<Selector, ResultOperation::FetchAndSend>(opcode);
+    case ResultOperation::MoveAndSend:
+        return SelectByOperation<Selector, ResultOperation::MoveAndSend>(opcode);
+    case ResultOperation::FetchAndSetMethod:
+        return SelectByOperation<Selector, ResultOperation::FetchAndSetMethod>(opcode);
+    case ResultOperation::MoveAndSetMethodFetchAndSend:
+        return SelectByOperation<Selector, ResultOperation::MoveAndSetMethodFetchAndSend>(opcode);
+    case ResultOperation::MoveAndSetMethodSend:
+        return SelectByOperation<Selector, ResultOperation::MoveAndSetMethodSend>(opcode);
+    }
+    return nullptr;
 }
 
-u32 MacroInterpreterImpl::Read(u32 method) const {
-    return maxwell3d.GetRegisterValue(method);
+template <Macro::BranchCondition condition>
+Handler MacroInterpreterImpl::SelectBranchHandler(Macro::Opcode opcode) {
+    if (opcode.branch_annul) {
+        return opcode.is_exit ? &Branch<condition, true, true> : &Branch<condition, true, false>;
+    }
+    return opcode.is_exit ? &Branch<condition, false, true> : &Branch<condition, false, false>;
 }
 
-u32 MacroInterpreterImpl::FetchParameter() {
-    ASSERT(next_parameter_index < num_parameters);
-    return parameters[next_parameter_index++];
+void MacroInterpreterImpl::Decode(std::span<const u32> code) {
+    const u32 end = static_cast<u32>(code.size());
+    program.resize(code.size() + 1);
+
+    for (u32 index = 0; index < end; ++index) {
+        const Macro::Opcode opcode{code[index]};
+        Instruction& inst = program[index];
+        inst.raw = opcode.raw;
+        inst.dst = opcode.dst;
+        inst.src_a = opcode.src_a;
+        inst.src_b = opcode.src_b;
+        inst.immediate = opcode.immediate;
+        inst.bf_src_bit = opcode.bf_src_bit;
+        inst.bf_dst_bit = opcode.bf_dst_bit;
+        inst.bitfield_mask = opcode.GetBitfieldMask();
+
+        // Jumps outside of the code land on the final instruction, which reports them.
+        const s64 target = static_cast<s64>(index) + opcode.immediate;
+        inst.branch_target = target >= 0 && target < end ? static_cast<u32>(target) : end;
+
+        if (opcode.operation == Macro::Operation::Branch) {
+            inst.delay_slot_handler = &BranchInDelaySlot;
+            inst.handler = opcode.branch_condition == Macro::BranchCondition::Zero
+                               ? SelectBranchHandler<Macro::BranchCondition::Zero>(opcode)
+                               : SelectBranchHandler<Macro::BranchCondition::NotZero>(opcode);
+            continue;
+        }
+        inst.delay_slot_handler = SelectHandler<RunSelector>(opcode);
+        if (inst.delay_slot_handler == nullptr) {
+            inst.delay_slot_handler = &Unimplemented;
+        }
+        inst.handler = opcode.is_exit ? &Exit : inst.delay_slot_handler;
+    }
+    program[end].handler = &OutOfBounds;
+    program[end].delay_slot_handler = &OutOfBounds;
+
+    // Fuse setting the method address with an immediately following send.
+    for (u32 index = 0; index + 1 < end; ++index) {
+        const Macro::Opcode opcode{code[index]};
+        const Macro::Opcode next{code[index + 1]};
+        if (opcode.operation != Macro::Operation::AddImmediate ||
+            opcode.result_operation != Macro::ResultOperation::MoveAndSetMethod ||
+            opcode.is_exit || next.operation == Macro::Operation::Branch || next.is_exit ||
+            (next.result_operation != Macro::ResultOperation::MoveAndSend &&
+             next.result_operation != Macro::ResultOperation::FetchAndSend)) {
+            continue;
+        }
+        if (const Handler fused = SelectHandler<FusedSelector>(next); fused != nullptr) {
+            program[index].handler = fused;
+        }
+    }
 }
+
 } // Anonymous namespace
 
 MacroInterpreter::MacroInterpreter(Engines::Maxwell3D& maxwell3d_)
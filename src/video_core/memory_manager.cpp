@@ -757,7 +757,11 @@ void MemoryManager::FlushCaching() {
     accumulator->Callback([this](GPUVAddr addr, size_t size) {
         GetSubmappedRangeImpl<false>(addr, size, page_stash2);
     });
+    // Distinct GPU ranges can be backed by contiguous device memory
+    VideoCommon::MergeRanges(page_stash2);
     rasterizer->InnerInvalidation(page_stash2);
+    LOG_TRACE(HW_GPU, "Invalidated {} device ranges, {} merged from {} cached writes so far",
+              page_stash2.size(), accumulator->NumDispatched(), accumulator->NumAdded());
     page_stash2.clear();
     accumulator->Clear();
 }
@@ -3,6 +3,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <atomic>
+#include <chrono>
 #include <fstream>
 #include <functional>
 #include <mutex>
@@ -49,10 +50,11 @@ using VideoCommon::FileEnvironment;
 using VideoCommon::GenericEnvironment;
 using VideoCommon::GraphicsEnvironment;
 using VideoCommon::LoadPipelines;
+using VideoCommon::ReadPipelineKey;
 using VideoCommon::SerializePipeline;
 using Context = ShaderContext::Context;
 
-constexpr u32 CACHE_VERSION = 10;
+constexpr u32 CACHE_VERSION = 11;
 
 template <typename Container>
 auto MakeSpan(Container& container) {
@@ -291,9 +293,11 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
             workers->QueueWork(std::move(work));
         }
     }};
-    const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
+    const auto load_compute{[&](std::span<const char> key_data, FileEnvironment env) {
         ComputePipelineKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
+        if (!ReadPipelineKey(key_data, key)) {
+            return;
+        }
         queue_work([this, key, env_ = std::move(env), &state, &callback](Context* ctx) mutable {
             ctx->pools.ReleaseContents();
             auto pipeline{CreateComputePipeline(ctx->pools, key, env_, true)};
@@ -308,9 +312,12 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         });
         ++state.total;
     }};
-    const auto load_graphics{[&](std::ifstream& file, std::vector<FileEnvironment> envs) {
+    const auto load_graphics{[&](std::span<const char> key_data,
+                                 std::vector<FileEnvironment> envs) {
         GraphicsPipelineKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
+        if (!ReadPipelineKey(key_data, key)) {
+            return;
+        }
         queue_work([this, key, envs_ = std::move(envs), &state, &callback](Context* ctx) mutable {
             boost::container::static_vector<Shader::Environment*, 5> env_ptrs;
             for (auto& env : envs_) {
@@ -329,6 +336,7 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         });
         ++state.total;
     }};
+    const auto load_start_time{std::chrono::steady_clock::now()};
     LoadPipelines(stop_loading, shader_cache_filename, CACHE_VERSION, load_compute, load_graphics);
 
     LOG_INFO(Render_OpenGL, "Total Pipeline Count: {}", state.total);
@@ -342,6 +350,10 @@ void ShaderCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading,
         return;
     }
     workers->WaitForRequests(stop_loading);
+    LOG_INFO(Render_OpenGL, "Pipeline cache loaded and built in {} ms",
+             std::chrono::duration_cast<std::chrono::milliseconds>(
+                 std::chrono::steady_clock::now() - load_start_time)
+                 .count());
     if (!use_asynchronous_shaders) {
         workers.reset();
     }
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <chrono>
 #include <fstream>
 #include <memory>
 #include <thread>
@@ -14,6 +15,7 @@
 #include "common/fs/fs.h"
 #include "common/fs/path_util.h"
 #include "common/microprofile.h"
+#include "common/scm_rev.h"
 #include "common/thread_worker.h"
 #include "core/core.h"
 #include "shader_recompiler/backend/spirv/emit_spirv.h"
@@ -37,6 +39,7 @@
 #include "video_core/shader_cache.h"
 #include "video_core/shader_environment.h"
 #include "video_core/shader_notify.h"
+#include "video_core/shader_output_cache.h"
 #include "video_core/vulkan_common/vulkan_device.h"
 #include "video_core/vulkan_common/vulkan_wrapper.h"
 
@@ -53,8 +56,9 @@ using VideoCommon::ComputeEnvironment;
 using VideoCommon::FileEnvironment;
 using VideoCommon::GenericEnvironment;
 using VideoCommon::GraphicsEnvironment;
+using VideoCommon::ReadPipelineKey;
 
-constexpr u32 CACHE_VERSION = 11;
+constexpr u32 CACHE_VERSION = 12;
 constexpr std::array<char, 8> VULKAN_CACHE_MAGIC_NUMBER{'y', 'u', 'z', 'u', 'v', 'k', 'c', 'h'};
 
 template <typename Container>
@@ -497,6 +501,23 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
     }
     pipeline_cache_filename = base_dir / "vulkan.bin";
 
+    if (Settings::values.use_shader_output_cache.GetValue()) {
+        // Everything besides the pipeline keys the emitted SPIR-V and shader infos depend on
+        const auto& resolution{Settings::values.resolution_info};
+        const std::array<std::string, 7> salt_parts{
+            Common::g_scm_rev,
+            "vulkan",
+            std::string{device.GetModelName()},
+            fmt::format("{}:{}", static_cast<u32>(device.GetDriverID()), device.GetDriverVersion()),
+            fmt::format("{}", CACHE_VERSION),
+            fmt::format("{}:{}:{}", resolution.active, resolution.up_scale, resolution.down_shift),
+            fmt::format("{}:{}", Settings::values.disable_shader_loop_safety_checks.GetValue(),
+                        Settings::values.renderer_debug.GetValue()),
+        };
+        output_cache = std::make_unique<VideoCommon::ShaderOutputCache>(
+            base_dir / "vulkan_outputs.bin", VideoCommon::ShaderOutputCache::MakeSalt(salt_parts));
+    }
+
     if (use_vulkan_pipeline_cache) {
         vulkan_pipeline_cache_filename = base_dir / "vulkan_pipelines.bin";
         vulkan_pipeline_cache =
@@ -514,9 +535,11 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
     if (device.IsKhrPipelineExecutablePropertiesEnabled()) {
         state.statistics = std::make_unique<PipelineStatistics>(device);
     }
-    const auto load_compute{[&](std::ifstream& file, FileEnvironment env) {
+    const auto load_compute{[&](std::span<const char> key_data, FileEnvironment env) {
         ComputePipelineCacheKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
+        if (!ReadPipelineKey(key_data, key)) {
+            return;
+        }
 
         workers.QueueWork([this, key, env_ = std::move(env), &state, &callback]() mutable {
             ShaderPools pools;
@@ -532,9 +555,12 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
         });
         ++state.total;
     }};
-    const auto load_graphics{[&](std::ifstream& file, std::vector<FileEnvironment> envs) {
+    const auto load_graphics{[&](std::span<const char> key_data,
+                                 std::vector<FileEnvironment> envs) {
         GraphicsPipelineCacheKey key;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key));
+        if (!ReadPipelineKey(key_data, key)) {
+            return;
+        }
 
         if ((key.state.extended_dynamic_state != 0) !=
                 dynamic_features.has_extended_dynamic_state ||
@@ -569,6 +595,7 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
         });
         ++state.total;
     }};
+    const auto load_start_time{std::chrono::steady_clock::now()};
     VideoCommon::LoadPipelines(stop_loading, pipeline_cache_filename, CACHE_VERSION, load_compute,
                                load_graphics);
 
@@ -580,6 +607,13 @@ void PipelineCache::LoadDiskResources(u64 title_id, std::stop_token stop_loading
     lock.unlock();
 
     workers.WaitForRequests(stop_loading);
+    if (output_cache) {
+        output_cache->FinishLoading();
+    }
+    LOG_INFO(Render_Vulkan, "Pipeline cache loaded and built in {} ms",
+             std::chrono::duration_cast<std::chrono::milliseconds>(
+                 std::chrono::steady_clock::now() - load_start_time)
+                 .count());
 
     if (use_vulkan_pipeline_cache) {
         SerializeVulkanPipelineCache(vulkan_pipeline_cache_filename, vulkan_pipeline_cache,
@@ -673,6 +707,18 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
     bool build_in_parallel) try {
     auto hash = key.Hash();
     LOG_INFO(Render_Vulkan, "0x{:016x}", hash);
+    const std::span<const char> key_data{reinterpret_cast<const char*>(&key), key.Size()};
+    std::vector<VideoCommon::ShaderOutput> outputs;
+    if (output_cache && !Settings::values.dump_shaders &&
+        output_cache->Find(key_data, outputs) &&
+        std::ranges::all_of(outputs, [](const VideoCommon::ShaderOutput& output) {
+            return output.stage_index < Maxwell::MaxShaderStage;
+        })) {
+        return CreateGraphicsPipeline(key, outputs, statistics, build_in_parallel);
+    }
+    outputs.clear();
+    const auto compile_start{std::chrono::steady_clock::now()};
+
     size_t env_index{0};
     std::array<Shader::IR::Program, Maxwell::MaxShaderProgram> programs;
     const bool uses_vertex_a{key.unique_hashes[0] != 0};
@@ -743,8 +789,18 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
             const std::string name{fmt::format("Shader {:016x}", key.unique_hashes[index])};
             modules[stage_index].SetObjectNameEXT(name.c_str());
         }
+        if (output_cache) {
+            VideoCommon::ShaderOutput& output{outputs.emplace_back()};
+            output.stage_index = static_cast<u32>(stage_index);
+            output.info = program.info;
+            output.SetCode(code);
+        }
         previous_stage = &program;
     }
+    if (output_cache) {
+        output_cache->Insert(key_data, std::move(outputs),
+                             std::chrono::steady_clock::now() - compile_start);
+    }
     Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
     return std::make_unique<GraphicsPipeline>(
         scheduler, buffer_cache, texture_cache, vulkan_pipeline_cache, &shader_notify, device,
@@ -769,6 +825,29 @@ std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
     return nullptr;
 }
 
+std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline(
+    const GraphicsPipelineCacheKey& key, std::span<const VideoCommon::ShaderOutput> outputs,
+    PipelineStatistics* statistics, bool build_in_parallel) {
+    std::array<const Shader::Info*, Maxwell::MaxShaderStage> infos{};
+    std::array<vk::ShaderModule, Maxwell::MaxShaderStage> modules;
+    for (const VideoCommon::ShaderOutput& output : outputs) {
+        const std::vector<u32> code{output.CodeWords()};
+        device.SaveShader(code);
+        modules[output.stage_index] = BuildShader(device, code);
+        if (device.HasDebuggingToolAttached()) {
+            const std::string name{
+                fmt::format("Shader {:016x}", key.unique_hashes[output.stage_index + 1])};
+            modules[output.stage_index].SetObjectNameEXT(name.c_str());
+        }
+        infos[output.stage_index] = &output.info;
+    }
+    Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
+    return std::make_unique<GraphicsPipeline>(
+        scheduler, buffer_cache, texture_cache, vulkan_pipeline_cache, &shader_notify, device,
+        descriptor_pool, guest_descriptor_queue, thread_worker, statistics, render_pass_cache, key,
+        std::move(modules), infos);
+}
+
 std::unique_ptr<GraphicsPipeline> PipelineCache::CreateGraphicsPipeline() {
     GraphicsEnvironments environments;
     GetGraphicsEnvironments(environments, graphics_key.unique_hashes);
@@ -822,6 +901,19 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
 
     LOG_INFO(Render_Vulkan, "0x{:016x}", hash);
 
+    const std::span<const char> key_data{reinterpret_cast<const char*>(&key), sizeof(key)};
+    std::vector<VideoCommon::ShaderOutput> outputs;
+    if (output_cache && !Settings::values.dump_shaders &&
+        output_cache->Find(key_data, outputs) && outputs.size() == 1) {
+        const std::vector<u32> code{outputs.front().CodeWords()};
+        device.SaveShader(code);
+        Common::ThreadWorker* const thread_worker{build_in_parallel ? &workers : nullptr};
+        return std::make_unique<ComputePipeline>(
+            device, vulkan_pipeline_cache, descriptor_pool, guest_descriptor_queue, thread_worker,
+            statistics, &shader_notify, outputs.front().info, BuildShader(device, code));
+    }
+    const auto compile_start{std::chrono::steady_clock::now()};
+
     Shader::Maxwell::Flow::CFG cfg{env, pools.flow_block, env.StartAddress()};
 
     // Dump it before error.
@@ -848,6 +940,13 @@ std::unique_ptr<ComputePipeline> PipelineCache::CreateComputePipeline(
     }
 
     const std::vector<u32> code{EmitSPIRV(profile, program)};
+    if (output_cache) {
+        std::vector<VideoCommon::ShaderOutput> new_outputs(1);
+        new_outputs.front().info = program.info;
+        new_outputs.front().SetCode(code);
+        output_cache->Insert(key_data, std::move(new_outputs),
+                             std::chrono::steady_clock::now() - compile_start);
+    }
     device.SaveShader(code);
     vk::ShaderModule spv_module{BuildShader(device, code)};
     if (device.HasDebuggingToolAttached()) {
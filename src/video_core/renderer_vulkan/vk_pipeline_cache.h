@@ -7,6 +7,7 @@
 #include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <span>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
@@ -36,6 +37,11 @@ namespace Shader::IR {
 struct Program;
 }
 
+namespace VideoCommon {
+class ShaderOutputCache;
+struct ShaderOutput;
+} // namespace VideoCommon
+
 namespace VideoCore {
 class ShaderNotify;
 }
@@ -125,6 +131,10 @@ private:
         std::span<Shader::Environment* const> envs, PipelineStatistics* statistics,
         bool build_in_parallel);
 
+    std::unique_ptr<GraphicsPipeline> CreateGraphicsPipeline(
+        const GraphicsPipelineCacheKey& key, std::span<const VideoCommon::ShaderOutput> outputs,
+        PipelineStatistics* statistics, bool build_in_parallel);
+
     std::unique_ptr<ComputePipeline> CreateComputePipeline(const ComputePipelineCacheKey& key,
                                                            const ShaderInfo* shader);
 
@@ -167,6 +177,8 @@ private:
     std::filesystem::path vulkan_pipeline_cache_filename;
     vk::PipelineCache vulkan_pipeline_cache;
 
+    std::unique_ptr<VideoCommon::ShaderOutputCache> output_cache;
+
     Common::ThreadWorker workers;
     Common::ThreadWorker serialization_thread;
     DynamicFeatures dynamic_features;
@@ -2,10 +2,16 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <exception>
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <memory>
 #include <optional>
+#include <sstream>
+#include <thread>
 #include <utility>
 
 #include "common/assert.h"
@@ -13,9 +19,11 @@
 #include "common/common_types.h"
 #include "common/div_ceil.h"
 #include "common/fs/fs.h"
+#include "common/fs/mapped_file.h"
 #include "common/fs/path_util.h"
 #include "common/logging/log.h"
 #include "common/polyfill_ranges.h"
+#include "common/thread_worker.h"
 #include "shader_recompiler/environment.h"
 #include "video_core/engines/kepler_compute.h"
 #include "video_core/memory_manager.h"
@@ -29,6 +37,11 @@ constexpr std::array<char, 8> MAGIC_NUMBER{'y', 'u', 'z', 'u', 'c', 'a', 'c', 'h
 
 constexpr size_t INST_SIZE = sizeof(u64);
 
+constexpr size_t CACHE_HEADER_SIZE = MAGIC_NUMBER.size() + sizeof(u32);
+
+/// Number of pipeline cache entries deserialized by a single task.
+constexpr size_t ENTRIES_PER_LOAD_BATCH = 64;
+
 using Maxwell = Tegra::Engines::Maxwell3D::Regs;
 
 static u64 MakeCbufKey(u32 index, u32 offset) {
@@ -193,7 +206,7 @@ void GenericEnvironment::Dump(u64 pipeline_hash, u64 shader_hash) {
     DumpImpl(pipeline_hash, shader_hash, code, read_highest, read_lowest, initial_offset, stage);
 }
 
-void GenericEnvironment::Serialize(std::ofstream& file) const {
+void GenericEnvironment::Serialize(std::ostream& file) const {
     const u64 code_size{static_cast<u64>(CachedSizeBytes())};
     const u64 num_texture_types{static_cast<u64>(texture_types.size())};
     const u64 num_texture_pixel_formats{static_cast<u64>(texture_pixel_formats.size())};
@@ -448,68 +461,101 @@ u32 ComputeEnvironment::ReadViewportTransformState() {
     return viewport_transform_state;
 }
 
-void FileEnvironment::Deserialize(std::ifstream& file) {
+namespace {
+/// Bounds checked reader over a serialized pipeline cache entry.
+class EntryReader {
+public:
+    explicit EntryReader(std::span<const char> data_) : data{data_} {}
+
+    EntryReader& Read(void* dest, size_t size) {
+        if (size > Remaining()) {
+            throw std::ios_base::failure("Truncated pipeline cache entry");
+        }
+        std::memcpy(dest, data.data() + offset, size);
+        offset += size;
+        return *this;
+    }
+
+    template <typename T>
+    EntryReader& Read(T& value) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return Read(&value, sizeof(value));
+    }
+
+    [[nodiscard]] size_t Offset() const noexcept {
+        return offset;
+    }
+
+    [[nodiscard]] size_t Remaining() const noexcept {
+        return data.size() - offset;
+    }
+
+private:
+    std::span<const char> data;
+    size_t offset{};
+};
+} // Anonymous namespace
+
+size_t FileEnvironment::Deserialize(std::span<const char> data) {
+    EntryReader file{data};
     u64 code_size{};
     u64 num_texture_types{};
     u64 num_texture_pixel_formats{};
     u64 num_cbuf_values{};
     u64 num_cbuf_replacement_values{};
-    file.read(reinterpret_cast<char*>(&code_size), sizeof(code_size))
-        .read(reinterpret_cast<char*>(&num_texture_types), sizeof(num_texture_types))
-        .read(reinterpret_cast<char*>(&num_texture_pixel_formats),
-              sizeof(num_texture_pixel_formats))
-        .read(reinterpret_cast<char*>(&num_cbuf_values), sizeof(num_cbuf_values))
-        .read(reinterpret_cast<char*>(&num_cbuf_replacement_values),
-              sizeof(num_cbuf_replacement_values))
-        .read(reinterpret_cast<char*>(&local_memory_size), sizeof(local_memory_size))
-        .read(reinterpret_cast<char*>(&texture_bound), sizeof(texture_bound))
-        .read(reinterpret_cast<char*>(&start_address), sizeof(start_address))
-        .read(reinterpret_cast<char*>(&read_lowest), sizeof(read_lowest))
-        .read(reinterpret_cast<char*>(&read_highest), sizeof(read_highest))
-        .read(reinterpret_cast<char*>(&viewport_transform_state), sizeof(viewport_transform_state))
-        .read(reinterpret_cast<char*>(&stage), sizeof(stage));
+    file.Read(code_size)
+        .Read(num_texture_types)
+        .Read(num_texture_pixel_formats)
+        .Read(num_cbuf_values)
+        .Read(num_cbuf_replacement_values)
+        .Read(local_memory_size)
+        .Read(texture_bound)
+        .Read(start_address)
+        .Read(read_lowest)
+        .Read(read_highest)
+        .Read(viewport_transform_state)
+        .Read(stage);
+    if (code_size > file.Remaining()) {
+        throw std::ios_base::failure("Truncated pipeline cache entry");
+    }
     code.resize(Common::DivCeil(code_size, sizeof(u64)));
-    file.read(reinterpret_cast<char*>(code.data()), code_size);
+    file.Read(code.data(), code_size);
     for (size_t i = 0; i < num_texture_types; ++i) {
         u32 key;
         Shader::TextureType type;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key))
-            .read(reinterpret_cast<char*>(&type), sizeof(type));
+        file.Read(key).Read(type);
         texture_types.emplace(key, type);
     }
     for (size_t i = 0; i < num_texture_pixel_formats; ++i) {
         u32 key;
         Shader::TexturePixelFormat format;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key))
-            .read(reinterpret_cast<char*>(&format), sizeof(format));
+        file.Read(key).Read(format);
         texture_pixel_formats.emplace(key, format);
     }
     for (size_t i = 0; i < num_cbuf_values; ++i) {
         u64 key;
         u32 value;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key))
-            .read(reinterpret_cast<char*>(&value), sizeof(value));
+        file.Read(key).Read(value);
         cbuf_values.emplace(key, value);
     }
     for (size_t i = 0; i < num_cbuf_replacement_values; ++i) {
         u64 key;
         Shader::ReplaceConstant value;
-        file.read(reinterpret_cast<char*>(&key), sizeof(key))
-            .read(reinterpret_cast<char*>(&value), sizeof(value));
+        file.Read(key).Read(value);
         cbuf_replacements.emplace(key, value);
     }
     if (stage == Shader::Stage::Compute) {
-        file.read(reinterpret_cast<char*>(&workgroup_size), sizeof(workgroup_size))
-            .read(reinterpret_cast<char*>(&shared_memory_size), sizeof(shared_memory_size));
+        file.Read(workgroup_size).Read(shared_memory_size);
         initial_offset = 0;
     } else {
-        file.read(reinterpret_cast<char*>(&sph), sizeof(sph));
+        file.Read(sph);
         initial_offset = sizeof(sph);
         if (stage == Shader::Stage::Geometry) {
-            file.read(reinterpret_cast<char*>(&gp_passthrough_mask), sizeof(gp_passthrough_mask));
+            file.Read(gp_passthrough_mask);
         }
     }
     is_proprietary_driver = texture_bound == 2;
+    return file.Offset();
 }
 
 void FileEnvironment::Dump(u64 pipeline_hash, u64 shader_hash) {
@@ -599,12 +645,20 @@ void SerializePipeline(std::span<const char> key, std::span<const GenericEnviron
     if (!std::ranges::all_of(envs, &GenericEnvironment::CanBeSerialized)) {
         return;
     }
+    // Build the whole entry first so it can be prefixed with its size, the loader uses the sizes
+    // to index the file without having to parse every entry
+    std::ostringstream entry;
     const u32 num_envs{static_cast<u32>(envs.size())};
-    file.write(reinterpret_cast<const char*>(&num_envs), sizeof(num_envs));
+    entry.write(reinterpret_cast<const char*>(&num_envs), sizeof(num_envs));
     for (const GenericEnvironment* const env : envs) {
-        env->Serialize(file);
+        env->Serialize(entry);
     }
-    file.write(key.data(), key.size_bytes());
+    entry.write(key.data(), key.size_bytes());
+
+    const std::string entry_data{std::move(entry).str()};
+    const u64 entry_size{static_cast<u64>(entry_data.size())};
+    file.write(reinterpret_cast<const char*>(&entry_size), sizeof(entry_size))
+        .write(entry_data.data(), entry_data.size());
 
 } catch (const std::ios_base::failure& e) {
     LOG_ERROR(Common_Filesystem, "{}", e.what());
@@ -614,24 +668,88 @@ void SerializePipeline(std::span<const char> key, std::span<const GenericEnviron
     }
 }
 
+namespace {
+struct LoadedPipeline {
+    std::vector<FileEnvironment> envs;
+    std::span<const char> key;
+};
+
+LoadedPipeline DeserializePipeline(std::span<const char> entry) {
+    u32 num_envs{};
+    EntryReader{entry}.Read(num_envs);
+    if (num_envs == 0 || num_envs > Maxwell::MaxShaderProgram) {
+        throw std::ios_base::failure("Invalid pipeline cache entry");
+    }
+    LoadedPipeline pipeline;
+    pipeline.envs.resize(num_envs);
+    size_t offset{sizeof(num_envs)};
+    for (FileEnvironment& env : pipeline.envs) {
+        offset += env.Deserialize(entry.subspan(offset));
+    }
+    pipeline.key = entry.subspan(offset);
+    return pipeline;
+}
+
+/// Splits the entries of a pipeline cache file, returns nullopt when the file is truncated.
+std::optional<std::vector<std::span<const char>>> IndexPipelineCache(
+    std::span<const char> contents) {
+    std::vector<std::span<const char>> entries;
+    size_t offset{CACHE_HEADER_SIZE};
+    while (offset != contents.size()) {
+        u64 entry_size{};
+        if (contents.size() - offset < sizeof(entry_size)) {
+            return std::nullopt;
+        }
+        std::memcpy(&entry_size, contents.data() + offset, sizeof(entry_size));
+        offset += sizeof(entry_size);
+        if (entry_size > contents.size() - offset) {
+            return std::nullopt;
+        }
+        entries.push_back(contents.subspan(offset, static_cast<size_t>(entry_size)));
+        offset += static_cast<size_t>(entry_size);
+    }
+    return entries;
+}
+
+u64 MillisecondsSince(std::chrono::steady_clock::time_point start) {
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                std::chrono::steady_clock::now() - start)
+                                .count());
+}
+} // Anonymous namespace
+
+std::optional<u32> ReadPipelineCacheVersion(const std::filesystem::path& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    std::array<char, CACHE_HEADER_SIZE> header{};
+    if (!file.read(header.data(), header.size()) ||
+        !std::equal(MAGIC_NUMBER.begin(), MAGIC_NUMBER.end(), header.begin())) {
+        return std::nullopt;
+    }
+    u32 cache_version{};
+    std::memcpy(&cache_version, header.data() + MAGIC_NUMBER.size(), sizeof(cache_version));
+    return cache_version;
+}
+
 void LoadPipelines(
     std::stop_token stop_loading, const std::filesystem::path& filename, u32 expected_cache_version,
-    Common::UniqueFunction<void, std::ifstream&, FileEnvironment> load_compute,
-    Common::UniqueFunction<void, std::ifstream&, std::vector<FileEnvironment>> load_graphics) try {
-    std::ifstream file(filename, std::ios::binary | std::ios::ate);
-    if (!file.is_open()) {
+    Common::UniqueFunction<void, std::span<const char>, FileEnvironment> load_compute,
+    Common::UniqueFunction<void, std::span<const char>, std::vector<FileEnvironment>>
+        load_graphics) try {
+    const auto start_time{std::chrono::steady_clock::now()};
+    Common::FS::MappedFile file(filename);
+    if (!file.IsOpen()) {
         return;
     }
-    file.exceptions(std::ifstream::failbit);
-    const auto end{file.tellg()};
-    file.seekg(0, std::ios::beg);
-
-    std::array<char, 8> magic_number;
-    u32 cache_version;
-    file.read(magic_number.data(), magic_number.size())
-        .read(reinterpret_cast<char*>(&cache_version), sizeof(cache_version));
+    const std::span<const char> contents{reinterpret_cast<const char*>(file.GetSpan().data()),
+                                         file.GetSize()};
+    std::array<char, 8> magic_number{};
+    u32 cache_version{};
+    if (contents.size() >= CACHE_HEADER_SIZE) {
+        std::memcpy(magic_number.data(), contents.data(), magic_number.size());
+        std::memcpy(&cache_version, contents.data() + magic_number.size(), sizeof(cache_version));
+    }
     if (magic_number != MAGIC_NUMBER || cache_version != expected_cache_version) {
-        file.close();
+        file.Close();
         if (Common::FS::RemoveFile(filename)) {
             if (magic_number != MAGIC_NUMBER) {
                 LOG_ERROR(Common_Filesystem, "Invalid pipeline cache file");
@@ -646,22 +764,54 @@ void LoadPipelines(
         }
         return;
     }
-    while (file.tellg() != end) {
+    const auto entries{IndexPipelineCache(contents)};
+    if (!entries) {
+        throw std::ios_base::failure("Truncated pipeline cache file");
+    }
+    const u64 index_time{MillisecondsSince(start_time)};
+
+    // Entries are deserialized in batches on worker threads while this thread hands the finished
+    // batches, in order, to the callbacks so their pipelines can start building right away
+    const size_t num_batches{Common::DivCeil(entries->size(), ENTRIES_PER_LOAD_BATCH)};
+    std::vector<std::future<std::vector<LoadedPipeline>>> batches;
+    batches.reserve(num_batches);
+    Common::ThreadWorker load_workers(std::max(std::thread::hardware_concurrency() / 2, 1U),
+                                      "PipelineCacheLoader");
+    for (size_t batch = 0; batch < num_batches; ++batch) {
+        const size_t first{batch * ENTRIES_PER_LOAD_BATCH};
+        const auto batch_entries{std::span(*entries).subspan(
+            first, std::min(ENTRIES_PER_LOAD_BATCH, entries->size() - first))};
+        std::promise<std::vector<LoadedPipeline>> promise;
+        batches.push_back(promise.get_future());
+        load_workers.QueueWork([batch_entries, promise = std::move(promise)]() mutable {
+            try {
+                std::vector<LoadedPipeline> pipelines;
+                pipelines.reserve(batch_entries.size());
+                for (const std::span<const char> entry : batch_entries) {
+                    pipelines.push_back(DeserializePipeline(entry));
+                }
+                promise.set_value(std::move(pipelines));
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+        });
+    }
+    for (auto& batch : batches) {
         if (stop_loading.stop_requested()) {
             return;
         }
-        u32 num_envs{};
-        file.read(reinterpret_cast<char*>(&num_envs), sizeof(num_envs));
-        std::vector<FileEnvironment> envs(num_envs);
-        for (FileEnvironment& env : envs) {
-            env.Deserialize(file);
-        }
-        if (envs.front().ShaderStage() == Shader::Stage::Compute) {
-            load_compute(file, std::move(envs.front()));
-        } else {
-            load_graphics(file, std::move(envs));
+        for (LoadedPipeline& pipeline : batch.get()) {
+            if (pipeline.envs.front().ShaderStage() == Shader::Stage::Compute) {
+                load_compute(std::span{pipeline.key}, std::move(pipeline.envs.front()));
+            } else {
+                load_graphics(std::span{pipeline.key}, std::move(pipeline.envs));
+            }
         }
     }
+    LOG_INFO(Common_Filesystem,
+             "Loaded {} pipeline cache entries ({} MiB), indexing took {} ms, deserializing {} ms",
+             entries->size(), contents.size() >> 20, index_time,
+             MillisecondsSince(start_time) - index_time);
 
 } catch (const std::ios_base::failure& e) {
     LOG_ERROR(Common_Filesystem, "{}", e.what());
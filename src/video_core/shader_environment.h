@@ -4,6 +4,7 @@
 #pragma once
 
 #include <array>
+#include <cstring>
 #include <filesystem>
 #include <iosfwd>
 #include <limits>
@@ -60,7 +61,7 @@ public:
 
     void Dump(u64 pipeline_hash, u64 shader_hash) override;
 
-    void Serialize(std::ofstream& file) const;
+    void Serialize(std::ostream& file) const;
 
     bool HasHLEMacroState() const override {
         return has_hle_engine_state;
@@ -165,7 +166,15 @@ public:
     FileEnvironment& operator=(const FileEnvironment&) = delete;
     FileEnvironment(const FileEnvironment&) = delete;
 
-    void Deserialize(std::ifstream& file);
+    /**
+     * Deserializes an environment from a pipeline cache entry.
+     *
+     * @param data Serialized data, starting at the environment
+     *
+     * @returns Number of bytes consumed from data.
+     * @throws std::ios_base::failure when data is truncated.
+     */
+    size_t Deserialize(std::span<const char> data);
 
     [[nodiscard]] u64 ReadInstruction(u32 address) override;
 
@@ -224,9 +233,29 @@ void SerializePipeline(const Key& key, const Envs& envs, const std::filesystem::
                       std::span(envs.data(), envs.size()), filename, cache_version);
 }
 
+/// Returns the version of a pipeline cache file, or nullopt when it isn't a pipeline cache.
+[[nodiscard]] std::optional<u32> ReadPipelineCacheVersion(const std::filesystem::path& filename);
+
+/**
+ * Loads the pipelines stored in a pipeline cache file.
+ * Entries are deserialized in parallel, the load callbacks are invoked in file order from the
+ * calling thread with the environments and the serialized key of each pipeline.
+ */
 void LoadPipelines(
     std::stop_token stop_loading, const std::filesystem::path& filename, u32 expected_cache_version,
-    Common::UniqueFunction<void, std::ifstream&, FileEnvironment> load_compute,
-    Common::UniqueFunction<void, std::ifstream&, std::vector<FileEnvironment>> load_graphics);
+    Common::UniqueFunction<void, std::span<const char>, FileEnvironment> load_compute,
+    Common::UniqueFunction<void, std::span<const char>, std::vector<FileEnvironment>>
+        load_graphics);
+
+/// Reads the key of a pipeline cache entry, returns false when the size does not match.
+template <typename Key>
+[[nodiscard]] bool ReadPipelineKey(std::span<const char> data, Key& key) {
+    static_assert(std::is_trivially_copyable_v<Key>);
+    if (data.size() != sizeof(key)) {
+        return false;
+    }
+    std::memcpy(&key, data.data(), sizeof(key));
+    return true;
+}
 
 } // namespace VideoCommon
@@ -0,0 +1,435 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <type_traits>
+
+#include <boost/container/small_vector.hpp>
+#include <boost/container/static_vector.hpp>
+
+#include "common/cityhash.h"
+#include "common/common_funcs.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/zstd_compression.h"
+#include "video_core/shader_output_cache.h"
+
+namespace VideoCommon {
+
+namespace {
+
+constexpr u32 FILE_MAGIC = Common::MakeMagic('S', 'O', 'U', 'T');
+constexpr u32 FILE_VERSION = 1;
+constexpr u32 ENTRY_MAGIC = Common::MakeMagic('S', 'O', 'E', 'N');
+
+struct FileHeader {
+    u32 magic;
+    u32 version;
+    u64 salt;
+};
+static_assert(sizeof(FileHeader) == 0x10, "FileHeader has incorrect size.");
+
+// Followed by the pipeline key and the compressed outputs.
+struct EntryHeader {
+    u32 magic;
+    u32 key_size;
+    u32 compressed_size;
+    u32 uncompressed_size;
+    u64 compile_time_ns;
+};
+static_assert(sizeof(EntryHeader) == 0x18, "EntryHeader has incorrect size.");
+
+static_assert(std::is_trivially_copyable_v<Shader::VaryingState>);
+static_assert(std::is_trivially_copyable_v<std::bitset<16>>);
+
+/// Applies a visitor to every member of a shader info, in serialization order.
+template <typename InfoType, typename Visitor>
+void VisitInfo(InfoType& info, Visitor&& visit) {
+    visit(info.uses_workgroup_id, info.uses_local_invocation_id, info.uses_invocation_id,
+          info.uses_invocation_info, info.uses_sample_id, info.uses_is_helper_invocation,
+          info.uses_subgroup_invocation_id, info.uses_subgroup_shuffles, info.uses_patches);
+    visit(info.interpolation, info.loads, info.stores, info.passthrough,
+          info.legacy_stores_mapping, info.loads_indexed_attributes);
+    visit(info.stores_frag_color, info.stores_sample_mask, info.stores_frag_depth,
+          info.stores_tess_level_outer, info.stores_tess_level_inner,
+          info.stores_indexed_attributes, info.stores_global_memory, info.uses_local_memory);
+    visit(info.uses_fp16, info.uses_fp64, info.uses_fp16_denorms_flush,
+          info.uses_fp16_denorms_preserve, info.uses_fp32_denorms_flush,
+          info.uses_fp32_denorms_preserve, info.uses_int8, info.uses_int16, info.uses_int64,
+          info.uses_image_1d, info.uses_sampled_1d, info.uses_sparse_residency,
+          info.uses_demote_to_helper_invocation, info.uses_subgroup_vote, info.uses_subgroup_mask,
+          info.uses_fswzadd, info.uses_derivatives, info.uses_typeless_image_reads,
+          info.uses_typeless_image_writes, info.uses_image_buffers);
+    visit(info.uses_shared_increment, info.uses_shared_decrement, info.uses_global_increment,
+          info.uses_global_decrement, info.uses_atomic_f32_add, info.uses_atomic_f16x2_add,
+          info.uses_atomic_f16x2_min, info.uses_atomic_f16x2_max, info.uses_atomic_f32x2_add,
+          info.uses_atomic_f32x2_min, info.uses_atomic_f32x2_max, info.uses_atomic_s32_min,
+          info.uses_atomic_s32_max, info.uses_int64_bit_atomics, info.uses_global_memory,
+          info.uses_atomic_image_u32, info.uses_shadow_lod, info.uses_rescaling_uniform,
+          info.uses_cbuf_indirect, info.uses_render_area);
+    visit(info.used_constant_buffer_types, info.used_storage_buffer_types,
+          info.used_indirect_cbuf_types, info.constant_buffer_mask,
+          info.constant_buffer_used_sizes, info.nvn_buffer_base, info.nvn_buffer_used,
+          info.requires_layer_emulation, info.emulated_layer, info.used_clip_distances);
+    visit(info.constant_buffer_descriptors, info.storage_buffers_descriptors,
+          info.texture_buffer_descriptors, info.image_buffer_descriptors,
+          info.texture_descriptors, info.image_descriptors);
+}
+
+template <typename T>
+struct IsDescriptorVector : std::false_type {};
+template <typename T, size_t N>
+struct IsDescriptorVector<boost::container::static_vector<T, N>> : std::true_type {};
+template <typename T, size_t N>
+struct IsDescriptorVector<boost::container::small_vector<T, N>> : std::true_type {};
+
+class Writer {
+public:
+    template <typename... Ts>
+    void operator()(const Ts&... values) {
+        (Write(values), ...);
+    }
+
+    template <typename T>
+    void Write(const T& value) {
+        if constexpr (IsDescriptorVector<T>::value) {
+            Write(static_cast<u32>(value.size()));
+            WriteBytes(value.data(), value.size() * sizeof(typename T::value_type));
+        } else if constexpr (std::is_same_v<T, std::map<Shader::IR::Attribute,
+                                                        Shader::IR::Attribute>>) {
+            Write(static_cast<u32>(value.size()));
+            for (const auto& [from, to] : value) {
+                Write(from);
+                Write(to);
+            }
+        } else {
+            static_assert(std::is_trivially_copyable_v<T>);
+            WriteBytes(&value, sizeof(value));
+        }
+    }
+
+    void WriteBytes(const void* data, size_t size) {
+        const auto* const bytes = static_cast<const u8*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    }
+
+    std::vector<u8> buffer;
+};
+
+class Reader {
+public:
+    explicit Reader(std::span<const u8> data_) : data{data_} {}
+
+    template <typename... Ts>
+    void operator()(Ts&... values) {
+        (Read(values), ...);
+    }
+
+    template <typename T>
+    void Read(T& value) {
+        if constexpr (IsDescriptorVector<T>::value) {
+            u32 size{};
+            Read(size);
+            if (size > value.max_size()) {
+                is_valid = false;
+                return;
+            }
+            value.resize(size);
+            ReadBytes(value.data(), size * sizeof(typename T::value_type));
+        } else if constexpr (std::is_same_v<T, std::map<Shader::IR::Attribute,
+                                                        Shader::IR::Attribute>>) {
+            u32 size{};
+            Read(size);
+            value.clear();
+            for (u32 index = 0; index < size && is_valid; ++index) {
+                Shader::IR::Attribute from{};
+                Shader::IR::Attribute to{};
+                Read(from);
+                Read(to);
+                value.emplace(from, to);
+            }
+        } else {
+            static_assert(std::is_trivially_copyable_v<T>);
+            ReadBytes(&value, sizeof(value));
+        }
+    }
+
+    void ReadBytes(void* output, size_t size) {
+        if (!is_valid || data.size() - offset < size) {
+            is_valid = false;
+            return;
+        }
+        std::memcpy(output, data.data() + offset, size);
+        offset += size;
+    }
+
+    [[nodiscard]] bool IsValid() const {
+        return is_valid;
+    }
+
+    [[nodiscard]] bool IsAtEnd() const {
+        return offset == data.size();
+    }
+
+private:
+    std::span<const u8> data;
+    size_t offset{};
+    bool is_valid{true};
+};
+
+std::vector<u8> SerializeOutputs(std::span<const ShaderOutput> outputs) {
+    Writer writer;
+    writer.Write(static_cast<u32>(outputs.size()));
+    for (const ShaderOutput& output : outputs) {
+        writer.Write(output.stage_index);
+        VisitInfo(output.info, writer);
+        writer.Write(static_cast<u32>(output.code.size()));
+        writer.WriteBytes(output.code.data(), output.code.size());
+    }
+    return std::move(writer.buffer);
+}
+
+bool DeserializeOutputs(std::span<const u8> data, std::vector<ShaderOutput>& outputs) {
+    Reader reader{data};
+    u32 num_outputs{};
+    reader.Read(num_outputs);
+    outputs.clear();
+    for (u32 index = 0; index < num_outputs && reader.IsValid(); ++index) {
+        ShaderOutput& output = outputs.emplace_back();
+        reader.Read(output.stage_index);
+        VisitInfo(output.info, reader);
+        u32 code_size{};
+        reader.Read(code_size);
+        if (!reader.IsValid() || code_size > data.size()) {
+            return false;
+        }
+        output.code.resize(code_size);
+        reader.ReadBytes(output.code.data(), code_size);
+    }
+    return reader.IsValid() && reader.IsAtEnd();
+}
+
+u64 HashKey(std::span<const char> key) {
+    return Common::CityHash64(key.data(), key.size());
+}
+
+} // Anonymous namespace
+
+void ShaderOutput::SetCode(std::span<const u32> words) {
+    code.resize(words.size_bytes());
+    std::memcpy(code.data(), words.data(), words.size_bytes());
+}
+
+std::vector<u32> ShaderOutput::CodeWords() const {
+    std::vector<u32> words(code.size() / sizeof(u32));
+    std::memcpy(words.data(), code.data(), words.size() * sizeof(u32));
+    return words;
+}
+
+ShaderOutputCache::ShaderOutputCache(std::filesystem::path filename_, u64 salt_)
+    : filename{std::move(filename_)}, salt{salt_}, store_worker{1, "ShaderOutputCache"} {
+    Load();
+}
+
+ShaderOutputCache::~ShaderOutputCache() {
+    FinishLoading();
+    store_worker.WaitForRequests();
+}
+
+u64 ShaderOutputCache::MakeSalt(std::span<const std::string> parts) {
+    u64 result = FILE_VERSION;
+    for (const std::string& part : parts) {
+        result = Common::CityHash64WithSeed(part.data(), part.size(), result);
+    }
+    return result;
+}
+
+void ShaderOutputCache::Load() {
+    if (!Common::FS::IsFile(filename)) {
+        return;
+    }
+    file.Open(filename);
+    const std::span<const u8> contents = file.GetSpan();
+    FileHeader header;
+    if (contents.size() < sizeof(header)) {
+        file.Close();
+        return;
+    }
+    std::memcpy(&header, contents.data(), sizeof(header));
+    if (header.magic != FILE_MAGIC || header.version != FILE_VERSION || header.salt != salt) {
+        // Written by another build or for another device, it will be replaced
+        LOG_INFO(HW_GPU, "Discarding outdated shader output cache");
+        file.Close();
+        return;
+    }
+
+    size_t offset = sizeof(header);
+    while (contents.size() - offset >= sizeof(EntryHeader)) {
+        EntryHeader entry;
+        std::memcpy(&entry, contents.data() + offset, sizeof(entry));
+        const u64 entry_size = sizeof(entry) + u64{entry.key_size} + entry.compressed_size;
+        if (entry.magic != ENTRY_MAGIC || contents.size() - offset < entry_size) {
+            break;
+        }
+        const auto key = contents.subspan(offset + sizeof(entry), entry.key_size);
+        const u64 key_hash = HashKey({reinterpret_cast<const char*>(key.data()), key.size()});
+        entries.insert_or_assign(key_hash, contents.subspan(offset, entry_size));
+        stored_keys.insert(key_hash);
+        offset += entry_size;
+    }
+    valid_size = offset;
+    if (valid_size != contents.size()) {
+        LOG_WARNING(HW_GPU, "Shader output cache {} is truncated",
+                    Common::FS::PathToUTF8String(filename));
+    }
+}
+
+bool ShaderOutputCache::Find(std::span<const char> key, std::vector<ShaderOutput>& outputs) {
+    const auto start{std::chrono::steady_clock::now()};
+    std::shared_lock lock{mutex};
+    if (!is_loading) {
+        return false;
+    }
+    const auto it = entries.find(HashKey(key));
+    if (it == entries.end()) {
+        ++misses;
+        return false;
+    }
+    const std::span<const u8> entry_data = it->second;
+    EntryHeader entry;
+    std::memcpy(&entry, entry_data.data(), sizeof(entry));
+    const auto entry_key = entry_data.subspan(sizeof(entry), entry.key_size);
+    if (!std::ranges::equal(std::as_bytes(entry_key), std::as_bytes(key))) {
+        ++misses;
+        return false;
+    }
+    std::vector<u8> data(entry.uncompressed_size);
+    const auto compressed = entry_data.subspan(sizeof(entry) + entry.key_size);
+    if (Common::Compression::DecompressDataZSTD(compressed, data) != data.size() ||
+        !DeserializeOutputs(data, outputs)) {
+        LOG_WARNING(HW_GPU, "Corrupted shader output cache entry");
+        ++misses;
+        return false;
+    }
+    ++hits;
+    saved_ns += entry.compile_time_ns;
+    load_ns += static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::steady_clock::now() - start)
+                                    .count());
+    return true;
+}
+
+void ShaderOutputCache::Insert(std::span<const char> key, std::vector<ShaderOutput> outputs,
+                               std::chrono::nanoseconds compile_time) {
+    {
+        std::scoped_lock lock{mutex};
+        if (!stored_keys.insert(HashKey(key)).second) {
+            return;
+        }
+    }
+    std::vector<char> key_copy(key.begin(), key.end());
+    store_worker.QueueWork([this, key = std::move(key_copy), outputs = std::move(outputs),
+                            compile_time] {
+        const std::vector<u8> data = SerializeOutputs(outputs);
+        const std::vector<u8> compressed =
+            Common::Compression::CompressDataZSTDDefault(data.data(), data.size());
+        if (compressed.empty()) {
+            return;
+        }
+        const EntryHeader header{
+            .magic = ENTRY_MAGIC,
+            .key_size = static_cast<u32>(key.size()),
+            .compressed_size = static_cast<u32>(compressed.size()),
+            .uncompressed_size = static_cast<u32>(data.size()),
+            .compile_time_ns = static_cast<u64>(compile_time.count()),
+        };
+        std::vector<u8> entry(sizeof(header) + key.size() + compressed.size());
+        std::memcpy(entry.data(), &header, sizeof(header));
+        std::memcpy(entry.data() + sizeof(header), key.data(), key.size());
+        std::memcpy(entry.data() + sizeof(header) + key.size(), compressed.data(),
+                    compressed.size());
+
+        std::scoped_lock lock{mutex};
+        if (is_loading) {
+            // The file can't be written while it is mapped on every platform
+            pending_entries.push_back(std::move(entry));
+        } else {
+            Append(entry);
+        }
+    });
+}
+
+void ShaderOutputCache::FinishLoading() {
+    // Let the entries compressed for the pipelines built while loading reach the pending list
+    store_worker.WaitForRequests();
+
+    std::scoped_lock lock{mutex};
+    if (!is_loading) {
+        return;
+    }
+    is_loading = false;
+    entries.clear();
+    file.Close();
+
+    const u64 num_hits = hits.load();
+    const u64 num_lookups = num_hits + misses.load();
+    if (num_lookups != 0) {
+        LOG_INFO(HW_GPU,
+                 "Shader output cache: {} of {} pipelines found ({:.1f}%), skipped {} ms of "
+                 "shader recompilation in {} ms",
+                 num_hits, num_lookups,
+                 100.0 * static_cast<double>(num_hits) / static_cast<double>(num_lookups),
+                 saved_ns.load() / 1'000'000, load_ns.load() / 1'000'000);
+    }
+
+    std::error_code ec;
+    if (valid_size != 0 && std::filesystem::file_size(filename, ec) != valid_size) {
+        // Drop the truncated tail so new entries follow the last valid one
+        std::filesystem::resize_file(filename, valid_size, ec);
+        if (ec) {
+            valid_size = 0;
+        }
+    }
+    for (const std::vector<u8>& entry : pending_entries) {
+        Append(entry);
+    }
+    pending_entries.clear();
+    pending_entries.shrink_to_fit();
+}
+
+void ShaderOutputCache::Append(std::span<const u8> entry) {
+    if (valid_size == 0) {
+        // Start a new file, replacing any outdated one
+        if (!Common::FS::CreateParentDirs(filename)) {
+            return;
+        }
+        const FileHeader header{
+            .magic = FILE_MAGIC,
+            .version = FILE_VERSION,
+            .salt = salt,
+        };
+        Common::FS::IOFile new_file{filename, Common::FS::FileAccessMode::Write,
+                                    Common::FS::FileType::BinaryFile};
+        if (!new_file.IsOpen() || !new_file.WriteObject(header)) {
+            LOG_ERROR(HW_GPU, "Failed to create shader output cache {}",
+                      Common::FS::PathToUTF8String(filename));
+            return;
+        }
+        valid_size = sizeof(header);
+    }
+    Common::FS::IOFile append_file{filename, Common::FS::FileAccessMode::Append,
+                                   Common::FS::FileType::BinaryFile};
+    if (!append_file.IsOpen() || append_file.WriteSpan(entry) != entry.size()) {
+        LOG_ERROR(HW_GPU, "Failed to write shader output cache {}",
+                  Common::FS::PathToUTF8String(filename));
+        return;
+    }
+    valid_size += entry.size();
+}
+
+} // namespace VideoCommon
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <shared_mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "common/common_types.h"
+#include "common/fs/mapped_file.h"
+#include "common/thread_worker.h"
+#include "shader_recompiler/shader_info.h"
+
+namespace VideoCommon {
+
+/// SPIR-V emitted by the shader recompiler for one stage of a pipeline, with its shader info.
+struct ShaderOutput {
+    u32 stage_index{};
+    Shader::Info info;
+    std::vector<u8> code;
+
+    void SetCode(std::span<const u32> words);
+
+    [[nodiscard]] std::vector<u32> CodeWords() const;
+};
+
+/**
+ * Persistent cache of the shader recompiler outputs of the pipelines of a title, so loading the
+ * pipeline cache on later boots doesn't have to translate and emit the shaders again. Only the
+ * Vulkan renderer uses it.
+ *
+ * Entries are keyed by the serialized pipeline key, the rest of what the outputs depend on (build,
+ * renderer, device and driver) is summarized by a salt, and files written with a different salt
+ * are discarded. All entries live zstd compressed in a single file that is memory mapped while the
+ * pipeline cache loads. Entries inserted meanwhile are appended once loading finishes.
+ */
+class ShaderOutputCache {
+public:
+    explicit ShaderOutputCache(std::filesystem::path filename, u64 salt);
+    ~ShaderOutputCache();
+
+    ShaderOutputCache(const ShaderOutputCache&) = delete;
+    ShaderOutputCache& operator=(const ShaderOutputCache&) = delete;
+
+    /// Returns a salt from strings describing the environment the outputs were produced in.
+    [[nodiscard]] static u64 MakeSalt(std::span<const std::string> parts);
+
+    /**
+     * Looks up the outputs of a pipeline, only entries of the mapped file are found.
+     *
+     * @param key     Serialized pipeline key
+     * @param outputs Receives the outputs of the stages of the pipeline
+     *
+     * @returns True when the pipeline was found, false otherwise.
+     */
+    [[nodiscard]] bool Find(std::span<const char> key, std::vector<ShaderOutput>& outputs);
+
+    /**
+     * Queues the outputs of a pipeline to be compressed and stored in the background.
+     *
+     * @param key          Serialized pipeline key
+     * @param outputs      Outputs of the stages of the pipeline
+     * @param compile_time Time it took to produce the outputs, reported as saved on later hits
+     */
+    void Insert(std::span<const char> key, std::vector<ShaderOutput> outputs,
+                std::chrono::nanoseconds compile_time);
+
+    /// Unmaps the file, logs the hit rate of the loaded entries and writes the pending ones.
+    void FinishLoading();
+
+private:
+    void Load();
+
+    void Append(std::span<const u8> entry);
+
+    std::filesystem::path filename;
+    u64 salt;
+
+    std::shared_mutex mutex;
+    Common::FS::MappedFile file;
+    /// Entries of the mapped file by key hash, pointing to their key and compressed data
+    std::unordered_map<u64, std::span<const u8>> entries;
+    /// Hashes of the keys stored or queued, so pipelines are written only once
+    std::unordered_set<u64> stored_keys;
+    std::vector<std::vector<u8>> pending_entries;
+    u64 valid_size{};
+    bool is_loading{true};
+
+    std::atomic<u64> hits{};
+    std::atomic<u64> misses{};
+    std::atomic<u64> saved_ns{};
+    std::atomic<u64> load_ns{};
+
+    Common::ThreadWorker store_worker;
+};
+
+} // namespace VideoCommon
@@ -7,6 +7,7 @@
 #include <boost/container/small_vector.hpp>
 
 #include "common/alignment.h"
+#include "common/fs/path_util.h"
 #include "common/settings.h"
 #include "video_core/control/channel_state.h"
 #include "video_core/dirty_flags.h"
@@ -43,6 +44,14 @@ TextureCache<P>::TextureCache(Runtime& runtime_, Tegra::MaxwellDeviceMemoryManag
     swizzle_data_buffer.resize_destructive(SWIZZLE_DATA_BUFFER_INITIAL_CAPACITY);
     unswizzle_data_buffer.resize_destructive(UNSWIZZLE_DATA_BUFFER_INITIAL_CAPACITY);
 
+    if (Settings::values.use_transcode_disk_cache.GetValue()) {
+        const u64 size_limit =
+            static_cast<u64>(Settings::values.transcode_disk_cache_size.GetValue()) * 1_MiB;
+        transcode_cache = std::make_unique<TranscodeCache>(
+            Common::FS::GetCitronPath(Common::FS::CitronPath::CacheDir) / "transcoded_textures",
+            size_limit);
+    }
+
     // Make sure the first index is reserved for the null resources
     // This way the null resource becomes a compile time constant
     void(slot_images.insert(NullImageParams{}));
@@ -1087,10 +1096,22 @@ void TextureCache<P>::UploadImageContents(Image& image, StagingBuffer& staging)
         *gpu_memory, gpu_addr, image.guest_size_bytes, &swizzle_data_buffer);
 
     if (True(image.flags & ImageFlagBits::Converted)) {
+        u64 transcode_key{};
+        if (transcode_cache) {
+            transcode_key = TranscodeCache::MakeKey(swizzle_data, image.info);
+            boost::container::small_vector<BufferImageCopy, 16> cached_copies;
+            if (transcode_cache->Load(transcode_key, mapped_span, cached_copies)) {
+                image.UploadMemory(staging, cached_copies);
+                return;
+            }
+        }
         unswizzle_data_buffer.resize_destructive(image.unswizzled_size_bytes);
         auto copies =
             UnswizzleImage(*gpu_memory, gpu_addr, image.info, swizzle_data, unswizzle_data_buffer);
         ConvertImage(unswizzle_data_buffer, image.info, mapped_span, copies);
+        if (transcode_cache) {
+            transcode_cache->Store(transcode_key, mapped_span.first(MapSizeBytes(image)), copies);
+        }
         image.UploadMemory(staging, copies);
     } else {
         const auto copies =
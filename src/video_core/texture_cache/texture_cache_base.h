@@ -33,6 +33,7 @@
 #include "video_core/texture_cache/image_info.h"
 #include "video_core/texture_cache/image_view_base.h"
 #include "video_core/texture_cache/render_targets.h"
+#include "video_core/texture_cache/transcode_cache.h"
 #include "video_core/texture_cache/types.h"
 #include "video_core/textures/texture.h"
 
@@ -490,6 +491,7 @@ private:
     u64 frame_tick = 0;
 
     Common::ThreadWorker texture_decode_worker{1, "TextureDecoder"};
+    std::unique_ptr<TranscodeCache> transcode_cache;
     std::vector<std::unique_ptr<AsyncDecodeContext>> async_decodes;
 
     // Join caching
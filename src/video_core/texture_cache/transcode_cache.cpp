@@ -0,0 +1,239 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/cityhash.h"
+#include "common/fs/file.h"
+#include "common/fs/fs.h"
+#include "common/fs/mapped_file.h"
+#include "common/fs/path_util.h"
+#include "common/logging/log.h"
+#include "common/settings.h"
+#include "common/zstd_compression.h"
+#include "video_core/texture_cache/image_info.h"
+#include "video_core/texture_cache/transcode_cache.h"
+
+namespace VideoCommon {
+
+namespace {
+
+constexpr u32 ENTRY_MAGIC = 0x48435854; // TXCH
+constexpr u32 ENTRY_VERSION = 1;
+
+struct EntryHeader {
+    u32 magic;
+    u32 version;
+    u32 num_copies;
+    u32 reserved;
+    u64 data_size;
+};
+static_assert(std::is_trivially_copyable_v<BufferImageCopy>);
+
+} // Anonymous namespace
+
+TranscodeCache::TranscodeCache(std::filesystem::path directory_, u64 size_limit_)
+    : directory{std::move(directory_)}, size_limit{size_limit_}, store_worker{1, "TranscodeCache"} {
+    if (!Common::FS::CreateDirs(directory)) {
+        LOG_ERROR(HW_GPU, "Failed to create the transcoded texture cache directory");
+        return;
+    }
+    ScanDirectory();
+}
+
+TranscodeCache::~TranscodeCache() {
+    store_worker.WaitForRequests();
+}
+
+u64 TranscodeCache::MakeKey(std::span<const u8> guest_data, const ImageInfo& info) {
+    // Everything the conversion depends on besides the guest data itself
+    const std::array<u32, 13> params{
+        ENTRY_VERSION,
+        static_cast<u32>(info.format),
+        static_cast<u32>(info.type),
+        static_cast<u32>(info.resources.levels),
+        static_cast<u32>(info.resources.layers),
+        info.size.width,
+        info.size.height,
+        info.size.depth,
+        info.type == ImageType::Linear ? info.pitch : info.block.height,
+        info.type == ImageType::Linear ? 0 : info.block.depth,
+        info.layer_stride,
+        info.tile_width_spacing,
+        static_cast<u32>(Settings::values.astc_recompression.GetValue()),
+    };
+    const u64 params_hash =
+        Common::CityHash64(reinterpret_cast<const char*>(params.data()), sizeof(params));
+    return Common::CityHash64WithSeed(reinterpret_cast<const char*>(guest_data.data()),
+                                      guest_data.size(), params_hash);
+}
+
+bool TranscodeCache::Load(u64 key, std::span<u8> output,
+                          boost::container::small_vector<BufferImageCopy, 16>& copies) {
+    {
+        std::scoped_lock lock{mutex};
+        if (!entries.contains(key)) {
+            return false;
+        }
+    }
+    const Common::FS::MappedFile file{EntryPath(key)};
+    const std::span<const u8> contents = file.GetSpan();
+    EntryHeader header;
+    if (contents.size() < sizeof(header)) {
+        return false;
+    }
+    std::memcpy(&header, contents.data(), sizeof(header));
+    const size_t copies_size = header.num_copies * sizeof(BufferImageCopy);
+    if (header.magic != ENTRY_MAGIC || header.version != ENTRY_VERSION ||
+        header.data_size > output.size() || contents.size() < sizeof(header) + copies_size) {
+        return false;
+    }
+    const std::span<const u8> compressed = contents.subspan(sizeof(header) + copies_size);
+    if (Common::Compression::DecompressDataZSTD(compressed, output) != header.data_size) {
+        LOG_WARNING(HW_GPU, "Corrupted transcoded texture cache entry {:016x}", key);
+        return false;
+    }
+    copies.resize(header.num_copies);
+    std::memcpy(copies.data(), contents.data() + sizeof(header), copies_size);
+
+    std::scoped_lock lock{mutex};
+    Touch(key);
+    return true;
+}
+
+void TranscodeCache::Store(u64 key, std::span<const u8> data,
+                           std::span<const BufferImageCopy> copies) {
+    {
+        std::scoped_lock lock{mutex};
+        if (entries.contains(key)) {
+            return;
+        }
+    }
+    const EntryHeader header{
+        .magic = ENTRY_MAGIC,
+        .version = ENTRY_VERSION,
+        .num_copies = static_cast<u32>(copies.size()),
+        .reserved = 0,
+        .data_size = data.size(),
+    };
+    std::vector<BufferImageCopy> copies_copy(copies.begin(), copies.end());
+    std::vector<u8> data_copy(data.begin(), data.end());
+    store_worker.QueueWork([this, key, header, copies = std::move(copies_copy),
+                            data = std::move(data_copy)] {
+        const std::vector<u8> compressed =
+            Common::Compression::CompressDataZSTDDefault(data.data(), data.size());
+        if (compressed.empty()) {
+            return;
+        }
+        // Write to a temporary file first so a partially written entry is never picked up
+        const std::filesystem::path path = EntryPath(key);
+        std::filesystem::path temp_path = path;
+        temp_path += ".tmp";
+        {
+            Common::FS::IOFile file{temp_path, Common::FS::FileAccessMode::Write,
+                                    Common::FS::FileType::BinaryFile};
+            if (!file.IsOpen() || file.WriteObject(header) != 1 ||
+                file.WriteSpan(std::span{copies}) != copies.size() ||
+                file.WriteSpan(std::span{compressed}) != compressed.size()) {
+                LOG_ERROR(HW_GPU, "Failed to write transcoded texture cache entry {:016x}", key);
+                return;
+            }
+        }
+        std::error_code ec;
+        std::filesystem::rename(temp_path, path, ec);
+        if (ec) {
+            std::filesystem::remove(temp_path, ec);
+            return;
+        }
+        const u64 entry_size = sizeof(header) + copies.size() * sizeof(BufferImageCopy) +
+                               compressed.size();
+        std::scoped_lock lock{mutex};
+        Insert(key, entry_size);
+        EvictOverLimit();
+    });
+}
+
+std::filesystem::path TranscodeCache::EntryPath(u64 key) const {
+    return directory / fmt::format("{:016x}.bin", key);
+}
+
+void TranscodeCache::ScanDirectory() {
+    struct FoundEntry {
+        u64 key;
+        u64 size;
+        std::filesystem::file_time_type last_use;
+    };
+    std::vector<FoundEntry> found;
+    std::error_code ec;
+    for (const auto& dir_entry : std::filesystem::directory_iterator{directory, ec}) {
+        const std::filesystem::path& path = dir_entry.path();
+        if (!dir_entry.is_regular_file(ec)) {
+            continue;
+        }
+        if (path.extension() != ".bin") {
+            // Leftovers of interrupted writes
+            std::filesystem::remove(path, ec);
+            continue;
+        }
+        const std::string stem = path.stem().string();
+        u64 key{};
+        const auto [ptr, parse_ec] =
+            std::from_chars(stem.data(), stem.data() + stem.size(), key, 16);
+        if (parse_ec != std::errc{} || ptr != stem.data() + stem.size()) {
+            continue;
+        }
+        found.push_back({key, dir_entry.file_size(ec), dir_entry.last_write_time(ec)});
+    }
+    // Modification times are bumped on every hit, so they give the usage order between sessions
+    std::ranges::sort(found, {}, &FoundEntry::last_use);
+
+    std::scoped_lock lock{mutex};
+    for (const FoundEntry& entry : found) {
+        Insert(entry.key, entry.size);
+    }
+    EvictOverLimit();
+    LOG_INFO(HW_GPU, "Transcoded texture cache: {} entries, {} MiB", entries.size(),
+             total_size >> 20);
+}
+
+void TranscodeCache::Insert(u64 key, u64 size) {
+    if (entries.contains(key)) {
+        return;
+    }
+    lru.push_back(key);
+    entries.emplace(key, Entry{size, std::prev(lru.end())});
+    total_size += size;
+}
+
+void TranscodeCache::Touch(u64 key) {
+    const auto it = entries.find(key);
+    if (it == entries.end()) {
+        return;
+    }
+    lru.splice(lru.end(), lru, it->second.lru_it);
+
+    std::error_code ec;
+    std::filesystem::last_write_time(EntryPath(key), std::filesystem::file_time_type::clock::now(),
+                                     ec);
+}
+
+void TranscodeCache::EvictOverLimit() {
+    std::error_code ec;
+    while (total_size > size_limit && !lru.empty()) {
+        const u64 key = lru.front();
+        lru.pop_front();
+        const auto it = entries.find(key);
+        total_size -= it->second.size;
+        entries.erase(it);
+        std::filesystem::remove(EntryPath(key), ec);
+    }
+}
+
+} // namespace VideoCommon
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2025 Citron Emulator Project
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <boost/container/small_vector.hpp>
+
+#include "common/common_types.h"
+#include "common/thread_worker.h"
+#include "video_core/texture_cache/types.h"
+
+namespace VideoCommon {
+
+struct ImageInfo;
+
+/**
+ * Persistent cache of images converted on the CPU (ASTC and BCn decoding, ASTC recompression).
+ *
+ * Entries are keyed by a hash of the swizzled guest data and the image parameters, so they can be
+ * shared between titles. Each entry is stored zstd compressed in its own file together with the
+ * buffer copies produced by the conversion, and is memory mapped when loaded. Once the cache grows
+ * past its size limit the least recently used entries are deleted.
+ */
+class TranscodeCache {
+public:
+    explicit TranscodeCache(std::filesystem::path directory, u64 size_limit);
+    ~TranscodeCache();
+
+    TranscodeCache(const TranscodeCache&) = delete;
+    TranscodeCache& operator=(const TranscodeCache&) = delete;
+
+    /// Returns the key identifying the converted contents of an image.
+    [[nodiscard]] static u64 MakeKey(std::span<const u8> guest_data, const ImageInfo& info);
+
+    /**
+     * Loads a cached conversion.
+     *
+     * @param key    Key of the image, as returned by MakeKey
+     * @param output Destination of the converted data
+     * @param copies Receives the buffer copies describing the converted data
+     *
+     * @returns True when the entry was found and loaded, false otherwise.
+     */
+    [[nodiscard]] bool Load(u64 key, std::span<u8> output,
+                            boost::container::small_vector<BufferImageCopy, 16>& copies);
+
+    /// Queues the converted data of an image to be compressed and stored in the background.
+    void Store(u64 key, std::span<const u8> data, std::span<const BufferImageCopy> copies);
+
+private:
+    struct Entry {
+        u64 size;
+        std::list<u64>::iterator lru_it;
+    };
+
+    [[nodiscard]] std::filesystem::path EntryPath(u64 key) const;
+
+    void ScanDirectory();
+
+    void Insert(u64 key, u64 size);
+
+    void Touch(u64 key);
+
+    void EvictOverLimit();
+
+    std::filesystem::path directory;
+    u64 size_limit;
+
+    std::mutex mutex;
+    u64 total_size = 0;
+    std::list<u64> lru; ///< Keys ordered from least to most recently used
+    std::unordered_map<u64, Entry> entries;
+
+    Common::ThreadWorker store_worker;
+};
+
+} // namespace VideoCommon
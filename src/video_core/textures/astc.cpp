@@ -5,6 +5,7 @@
 // <http://gamma.cs.unc.edu/FasTC/>
 
 #include <algorithm>
+#include <array>
 #include <bit>
 #include <cassert>
 #include <cstring>
@@ -14,55 +15,57 @@
 #include <boost/container/static_vector.hpp>
 
 #include "common/alignment.h"
+#include "common/assert.h"
 #include "common/common_types.h"
 #include "common/polyfill_ranges.h"
 #include "video_core/textures/astc.h"
 #include "video_core/textures/workers.h"
 
+// Reads bits LSB first from a block of at most 128 bits, which is kept in two 64-bit words so a
+// whole field can be extracted with a couple of shifts instead of one bit at a time.
 class InputBitStream {
 public:
-    constexpr explicit InputBitStream(std::span<const u8> data, size_t start_offset = 0)
-        : cur_byte{data.data()}, total_bits{data.size()}, next_bit{start_offset % 8} {}
+    constexpr explicit InputBitStream(std::span<const u8> data)
+        : total_bits{std::min<size_t>(data.size(), 16) * 8} {
+        for (size_t i = 0; i < total_bits / 8; ++i) {
+            words[i / 8] |= static_cast<u64>(data[i]) << ((i % 8) * 8);
+        }
+    }
 
     constexpr size_t GetBitsRead() const {
         return bits_read;
     }
 
     constexpr bool ReadBit() {
-        if (bits_read >= total_bits * 8) {
-            return 0;
-        }
-        const bool bit = ((*cur_byte >> next_bit) & 1) != 0;
-        ++next_bit;
-        while (next_bit >= 8) {
-            next_bit -= 8;
-            ++cur_byte;
-        }
-        ++bits_read;
-        return bit;
+        return ReadBits(1) != 0;
     }
 
+    // Bits past the end of the data read as zero and are not counted as read.
     constexpr u32 ReadBits(std::size_t nBits) {
-        u32 ret = 0;
-        for (std::size_t i = 0; i < nBits; ++i) {
-            ret |= (ReadBit() & 1) << i;
+        if (nBits == 0 || bits_read >= total_bits) {
+            return 0;
         }
-        return ret;
+        const size_t pos = bits_read;
+        u64 value;
+        if (pos >= 64) {
+            value = words[1] >> (pos - 64);
+        } else if (pos == 0) {
+            value = words[0];
+        } else {
+            value = (words[0] >> pos) | (words[1] << (64 - pos));
+        }
+        bits_read = std::min(bits_read + nBits, total_bits);
+        return static_cast<u32>(value & ((u64{1} << nBits) - 1));
     }
 
     template <std::size_t nBits>
     constexpr u32 ReadBits() {
-        u32 ret = 0;
-        for (std::size_t i = 0; i < nBits; ++i) {
-            ret |= (ReadBit() & 1) << i;
-        }
-        return ret;
+        return ReadBits(nBits);
     }
 
 private:
-    const u8* cur_byte;
+    std::array<u64, 2> words{};
     size_t total_bits = 0;
-    size_t next_bit = 0;
     size_t bits_read = 0;
 };
 
@@ -847,7 +850,7 @@ static void DecodeColorValues(u32* out, std::span<u8> data, const u32* modes, co
     // We now have enough to decode our integer sequence.
     IntegerEncodedVector decodedColorValues;
 
-    InputBitStream colorStream(data, 0);
+    InputBitStream colorStream(data);
     DecodeIntegerSequence(decodedColorValues, colorStream, range, nValues);
 
     // Once we have the decoded values, we need to dequantize them to the 0-255 range
@@ -1075,9 +1078,13 @@ static u32 UnquantizeTexelWeight(const IntegerEncodedValue& val) {
     return result;
 }
 
+template <u32 FixedWidth, u32 FixedHeight>
 static void UnquantizeTexelWeights(u32 out[2][144], const IntegerEncodedVector& weights,
-                                   const TexelWeightParams& params, const u32 blockWidth,
-                                   const u32 blockHeight) {
+                                   const TexelWeightParams& params, u32 runtimeBlockWidth,
+                                   u32 runtimeBlockHeight) {
+    const u32 blockWidth = FixedWidth != 0 ? FixedWidth : runtimeBlockWidth;
+    const u32 blockHeight = FixedHeight != 0 ? FixedHeight : runtimeBlockHeight;
+
     u32 weightIdx = 0;
     u32 unquantized[2][144];
 
@@ -1388,69 +1395,76 @@ static void ComputeEndpoints(Pixel& ep1, Pixel& ep2, const u32*& colorValues,
 #undef READ_INT_VALUES
 }
 
-static void FillVoidExtentLDR(InputBitStream& strm, std::span<u32> outBuf, u32 blockWidth,
-                              u32 blockHeight) {
-    // Don't actually care about the void extent, just read the bits...
-    for (s32 i = 0; i < 4; ++i) {
-        strm.ReadBits<13>();
-    }
-
-    // Decode the RGBA components and renormalize them to the range [0, 255]
-    u16 r = static_cast<u16>(strm.ReadBits<16>());
-    u16 g = static_cast<u16>(strm.ReadBits<16>());
-    u16 b = static_cast<u16>(strm.ReadBits<16>());
-    u16 a = static_cast<u16>(strm.ReadBits<16>());
+// Void extent blocks store their color in the upper 64 bits, and any LDR one has the low 12 bits
+// of the block mode set to 0xDFC. Check for them straight from the raw bytes, they are very common
+// in UI and padding textures.
+static bool IsVoidExtentLDR(std::span<const u8, 16> inBuf) {
+    return (inBuf[0] | ((inBuf[1] & 0xF) << 8)) == 0xDFC;
+}
 
-    u32 rgba = (r >> 8) | (g & 0xFF00) | (static_cast<u32>(b) & 0xFF00) << 8 |
-               (static_cast<u32>(a) & 0xFF00) << 16;
+static void FillVoidExtentLDR(std::span<const u8, 16> inBuf, u32* out, u32 outStride,
+                              u32 decompWidth, u32 decompHeight) {
+    // Don't actually care about the void extent, just take the high byte of each 16-bit
+    // RGBA component to renormalize them to the range [0, 255]
+    const u32 rgba = inBuf[9] | (static_cast<u32>(inBuf[11]) << 8) |
+                     (static_cast<u32>(inBuf[13]) << 16) | (static_cast<u32>(inBuf[15]) << 24);
 
-    for (u32 j = 0; j < blockHeight; j++) {
-        for (u32 i = 0; i < blockWidth; i++) {
-            outBuf[j * blockWidth + i] = rgba;
-        }
+    for (u32 j = 0; j < decompHeight; j++) {
+        std::fill_n(out + j * outStride, decompWidth, rgba);
     }
 }
 
-static void FillError(std::span<u32> outBuf, u32 blockWidth, u32 blockHeight) {
-    for (u32 j = 0; j < blockHeight; j++) {
-        for (u32 i = 0; i < blockWidth; i++) {
-            outBuf[j * blockWidth + i] = 0x00000000;
-        }
+static void FillError(u32* out, u32 outStride, u32 decompWidth, u32 decompHeight) {
+    for (u32 j = 0; j < decompHeight; j++) {
+        std::fill_n(out + j * outStride, decompWidth, 0x00000000U);
     }
 }
 
-static void DecompressBlock(std::span<const u8, 16> inBuf, const u32 blockWidth,
-                            const u32 blockHeight, std::span<u32, 12 * 12> outBuf) {
+// Decodes a single block writing its visible texels straight to the destination image. The block
+// footprint can be fixed at compile time so the weight infill and texel loops are specialized for
+// the most common footprints, a zero footprint takes the size from the runtime arguments.
+template <u32 FixedWidth = 0, u32 FixedHeight = 0>
+static void DecompressBlock(std::span<const u8, 16> inBuf, u32 runtimeBlockWidth,
+                            u32 runtimeBlockHeight, u32* out, u32 outStride, u32 decompWidth,
+                            u32 decompHeight) {
+    const u32 blockWidth = FixedWidth != 0 ? FixedWidth : runtimeBlockWidth;
+    const u32 blockHeight = FixedHeight != 0 ? FixedHeight : runtimeBlockHeight;
+
+    if (IsVoidExtentLDR(inBuf)) {
+        FillVoidExtentLDR(inBuf, out, outStride, decompWidth, decompHeight);
+        return;
+    }
+
     InputBitStream strm(inBuf);
     TexelWeightParams weightParams = DecodeBlockInfo(strm);
 
     // Was there an error?
     if (weightParams.m_bError) {
         assert(false && "Invalid block mode");
-        FillError(outBuf, blockWidth, blockHeight);
+        FillError(out, outStride, decompWidth, decompHeight);
         return;
     }
 
     if (weightParams.m_bVoidExtentLDR) {
-        FillVoidExtentLDR(strm, outBuf, blockWidth, blockHeight);
+        FillVoidExtentLDR(inBuf, out, outStride, decompWidth, decompHeight);
         return;
     }
 
     if (weightParams.m_bVoidExtentHDR) {
         assert(false && "HDR void extent blocks are unsupported!");
-        FillError(outBuf, blockWidth, blockHeight);
+        FillError(out, outStride, decompWidth, decompHeight);
         return;
     }
 
     if (weightParams.m_Width > blockWidth) {
         assert(false && "Texel weight grid width should be smaller than block width");
-        FillError(outBuf, blockWidth, blockHeight);
+        FillError(out, outStride, decompWidth, decompHeight);
         return;
     }
 
     if (weightParams.m_Height > blockHeight) {
         assert(false && "Texel weight grid height should be smaller than block height");
-        FillError(outBuf, blockWidth, blockHeight);
+        FillError(out, outStride, decompWidth, decompHeight);
         return;
     }
 
@@ -1460,7 +1474,7 @@ static void DecompressBlock(std::span<const u8, 16> inBuf, const u32 blockWidth,
 
     if (nPartitions == 4 && weightParams.m_bDualPlane) {
         assert(false && "Dual plane mode is incompatible with four partition blocks");
-        FillError(outBuf, blockWidth, blockHeight);
+        FillError(out, outStride, decompWidth, decompHeight);
         return;
     }
 
@@ -1615,79 +1629,121 @@ static void DecompressBlock(std::span<const u8, 16> inBuf, const u32 blockWidth,
 
     // Blocks can be at most 12x12, so we can have as many as 144 weights
     u32 weights[2][144];
-    UnquantizeTexelWeights(weights, texelWeightValues, weightParams, blockWidth, blockHeight);
+    UnquantizeTexelWeights<FixedWidth, FixedHeight>(weights, texelWeightValues, weightParams,
+                                                    blockWidth, blockHeight);
+
+    // Replicate the endpoints to 16 bits once per block instead of once per texel
+    u32 endpoints16[4][2][4];
+    for (u32 i = 0; i < nPartitions; i++) {
+        for (u32 c = 0; c < 4; c++) {
+            endpoints16[i][0][c] = ReplicateByteTo16(endpoints[i][0].Component(c));
+            endpoints16[i][1][c] = ReplicateByteTo16(endpoints[i][1].Component(c));
+        }
+    }
+
+    // Component that takes its weight from the second plane, four when there is none
+    const u32 dualPlaneComponent = weightParams.m_bDualPlane ? ((planeIdx + 1) & 3) : 4;
+
+    // Pixel components are stored as ARGB, packed into the output as R8G8B8A8
+    static constexpr std::array<u32, 4> componentShift{24, 0, 8, 16};
 
     // Now that we have endpoints and weights, we can interpolate and generate
     // the proper decoding...
-    for (u32 j = 0; j < blockHeight; j++)
-        for (u32 i = 0; i < blockWidth; i++) {
-            u32 partition = Select2DPartition(partitionIndex, i, j, nPartitions,
+    for (u32 j = 0; j < decompHeight; j++) {
+        u32* const outRow = out + j * outStride;
+        for (u32 i = 0; i < decompWidth; i++) {
+            u32 partition = 0;
+            if (nPartitions > 1) {
+                partition = Select2DPartition(partitionIndex, i, j, nPartitions,
                                               (blockHeight * blockWidth) < 32);
-            assert(partition < nPartitions);
+                assert(partition < nPartitions);
+            }
 
-            Pixel p;
+            u32 texel = 0;
             for (u32 c = 0; c < 4; c++) {
-                u32 C0 = endpoints[partition][0].Component(c);
-                C0 = ReplicateByteTo16(C0);
-                u32 C1 = endpoints[partition][1].Component(c);
-                C1 = ReplicateByteTo16(C1);
-
-                u32 plane = 0;
-                if (weightParams.m_bDualPlane && (((planeIdx + 1) & 3) == c)) {
-                    plane = 1;
-                }
+                const u32 C0 = endpoints16[partition][0][c];
+                const u32 C1 = endpoints16[partition][1][c];
+                const u32 plane = c == dualPlaneComponent ? 1 : 0;
 
-                u32 weight = weights[plane][j * blockWidth + i];
-                u32 C = (C0 * (64 - weight) + C1 * weight + 32) / 64;
-                if (C == 65535) {
-                    p.Component(c) = 255;
-                } else {
-                    double Cf = static_cast<double>(C);
-                    p.Component(c) = static_cast<u16>(255.0 * (Cf / 65536.0) + 0.5);
-                }
+                const u32 weight = weights[plane][j * blockWidth + i];
+                const u32 C = (C0 * (64 - weight) + C1 * weight + 32) / 64;
+
+                // Exact integer form of round(255.0 * (C / 65536.0)), which also maps 65535 to 255
+                const u32 value = (255 * C + 32768) >> 16;
+                texel |= value << componentShift[c];
             }
 
-            outBuf[j * blockWidth + i] = p.Pack();
+            outRow[i] = texel;
         }
+    }
+}
+
+template <u32 FixedWidth = 0, u32 FixedHeight = 0>
+static void DecompressBlockRows(std::span<const uint8_t> data, uint32_t width, uint32_t height,
+                                uint32_t block_width, uint32_t block_height,
+                                std::span<uint8_t> output, u32 rows, u32 cols, u32 first_row,
+                                u32 last_row) {
+    u32* const output_texels = reinterpret_cast<u32*>(output.data());
+    for (u32 row = first_row; row < last_row; ++row) {
+        const u32 z = row / rows;
+        const u32 y_index = row % rows;
+        const u32 y = y_index * block_height;
+        const u32 decompHeight = std::min(block_height, height - y);
+        u32* const out_row = output_texels + (static_cast<size_t>(z) * height + y) * width;
+
+        for (u32 x_index = 0; x_index < cols; ++x_index) {
+            const u32 block_index = row * cols + x_index;
+            const u32 x = x_index * block_width;
+            const u32 decompWidth = std::min(block_width, width - x);
+
+            const std::span<const u8, 16> blockPtr{data.subspan(block_index * 16, 16)};
+            DecompressBlock<FixedWidth, FixedHeight>(blockPtr, block_width, block_height,
+                                                     out_row + x, width, decompWidth,
+                                                     decompHeight);
+        }
+    }
 }
 
 void Decompress(std::span<const uint8_t> data, uint32_t width, uint32_t height, uint32_t depth,
                 uint32_t block_width, uint32_t block_height, std::span<uint8_t> output) {
+    // Blocks can be at most 12x12
+    ASSERT(block_width <= 12 && block_height <= 12);
+    ASSERT(output.size() >= static_cast<size_t>(width) * height * depth * 4);
+
     const u32 rows = Common::DivideUp(height, block_height);
     const u32 cols = Common::DivideUp(width, block_width);
+    const u32 total_rows = rows * depth;
+
+    // Each task decodes a band of consecutive block rows, across layers if needed, so it writes a
+    // contiguous range of the staging buffer and small images don't pay for one task per row.
+    static constexpr u32 BLOCKS_PER_TASK = 256;
+    const u32 rows_per_task = std::max(1U, BLOCKS_PER_TASK / std::max(cols, 1U));
+
+    // Pick a specialized decoder for the most common footprints
+    auto* decompress_rows = &DecompressBlockRows<0, 0>;
+    if (block_width == 4 && block_height == 4) {
+        decompress_rows = &DecompressBlockRows<4, 4>;
+    } else if (block_width == 6 && block_height == 6) {
+        decompress_rows = &DecompressBlockRows<6, 6>;
+    } else if (block_width == 8 && block_height == 8) {
+        decompress_rows = &DecompressBlockRows<8, 8>;
+    }
+
+    if (total_rows <= rows_per_task) {
+        decompress_rows(data, width, height, block_width, block_height, output, rows, cols, 0,
+                        total_rows);
+        return;
+    }
 
     Common::ThreadWorker& workers{GetThreadWorkers()};
-
-    for (u32 z = 0; z < depth; ++z) {
-        const u32 depth_offset = z * height * width * 4;
-        for (u32 y_index = 0; y_index < rows; ++y_index) {
-            auto decompress_stride = [data, width, height, block_width, block_height, output, rows,
-                                      cols, z, depth_offset, y_index] {
-                const u32 y = y_index * block_height;
-                for (u32 x_index = 0; x_index < cols; ++x_index) {
-                    const u32 block_index = (z * rows * cols) + (y_index * cols) + x_index;
-                    const u32 x = x_index * block_width;
-
-                    const std::span<const u8, 16> blockPtr{data.subspan(block_index * 16, 16)};
-
-                    // Blocks can be at most 12x12
-                    std::array<u32, 12 * 12> uncompData;
-                    DecompressBlock(blockPtr, block_width, block_height, uncompData);
-
-                    u32 decompWidth = std::min(block_width, width - x);
-                    u32 decompHeight = std::min(block_height, height - y);
-
-                    const std::span<u8> outRow = output.subspan(depth_offset + (y * width + x) * 4);
-                    for (u32 h = 0; h < decompHeight; ++h) {
-                        std::memcpy(outRow.data() + h * width * 4,
-                                    uncompData.data() + h * block_width, decompWidth * 4);
-                    }
-                }
-            };
-            workers.QueueWork(std::move(decompress_stride));
-        }
-        workers.WaitForRequests();
-    }
+    for (u32 first_row = 0; first_row < total_rows; first_row += rows_per_task) {
+        const u32 last_row = std::min(first_row + rows_per_task, total_rows);
+        workers.QueueWork([=] {
+            decompress_rows(data, width, height, block_width, block_height, output, rows, cols,
+                            first_row, last_row);
+        });
+    }
+    workers.WaitForRequests();
 }
 
 } // namespace Tegra::Texture::ASTC
@@ -2,10 +2,17 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include <array>
+#include <bit>
 #include <cmath>
 #include <cstring>
 #include <span>
 
+#if defined(ARCHITECTURE_x86_64)
+#include <emmintrin.h>
+#elif defined(ARCHITECTURE_arm64)
+#include <arm_neon.h>
+#endif
+
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "common/bit_util.h"
@@ -33,6 +40,78 @@ void incrpdep(u32& value) {
     value = ((value | ~mask) + swizzled_incr) & mask;
 }
 
+/// Size in bytes of a GOB sector, the unit the hardware swizzle moves around without reordering.
+constexpr u32 GOB_SECTOR_SIZE = 16;
+
+/// Offsets of the four 16 byte sectors of a 64 byte GOB line, relative to the swizzled line start.
+constexpr std::array<u32, GOB_SIZE_X / GOB_SECTOR_SIZE> GOB_LINE_SECTOR_OFFSETS{0, 32, 256, 288};
+
+void CopySector(u8* dst, const u8* src) {
+#if defined(ARCHITECTURE_x86_64)
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+#elif defined(ARCHITECTURE_arm64)
+    vst1q_u8(dst, vld1q_u8(src));
+#else
+    std::memcpy(dst, src, GOB_SECTOR_SIZE);
+#endif
+}
+
+/// Copies a whole 64 byte GOB line, one vector load and store per sector.
+template <bool TO_LINEAR>
+void CopyGobLine(u8* output, const u8* input) {
+    for (u32 sector = 0; sector < GOB_LINE_SECTOR_OFFSETS.size(); ++sector) {
+        const u32 linear_offset = sector * GOB_SECTOR_SIZE;
+        const u32 swizzled_offset = GOB_LINE_SECTOR_OFFSETS[sector];
+        CopySector(output + (TO_LINEAR ? swizzled_offset : linear_offset),
+                   input + (TO_LINEAR ? linear_offset : swizzled_offset));
+    }
+}
+
+/**
+ * Swizzles or unswizzles a single line of pixels.
+ * When pixels can't straddle a GOB sector (power of two sizes), the GOB aligned part of the line
+ * is moved a whole GOB line at a time and only the unaligned head and tail go pixel by pixel.
+ */
+template <bool TO_LINEAR, u32 BYTES_PER_PIXEL>
+void SwizzleLine(std::span<u8> output, std::span<const u8> input, u32 swizzled_base,
+                 u32 unswizzled_base, u32 swizzled_y, u32 x_shift, u32 x_begin, u32 num_pixels) {
+    const u32 x_end = x_begin + num_pixels * BYTES_PER_PIXEL;
+    u32 x = x_begin;
+
+    const auto copy_pixels = [&](u32 end) {
+        u32 swizzled_x = pdep<SWIZZLE_X_BITS>(x);
+        for (; x < end;
+             x += BYTES_PER_PIXEL, incrpdep<SWIZZLE_X_BITS, BYTES_PER_PIXEL>(swizzled_x)) {
+            const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
+            const u32 swizzled_offset = swizzled_base + offset_x + (swizzled_x | swizzled_y);
+            const u32 unswizzled_offset = unswizzled_base + x - x_begin;
+
+            u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
+            const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
+
+            std::memcpy(dst, src, BYTES_PER_PIXEL);
+        }
+    };
+
+    if constexpr (!std::has_single_bit(BYTES_PER_PIXEL)) {
+        copy_pixels(x_end);
+        return;
+    }
+    copy_pixels(std::min(x_end, Common::AlignUpLog2(x, GOB_SIZE_X_SHIFT)));
+    for (; x + GOB_SIZE_X <= x_end; x += GOB_SIZE_X) {
+        const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
+        const u32 swizzled_offset = swizzled_base + offset_x + swizzled_y;
+        const u32 unswizzled_offset = unswizzled_base + x - x_begin;
+
+        u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
+        const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
+
+        CopyGobLine<TO_LINEAR>(dst, src);
+    }
+    copy_pixels(x_end);
+}
+
 template <bool TO_LINEAR, u32 BYTES_PER_PIXEL>
 void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32 height, u32 depth,
                  u32 block_height, u32 block_depth, u32 stride) {
@@ -67,23 +146,10 @@ void SwizzleImpl(std::span<u8> output, std::span<const u8> input, u32 width, u32
             const u32 offset_y = (block_y >> block_height) * block_size +
                                  ((block_y & block_height_mask) << GOB_SIZE_SHIFT);
 
-            u32 swizzled_x = pdep<SWIZZLE_X_BITS>(origin_x * BYTES_PER_PIXEL);
-            for (u32 column = 0; column < width;
-                 ++column, incrpdep<SWIZZLE_X_BITS, BYTES_PER_PIXEL>(swizzled_x)) {
-                const u32 x = (column + origin_x) * BYTES_PER_PIXEL;
-                const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
-
-                const u32 base_swizzled_offset = offset_z + offset_y + offset_x;
-                const u32 swizzled_offset = base_swizzled_offset + (swizzled_x | swizzled_y);
-
-                const u32 unswizzled_offset =
-                    slice * pitch * height + line * pitch + column * BYTES_PER_PIXEL;
-
-                u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
-                const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
-
-                std::memcpy(dst, src, BYTES_PER_PIXEL);
-            }
+            const u32 unswizzled_offset = slice * pitch * height + line * pitch;
+            SwizzleLine<TO_LINEAR, BYTES_PER_PIXEL>(output, input, offset_z + offset_y,
+                                                    unswizzled_offset, swizzled_y, x_shift,
+                                                    origin_x * BYTES_PER_PIXEL, width);
         }
     }
 }
@@ -126,23 +192,10 @@ void SwizzleSubrectImpl(std::span<u8> output, std::span<const u8> input, u32 wid
             const u32 offset_y = (block_y >> block_height) * block_size +
                                  ((block_y & block_height_mask) << GOB_SIZE_SHIFT);
 
-            u32 swizzled_x = pdep<SWIZZLE_X_BITS>(origin_x * BYTES_PER_PIXEL);
-            for (u32 column = 0; column < extent_x;
-                 ++column, incrpdep<SWIZZLE_X_BITS, BYTES_PER_PIXEL>(swizzled_x)) {
-                const u32 x = (column + origin_x) * BYTES_PER_PIXEL;
-                const u32 offset_x = (x >> GOB_SIZE_X_SHIFT) << x_shift;
-
-                const u32 base_swizzled_offset = offset_z + offset_y + offset_x;
-                const u32 swizzled_offset = base_swizzled_offset + (swizzled_x | swizzled_y);
-
-                const u32 unswizzled_offset =
-                    slice * pitch * height + line * pitch + column * BYTES_PER_PIXEL;
-
-                u8* const dst = &output[TO_LINEAR ? swizzled_offset : unswizzled_offset];
-                const u8* const src = &input[TO_LINEAR ? unswizzled_offset : swizzled_offset];
-
-                std::memcpy(dst, src, BYTES_PER_PIXEL);
-            }
+            const u32 unswizzled_offset = slice * pitch * height + line * pitch;
+            SwizzleLine<TO_LINEAR, BYTES_PER_PIXEL>(output, input, offset_z + offset_y,
+                                                    unswizzled_offset, swizzled_y, x_shift,
+                                                    origin_x * BYTES_PER_PIXEL, extent_x);
         }
         unprocessed_lines -= lines_in_y;
         if (unprocessed_lines == 0) {